@@ -11,17 +11,144 @@
 #include <Common_wwise.h>
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AK/SoundEngine/Common/AkStreamMgrModule.h>
 
 namespace Audio
 {
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // Stream Refill Worker
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+
+    /**
+     * A single thread refilling the stream rings of all streamed files.
+     * It sleeps until a chunk is consumed, so that an idle file costs nothing and many files don't cost a thread each.
+     * The worker is created with the first streamed file and destroyed with the last one.
+     */
+    class AudioInputFile::StreamRefillWorker
+    {
+    public:
+        AUDIO_IMPL_CLASS_ALLOCATOR(StreamRefillWorker)
+
+        /**
+         * Add a file to the files being refilled, creating the worker if it is the first one.
+         * @param file A streamed file which has requested its initial chunks.
+         * @return The worker that the file signals when it consumes a chunk.
+         */
+        static StreamRefillWorker* AddFile(AudioInputFile* file)
+        {
+            AZStd::lock_guard<AZStd::mutex> instanceLock(s_instanceMutex);
+            if (!s_instance)
+            {
+                s_instance = aznew StreamRefillWorker();
+            }
+
+            AZStd::lock_guard<AZStd::mutex> filesLock(s_instance->m_filesMutex);
+            s_instance->m_files.push_back(file);
+            return s_instance;
+        }
+
+        /**
+         * Remove a file from the files being refilled, destroying the worker if it was the last one.
+         * The worker doesn't access the file anymore once this returns.
+         * @param file A file added before.
+         */
+        static void RemoveFile(AudioInputFile* file)
+        {
+            AZStd::lock_guard<AZStd::mutex> instanceLock(s_instanceMutex);
+            if (!s_instance)
+            {
+                return;
+            }
+
+            bool lastFile = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> filesLock(s_instance->m_filesMutex);
+                AZStd::vector<AudioInputFile*>& files = s_instance->m_files;
+                files.erase(AZStd::remove(files.begin(), files.end(), file), files.end());
+                lastFile = files.empty();
+            }
+
+            if (lastFile)
+            {
+                delete s_instance;
+                s_instance = nullptr;
+            }
+        }
+
+        /**
+         * Wake the worker up to refill consumed chunks.
+         * Doesn't allocate or take locks, so it is safe to call from the audio render thread.
+         */
+        void Signal()
+        {
+            m_signal.release();
+        }
+
+    private:
+        StreamRefillWorker()
+        {
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "AudioInputFile Stream Refill";
+            m_thread = AZStd::thread(threadDesc, [this]()
+                {
+                    Run();
+                });
+        }
+
+        ~StreamRefillWorker()
+        {
+            m_stop = true;
+            m_signal.release();
+            m_thread.join();
+        }
+
+        void Run()
+        {
+            while (true)
+            {
+                m_signal.acquire();
+                if (m_stop)
+                {
+                    break;
+                }
+
+                // Files that didn't consume anything since the last pass have no empty chunk, so they are skipped quickly.
+                AZStd::lock_guard<AZStd::mutex> filesLock(m_filesMutex);
+                for (AudioInputFile* file : m_files)
+                {
+                    file->RefillStreamChunks();
+                }
+            }
+        }
+
+        static AZStd::mutex s_instanceMutex;
+        static StreamRefillWorker* s_instance;
+
+        AZStd::mutex m_filesMutex;
+        AZStd::vector<AudioInputFile*> m_files;     ///< Guarded by m_filesMutex.
+        AZStd::semaphore m_signal;
+        AZStd::atomic_bool m_stop{ false };
+        AZStd::thread m_thread;
+    };
+
+    AZStd::mutex AudioInputFile::StreamRefillWorker::s_instanceMutex;
+    AudioInputFile::StreamRefillWorker* AudioInputFile::StreamRefillWorker::s_instance = nullptr;
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     // Audio Input File
     ///////////////////////////////////////////////////////////////////////////////////////////////
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    AudioInputFile::AudioInputFile(const SAudioInputConfig& sourceConfig)
+    AudioInputFile::AudioInputFile(const SAudioInputConfig& sourceConfig, size_t maxPreloadSize)
+        : m_maxPreloadSize(maxPreloadSize)
     {
         m_config = sourceConfig;
 
@@ -63,11 +190,14 @@ namespace Audio
                 // so it can parse header information.
                 // It will return the number of header bytes read, that is an offset to
                 // the beginning of the real signal data.
+                m_dataFileOffset = 0;
                 if (m_parser)
                 {
                     size_t headerBytesRead = m_parser->ParseHeader(fileStream);
                     if (headerBytesRead > 0 && m_parser->IsHeaderValid())
                     {
+                        m_dataFileOffset = headerBytesRead;
+
                         // Update the size...
                         m_dataSize = m_parser->GetDataSize();
 
@@ -80,10 +210,30 @@ namespace Audio
                 }
 
 
-                if (IsOk())
+                const size_t frameBytes = (m_config.m_numChannels * m_config.m_bitsPerSample) >> 3;  // bits --> bytes
+                auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+
+                if (IsOk() && m_dataSize > m_maxPreloadSize && streamer && frameBytes > 0 && frameBytes <= StreamChunkSize)
+                {
+                    // Too large to hold at once, allocate only the stream ring and start filling it.
+                    // Chunks hold whole sample frames, so that a frame never straddles two chunks.
+                    m_streamChunkCapacity = (StreamChunkSize / frameBytes) * frameBytes;
+                    m_dataPtr = static_cast<AZ::u8*>(azmalloc(m_streamChunkCapacity * StreamChunkCount, 16, AudioImplAllocator));
+
+                    ResetBookmarks();
+
+                    for (size_t chunkIndex = 0; chunkIndex < StreamChunkCount; ++chunkIndex)
+                    {
+                        RequestStreamChunk(chunkIndex);
+                    }
+                    m_streamRefillWorker = StreamRefillWorker::AddFile(this);
+
+                    result = true;
+                }
+                else if (IsOk())
                 {
                     // Allocate a new buffer to hold the data...
-                    m_dataPtr = new AZ::u8[m_dataSize];
+                    m_dataPtr = static_cast<AZ::u8*>(azmalloc(m_dataSize, 16, AudioImplAllocator));
 
                     // Read file into internal buffer...
                     size_t bytesRead = fileStream.Read(m_dataSize, m_dataPtr);
@@ -104,9 +254,36 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void AudioInputFile::UnloadFile()
     {
+        if (IsStreaming())
+        {
+            // Stop the refills first, then make sure no stream reads into the buffer are left before releasing it.
+            StreamRefillWorker::RemoveFile(this);
+            m_streamRefillWorker = nullptr;
+            auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            for (StreamChunk& chunk : m_streamChunks)
+            {
+                if (chunk.m_state.load() == StreamChunkState::Loading && chunk.m_request && streamer)
+                {
+                    streamer->QueueRequest(streamer->Cancel(chunk.m_request));
+                }
+            }
+            while (m_streamReadsInFlight.load() > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+            for (StreamChunk& chunk : m_streamChunks)
+            {
+                chunk.m_request.reset();
+                chunk.m_size = 0;
+                chunk.m_state.store(StreamChunkState::Empty);
+            }
+            m_streamChunkCapacity = 0;
+            m_streamFailed = false;
+        }
+
         if (m_dataPtr)
         {
-            delete [] m_dataPtr;
+            azfree(m_dataPtr, AudioImplAllocator);
             m_dataPtr = nullptr;
         }
         m_dataSize = 0;
@@ -117,8 +294,8 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void AudioInputFile::ReadInput([[maybe_unused]] const AudioStreamData& data)
     {
-        // Don't really need this for File-based sources, the whole file is read in the constructor.
-        // However, we may need to implement this for asynchronous loading of the file (streaming).
+        // Don't really need this for File-based sources, the file data is either read in the constructor
+        // or streamed into the stream ring by the refill worker as it gets consumed by CopyData.
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,6 +371,15 @@ namespace Audio
             numSampleFrames = (copySize / frameBytes);
         }
 
+        if (IsStreaming())
+        {
+            // The stream ring may not have all of the requested data yet, in which case only the frames
+            // that are ready get copied and the rest is picked up by the following calls.
+            copySize = CopyStreamData(copySize, static_cast<AZ::u8*>(toBuffer));
+            m_dataCurrentReadSize += copySize;
+            return (copySize / frameBytes);
+        }
+
         if (copySize > 0)
         {
             ::memcpy(toBuffer, m_dataCurrentPtr, copySize);
@@ -204,17 +390,133 @@ namespace Audio
         return numSampleFrames;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    size_t AudioInputFile::CopyStreamData(size_t copySize, AZ::u8* toBuffer)
+    {
+        size_t bytesCopied = 0;
+        while (bytesCopied < copySize)
+        {
+            StreamChunk& chunk = m_streamChunks[m_streamReadChunk];
+            if (chunk.m_state.load(AZStd::memory_order_acquire) != StreamChunkState::Ready)
+            {
+                // Underrun, the chunk is still being read by the streamer.
+                break;
+            }
+
+            const AZ::u8* chunkData = m_dataPtr + (m_streamReadChunk * m_streamChunkCapacity);
+            const size_t chunkBytes = AZStd::min(chunk.m_size - m_streamReadChunkOffset, copySize - bytesCopied);
+            ::memcpy(toBuffer + bytesCopied, chunkData + m_streamReadChunkOffset, chunkBytes);
+            bytesCopied += chunkBytes;
+            m_streamReadChunkOffset += chunkBytes;
+
+            if (m_streamReadChunkOffset == chunk.m_size)
+            {
+                // Chunk fully consumed, the refill worker refills it with the data following the last requested chunk.
+                // Queuing the read here would allocate and lock on the audio render thread.
+                chunk.m_state.store(StreamChunkState::Empty, AZStd::memory_order_release);
+                m_streamRefillWorker->Signal();
+                m_streamReadChunk = (m_streamReadChunk + 1) % StreamChunkCount;
+                m_streamReadChunkOffset = 0;
+            }
+        }
+
+        return bytesCopied;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioInputFile::RequestStreamChunk(size_t chunkIndex)
+    {
+        if (m_streamRequestOffset >= m_dataSize)
+        {
+            // All of the data has been requested already.
+            return;
+        }
+
+        auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        AZ_Assert(streamer, "AudioInputFile - Streaming a file without AZ::IO::Streamer!\n");
+
+        StreamChunk& chunk = m_streamChunks[chunkIndex];
+        chunk.m_size = AZStd::min(m_streamChunkCapacity, m_dataSize - m_streamRequestOffset);
+        chunk.m_state.store(StreamChunkState::Loading);
+
+        // The chunk is needed once the chunks ahead of it have been played.
+        const size_t frameBytes = (m_config.m_numChannels * m_config.m_bitsPerSample) >> 3;  // bits --> bytes
+        const size_t bytesPerSecond = AZStd::max<size_t>(m_config.m_sampleRate * frameBytes, 1);
+        const auto deadline = AZStd::chrono::duration_cast<AZ::IO::IStreamerTypes::Deadline>(AZStd::chrono::duration<double>(
+            static_cast<double>(m_streamChunkCapacity * (StreamChunkCount - 1)) / static_cast<double>(bytesPerSecond)));
+
+        ++m_streamReadsInFlight;
+        chunk.m_request = streamer->Read(
+            m_config.m_sourceFilename.c_str(),
+            m_dataPtr + (chunkIndex * m_streamChunkCapacity),
+            m_streamChunkCapacity,
+            chunk.m_size,
+            deadline,
+            AZ::IO::IStreamerTypes::s_priorityHigh,
+            m_dataFileOffset + m_streamRequestOffset);
+        m_streamRequestOffset += chunk.m_size;
+
+        streamer->SetRequestCompleteCallback(chunk.m_request,
+            [this, chunkIndex](AZ::IO::FileRequestHandle request)
+            {
+                auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+                if (streamer->GetRequestStatus(request) == AZ::IO::IStreamerTypes::RequestStatus::Completed)
+                {
+                    m_streamChunks[chunkIndex].m_state.store(StreamChunkState::Ready, AZStd::memory_order_release);
+                }
+                else
+                {
+                    // Canceled or failed, the playback can't continue past this point.
+                    m_streamFailed = true;
+                }
+                --m_streamReadsInFlight;
+            });
+        streamer->QueueRequest(chunk.m_request);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioInputFile::RefillStreamChunks()
+    {
+        // Chunks are consumed in ring order, so refilling in the same order keeps the file data in sequence.
+        while (m_streamRequestOffset < m_dataSize && !m_streamFailed &&
+            m_streamChunks[m_streamRefillChunk].m_state.load(AZStd::memory_order_acquire) == StreamChunkState::Empty)
+        {
+            RequestStreamChunk(m_streamRefillChunk);
+            m_streamRefillChunk = (m_streamRefillChunk + 1) % StreamChunkCount;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    size_t AudioInputFile::GetBufferSize() const
+    {
+        if (!m_dataPtr)
+        {
+            return 0;
+        }
+        return IsStreaming() ? (m_streamChunkCapacity * StreamChunkCount) : m_dataSize;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    bool AudioInputFile::IsStreaming() const
+    {
+        return (m_streamChunkCapacity > 0);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void AudioInputFile::ResetBookmarks()
     {
         m_dataCurrentPtr = m_dataPtr;
         m_dataCurrentReadSize = 0;
+        m_streamRequestOffset = 0;
+        m_streamReadChunk = 0;
+        m_streamReadChunkOffset = 0;
+        m_streamRefillChunk = 0;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
     bool AudioInputFile::IsEof() const
     {
-        return (m_dataCurrentReadSize == m_dataSize);
+        return (m_dataCurrentReadSize == m_dataSize) || m_streamFailed;
     }
 
 } // namespace Audio
@@ -10,6 +10,10 @@
 
 #include <AudioSourceManager.h>
 
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+
 namespace Audio
 {
     /**
@@ -56,6 +60,9 @@ namespace Audio
      * A type of AudioInputSource representing an audio file.
      * Contains audio file data, holds a pointer to the raw data and provides methods to read chunks of data at a time
      * to an output (AkAudioBuffer).
+     * Files with more data than fits in the stream ring are not loaded at once, instead AZ::IO::Streamer keeps
+     * a ring of chunks filled ahead of the read position. Consumed chunks are refilled by a refill worker shared by
+     * all streamed files, so that the audio render thread never queues stream reads.
      */
     class AudioInputFile
         : public AudioInputSource
@@ -63,20 +70,28 @@ namespace Audio
     public:
         AUDIO_IMPL_CLASS_ALLOCATOR(AudioInputFile)
 
-        AudioInputFile(const SAudioInputConfig& sourceConfig);
+        static constexpr size_t StreamChunkSize = 64 * 1024;                            ///< Size of a chunk of the stream ring in bytes.
+        static constexpr size_t StreamChunkCount = 4;                                   ///< Number of chunks in the stream ring.
+        static constexpr size_t DefaultMaxPreloadSize = StreamChunkSize * StreamChunkCount; ///< Files with more data are streamed.
+
+        /**
+         * @param sourceConfig Configuration of the source, with the file to play.
+         * @param maxPreloadSize Files with more audio data (in bytes) are streamed, smaller files are loaded at once.
+         */
+        AudioInputFile(const SAudioInputConfig& sourceConfig, size_t maxPreloadSize = DefaultMaxPreloadSize);
         ~AudioInputFile() override;
 
         /**
          * Load file into buffer.
          * Use an AudioFileParser if needed to parse header information, then proceed to load the audio data
-         * to the internal buffer.
+         * to the internal buffer, or start streaming it into the stream ring if the data is too large.
          * @return True upon successful load, false otherwise.
          */
         bool LoadFile();
 
         /**
          * Unload the file data.
-         * Release the internal buffer of file data.
+         * Release the internal buffer of file data, after cancelling any stream reads into it.
          */
         void UnloadFile();
 
@@ -96,7 +111,60 @@ namespace Audio
          */
         size_t CopyData(size_t numSampleFrames, void* toBuffer);     // frames, not bytes!
 
+        /**
+         * Get the size of the internal buffer of file data.
+         * @return Size in bytes, which is bounded by the stream ring size for streamed files.
+         */
+        size_t GetBufferSize() const;
+
+        /**
+         * Checks whether the file data is streamed rather than loaded at once.
+         * @return True if the file is streamed.
+         */
+        bool IsStreaming() const;
+
     private:
+        class StreamRefillWorker;
+
+        /**
+         * State of a chunk of the stream ring.
+         * A chunk is only marked empty by the thread consuming it, only refilled by the refill worker,
+         * and only marked ready by the stream read completing.
+         */
+        enum class StreamChunkState : AZ::u8
+        {
+            Empty,      ///< Consumed, or past the end of the data.
+            Loading,    ///< A stream read into the chunk is in flight.
+            Ready,      ///< Filled with data that hasn't been consumed yet.
+        };
+
+        struct StreamChunk
+        {
+            AZ::IO::FileRequestPtr m_request;   ///< Last stream read into the chunk.
+            size_t m_size = 0;                  ///< Number of bytes of data in the chunk.
+            AZStd::atomic<StreamChunkState> m_state{ StreamChunkState::Empty };
+        };
+
+        /**
+         * Queue a stream read of the next part of the file data into a chunk of the stream ring.
+         * @param chunkIndex Index of an empty chunk.
+         */
+        void RequestStreamChunk(size_t chunkIndex);
+
+        /**
+         * Refill the consumed chunks of the stream ring in ring order.
+         * Only called by the refill worker.
+         */
+        void RefillStreamChunks();
+
+        /**
+         * Copy data from the stream ring to an output buffer, stopping at the first chunk which isn't ready yet.
+         * @param copySize Number of bytes requested.
+         * @param toBuffer Output buffer to copy to.
+         * @return Number of bytes actually copied.
+         */
+        size_t CopyStreamData(size_t copySize, AZ::u8* toBuffer);
+
         /**
          * Resets internal bookmarking.
          * Bookmarks are used internally to keep track of where we are in the buffer during
@@ -118,6 +186,21 @@ namespace Audio
         // Bookmarks
         AZ::u8* m_dataCurrentPtr = nullptr; ///< The internal bookmark pointer.
         size_t m_dataCurrentReadSize = 0;   ///< The internal bookmark indicating how much data has been read so far.
+
+        // Streaming
+        size_t m_maxPreloadSize = DefaultMaxPreloadSize;    ///< Files with more data are streamed.
+        size_t m_dataFileOffset = 0;                        ///< Byte-offset into the file where audio data begins.
+        size_t m_streamChunkCapacity = 0;                   ///< Size of each chunk, a whole number of sample frames. Zero when not streaming.
+        size_t m_streamRequestOffset = 0;                   ///< Offset into the audio data of the next chunk to request.
+        size_t m_streamReadChunk = 0;                       ///< Index of the chunk being consumed.
+        size_t m_streamReadChunkOffset = 0;                 ///< Bytes consumed from the chunk being consumed.
+        AZStd::array<StreamChunk, StreamChunkCount> m_streamChunks;
+        AZStd::atomic<AZ::u32> m_streamReadsInFlight{ 0 };
+        AZStd::atomic_bool m_streamFailed{ false };
+
+        // Stream refills
+        StreamRefillWorker* m_streamRefillWorker = nullptr; ///< Worker refilling the stream ring, set while the file is streaming.
+        size_t m_streamRefillChunk = 0;                     ///< Index of the next chunk to refill, only accessed by the worker.
     };
 
 } // namespace Audio
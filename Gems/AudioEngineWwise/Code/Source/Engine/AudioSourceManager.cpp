@@ -12,6 +12,7 @@
 #include <AudioInput/AudioInputStream.h>
 
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <AK/AkWwiseSDKVersion.h>
 #include <AK/Plugin/AkAudioInputPlugin.h>
@@ -169,8 +170,18 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void AudioSourceManager::Shutdown()
     {
+        {
+            AZStd::lock_guard<AZStd::mutex> queueLock(m_deactivationQueueMutex);
+            m_queuedDeactivations.clear();
+        }
+
         AZStd::lock_guard<AZStd::mutex> lock(m_inputMutex);
 
+        // Callbacks still in flight may be using the active sources, stop publishing them before they are destroyed.
+        m_activeSnapshot.store(nullptr);
+        m_retiredSnapshots.emplace_back(m_readEpoch.load(), AZStd::move(m_activeSnapshotOwner));
+        WaitForSnapshotReaders();
+
         m_activeAudioInputs.clear();
         m_inactiveAudioInputs.clear();
     }
@@ -215,14 +226,21 @@ namespace Audio
             return false;
         }
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_inputMutex);
-
         ptr->SetSourceId(sourceConfig.m_sourceId);
-        m_inactiveAudioInputs.emplace(sourceConfig.m_sourceId, AZStd::move(ptr));
+        AddInactiveSource(AZStd::move(ptr));
 
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioSourceManager::AddInactiveSource(AZStd::unique_ptr<AudioInputSource> source)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_inputMutex);
+
+        const TAudioSourceId sourceId = source->GetSourceId();
+        m_inactiveAudioInputs.emplace(sourceId, AZStd::move(source));
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void AudioSourceManager::ActivateSource(TAudioSourceId sourceId, AkPlayingID playingId)
     {
@@ -237,6 +255,8 @@ namespace Audio
                 m_inactiveAudioInputs.erase(sourceId);
 
                 m_activeAudioInputs[playingId]->OnActivated();
+
+                PublishActiveSources();
             }
             else
             {
@@ -262,6 +282,11 @@ namespace Audio
                 m_inactiveAudioInputs[sourceId] = AZStd::move(m_activeAudioInputs[playingId]);
                 m_activeAudioInputs.erase(playingId);
 
+                // The render thread may still be writing output from the source, wait for it before the source unloads anything.
+                // Inactive sources are never read by the callbacks, so they can be destroyed right away afterwards.
+                PublishActiveSources();
+                WaitForSnapshotReaders();
+
                 // Signal to the audio input source that it was deactivated!  It might unload it's resources.
                 m_inactiveAudioInputs[sourceId]->OnDeactivated();
 
@@ -281,6 +306,29 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioSourceManager::QueueDeactivateSource(TAudioSourceId sourceId)
+    {
+        // Deactivating waits for the render thread to let go of the source, which mustn't hold up the sound engine thread.
+        AZStd::lock_guard<AZStd::mutex> queueLock(m_deactivationQueueMutex);
+        m_queuedDeactivations.push_back(sourceId);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioSourceManager::ProcessQueuedDeactivations()
+    {
+        AZStd::vector<TAudioSourceId> queuedDeactivations;
+        {
+            AZStd::lock_guard<AZStd::mutex> queueLock(m_deactivationQueueMutex);
+            queuedDeactivations.swap(m_queuedDeactivations);
+        }
+
+        for (TAudioSourceId sourceId : queuedDeactivations)
+        {
+            DeactivateSource(FindPlayingSource(sourceId));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     void AudioSourceManager::DestroySource(TAudioSourceId sourceId)
     {
@@ -312,9 +360,119 @@ namespace Audio
         return AK_INVALID_PLAYING_ID;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioSourceManager::PublishActiveSources()
+    {
+        AZStd::unique_ptr<ActiveSourceSnapshot> snapshot;
+        if (!m_activeAudioInputs.empty())
+        {
+            snapshot = AZStd::make_unique<ActiveSourceSnapshot>();
+            snapshot->reserve(m_activeAudioInputs.size());
+            for (auto& inputPair : m_activeAudioInputs)
+            {
+                snapshot->emplace(inputPair.first, inputPair.second.get());
+            }
+        }
+
+        m_activeSnapshot.store(snapshot.get());
+
+        // Readers that registered in the current epoch may still hold the previous snapshot.
+        if (m_activeSnapshotOwner)
+        {
+            m_retiredSnapshots.emplace_back(m_readEpoch.load(), AZStd::move(m_activeSnapshotOwner));
+        }
+        m_activeSnapshotOwner = AZStd::move(snapshot);
+
+        ReclaimRetiredSnapshots();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    bool AudioSourceManager::ReclaimRetiredSnapshots()
+    {
+        // Readers only register in the current epoch, so the epoch can advance once the readers of the previous one
+        // (which share the counter of the next one) are done. A snapshot retired in epoch N is unreachable once the
+        // epoch reaches N + 2, as every reader that could have loaded it registered in epoch N or earlier.
+        const AZ::u64 epoch = m_readEpoch.load();
+        if (m_snapshotReaders[(epoch + 1) & 1].load() == 0)
+        {
+            m_readEpoch.store(epoch + 1);
+        }
+
+        const AZ::u64 currentEpoch = m_readEpoch.load();
+        AZStd::erase_if(m_retiredSnapshots,
+            [currentEpoch](const auto& retired)
+            {
+                return retired.first + 2 <= currentEpoch;
+            });
+
+        return m_retiredSnapshots.empty();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioSourceManager::WaitForSnapshotReaders()
+    {
+        // Readers only hold a snapshot for the duration of a single callback.
+        while (!ReclaimRetiredSnapshots())
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    AudioSourceManager::SnapshotReadScope::SnapshotReadScope(AudioSourceManager& manager)
+        : m_manager(manager)
+    {
+        // Register in the counter of the current epoch. If the epoch advanced meanwhile, the registration could have been
+        // missed by a writer checking that counter, so register again in the new epoch.
+        while (true)
+        {
+            m_epoch = m_manager.m_readEpoch.load();
+            m_manager.m_snapshotReaders[m_epoch & 1].fetch_add(1);
+            if (m_manager.m_readEpoch.load() == m_epoch)
+            {
+                break;
+            }
+            m_manager.m_snapshotReaders[m_epoch & 1].fetch_sub(1);
+        }
+
+        m_snapshot = m_manager.m_activeSnapshot.load();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    AudioSourceManager::SnapshotReadScope::~SnapshotReadScope()
+    {
+        m_manager.m_snapshotReaders[m_epoch & 1].fetch_sub(1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    AudioInputSource* AudioSourceManager::SnapshotReadScope::FindActiveSource(AkPlayingID playingId) const
+    {
+        if (m_snapshot)
+        {
+            if (auto inputIter = m_snapshot->find(playingId); inputIter != m_snapshot->end())
+            {
+                return inputIter->second;
+            }
+        }
+        return nullptr;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////
     // static
     void AudioSourceManager::ExecuteCallback(AkPlayingID playingId, AkAudioBuffer* akBuffer)
+    {
+        Get().WriteSourceOutput(playingId, akBuffer);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    // static
+    void AudioSourceManager::GetFormatCallback(AkPlayingID playingId, AkAudioFormat& audioFormat)
+    {
+        Get().GetSourceFormat(playingId, audioFormat);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////
+    void AudioSourceManager::WriteSourceOutput(AkPlayingID playingId, AkAudioBuffer* akBuffer)
     {
         if (!akBuffer->HasData())
         {
@@ -330,17 +488,12 @@ namespace Audio
             return;
         }
 
-        AZStd::lock_guard<AZStd::mutex> lock(Get().m_inputMutex);
+        SnapshotReadScope readScope(*this);
 
-        auto inputIter = Get().m_activeAudioInputs.find(playingId);
-        if (inputIter != Get().m_activeAudioInputs.end())
+        if (AudioInputSource* audioInput = readScope.FindActiveSource(playingId))
         {
-            auto& audioInput = inputIter->second;
-            if (audioInput)
-            {
-                // this will set the uValidFrames and eState for us.
-                audioInput->WriteOutput(akBuffer);
-            }
+            // this will set the uValidFrames and eState for us.
+            audioInput->WriteOutput(akBuffer);
         }
         else
         {
@@ -351,20 +504,14 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    // static
-    void AudioSourceManager::GetFormatCallback(AkPlayingID playingId, AkAudioFormat& audioFormat)
+    void AudioSourceManager::GetSourceFormat(AkPlayingID playingId, AkAudioFormat& audioFormat)
     {
-        AZStd::lock_guard<AZStd::mutex> lock(Get().m_inputMutex);
+        SnapshotReadScope readScope(*this);
 
-        auto inputIter = Get().m_activeAudioInputs.find(playingId);
-        if (inputIter != Get().m_activeAudioInputs.end())
+        if (AudioInputSource* audioInput = readScope.FindActiveSource(playingId))
         {
             // Set the AkAudioFormat from the AudioInputSource's SAudioInputConfig
-            auto& audioInput = inputIter->second;
-            if (audioInput)
-            {
-                audioInput->SetFormat(audioFormat);
-            }
+            audioInput->SetFormat(audioFormat);
         }
     }
 
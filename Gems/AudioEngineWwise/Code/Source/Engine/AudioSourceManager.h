@@ -12,7 +12,10 @@
                                  // As AK/SoundEngine/Common/AkTypes.h eventually includes Windows.h
 #include <IAudioInterfacesCommonData.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -65,6 +68,11 @@ namespace Audio
      *  (Running, callbacks being received, also async loading input if enabled)
      *  DeactivateSource (once it's determined to be done playing)
      * DestroySource (unloads resources)
+     *
+     * The Wwise callbacks run on the audio render thread and never take a lock. They look up the playing
+     * sources in a read-only snapshot of the active sources, which is replaced as a whole whenever a source
+     * is activated or deactivated. Replaced snapshots are reclaimed once no callback can still be reading
+     * them, which is tracked with a read epoch and one reader counter per epoch parity.
      */
     class AudioSourceManager
     {
@@ -99,6 +107,19 @@ namespace Audio
          */
         void DeactivateSource(AkPlayingID playingId);
 
+        /**
+         * Queue the deactivation of a source whose event has ended.
+         * This is called from the Wwise event callback on the sound engine thread, which must not wait for the sources
+         * to be unlocked, so the deactivation itself is left to ProcessQueuedDeactivations.
+         * @param sourceId Source ID of the source that ended.
+         */
+        void QueueDeactivateSource(TAudioSourceId sourceId);
+
+        /**
+         * Deactivate the sources queued by QueueDeactivateSource, this is called from the audio system thread.
+         */
+        void ProcessQueuedDeactivations();
+
         /**
          * Destroy an AudioInputSource.
          * Destroys an AudioInputSource from the manager when it is no longer needed.
@@ -113,6 +134,27 @@ namespace Audio
          */
         AkPlayingID FindPlayingSource(TAudioSourceId sourceId);
 
+    protected:
+        /**
+         * Store a newly created source in the inactive state.
+         * @param source The source to store, its source ID must be set.
+         */
+        void AddInactiveSource(AZStd::unique_ptr<AudioInputSource> source);
+
+        /**
+         * Feed the buffer of a playing source, this is called from the audio render thread.
+         * @param playingId The Playing ID of the source.
+         * @param audioBuffer The buffer to copy samples into.
+         */
+        void WriteSourceOutput(AkPlayingID playingId, AkAudioBuffer* audioBuffer);
+
+        /**
+         * Fill in the format of a playing source, this is called from the audio render thread.
+         * @param playingId The Playing ID of the source.
+         * @param audioFormat The format structure that should be filled with format information.
+         */
+        void GetSourceFormat(AkPlayingID playingId, AkAudioFormat& audioFormat);
+
     private:
         /**
          * Wwise Audio Input Plugin "Execute" callback function.
@@ -130,12 +172,60 @@ namespace Audio
          */
         static void GetFormatCallback(AkPlayingID playingId, AkAudioFormat& audioFormat);
 
-        AZStd::mutex m_inputMutex;      ///< Callbacks will come from the Wwise event processing thread.
+        using ActiveSourceSnapshot = AZStd::unordered_map<AkPlayingID, AudioInputSource*, AZStd::hash<AkPlayingID>, AZStd::equal_to<AkPlayingID>, Audio::AudioImplStdAllocator>;
+
+        /**
+         * Registers a reader of the active source snapshot for its lifetime.
+         * The snapshot, and the sources in it, stay valid until the scope ends.
+         */
+        class SnapshotReadScope
+        {
+        public:
+            explicit SnapshotReadScope(AudioSourceManager& manager);
+            ~SnapshotReadScope();
+
+            AudioInputSource* FindActiveSource(AkPlayingID playingId) const;
+
+        private:
+            AudioSourceManager& m_manager;
+            AZ::u64 m_epoch = 0;
+            const ActiveSourceSnapshot* m_snapshot = nullptr;
+        };
+
+        /**
+         * Replace the snapshot read by the callbacks with a copy of the active sources.
+         * Must be called with m_inputMutex held.
+         */
+        void PublishActiveSources();
+
+        /**
+         * Advance the read epoch if possible and free the snapshots no reader can hold anymore.
+         * Must be called with m_inputMutex held.
+         * @return True if all replaced snapshots have been freed.
+         */
+        bool ReclaimRetiredSnapshots();
+
+        /**
+         * Wait until no callback can be reading a replaced snapshot, or any source that was only in those snapshots.
+         * Must be called with m_inputMutex held.
+         */
+        void WaitForSnapshotReaders();
+
+        AZStd::mutex m_inputMutex;      ///< Serializes changes to the sources, which can come from the game and audio system threads.
+
+        AZStd::mutex m_deactivationQueueMutex;                  ///< Only held to add or take the queued deactivations.
+        AZStd::vector<TAudioSourceId> m_queuedDeactivations;    ///< Sources whose events ended, guarded by m_deactivationQueueMutex.
 
         template <typename KeyType, typename ValueType>
         using AudioInputMap = AZStd::unordered_map<KeyType, AZStd::unique_ptr<ValueType>, AZStd::hash<KeyType>, AZStd::equal_to<KeyType>, Audio::AudioImplStdAllocator>;
 
         AudioInputMap<TAudioSourceId, AudioInputSource> m_inactiveAudioInputs;      ///< Sources that haven't started playing yet.
-        AudioInputMap<AkPlayingID, AudioInputSource> m_activeAudioInputs;           ///< Sources that are currently playing.
+        AudioInputMap<AkPlayingID, AudioInputSource> m_activeAudioInputs;           ///< Sources that are currently playing, owned here.
+
+        AZStd::unique_ptr<ActiveSourceSnapshot> m_activeSnapshotOwner;                  ///< Owner of the snapshot being published.
+        AZStd::atomic<const ActiveSourceSnapshot*> m_activeSnapshot{ nullptr };        ///< Snapshot read by the callbacks, nullptr when empty.
+        AZStd::atomic<AZ::u64> m_readEpoch{ 0 };                                       ///< Epoch in which readers register.
+        AZStd::array<AZStd::atomic<AZ::u32>, 2> m_snapshotReaders{};                  ///< Callbacks reading a snapshot, per epoch parity.
+        AZStd::vector<AZStd::pair<AZ::u64, AZStd::unique_ptr<ActiveSourceSnapshot>>> m_retiredSnapshots; ///< Replaced snapshots with the epoch they were replaced in.
     };
 }
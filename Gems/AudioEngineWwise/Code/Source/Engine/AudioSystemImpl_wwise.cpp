@@ -128,8 +128,8 @@ namespace Audio
 
                 if (eventData->nSourceId != INVALID_AUDIO_SOURCE_ID)
                 {
-                    AkPlayingID playingId = AudioSourceManager::Get().FindPlayingSource(eventData->nSourceId);
-                    AudioSourceManager::Get().DeactivateSource(playingId);
+                    // Deactivated on the audio system thread by the next Update.
+                    AudioSourceManager::Get().QueueDeactivateSource(eventData->nSourceId);
                 }
             }
         }
@@ -372,6 +372,9 @@ namespace Audio
     {
         AZ_PROFILE_FUNCTION(Audio);
 
+        // Sources whose events ended on the sound engine thread since the last update.
+        AudioSourceManager::Get().ProcessQueuedDeactivations();
+
         if (AK::SoundEngine::IsInitialized())
         {
     #if !defined(WWISE_RELEASE)
@@ -8,14 +8,24 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzTest/AzTest.h>
+#include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/IO/LocalFileIO.h>
 #include <AzFramework/Application/Application.h>
+#include <AzTest/Utils.h>
 
+#include <AudioInput/AudioInputFile.h>
+#include <AudioInput/WavParser.h>
+#include <AudioSourceManager.h>
 #include <AudioSystemImpl_wwise.h>
 #include <AudioEngineWwise_Traits_Platform.h>
 #include <Config_wwise.h>
@@ -159,6 +169,378 @@ namespace UnitTest
     }
 
 
+    class CountingAudioInputSource
+        : public AudioInputSource
+    {
+    public:
+        CountingAudioInputSource(TAudioSourceId sourceId, AZStd::atomic<AZ::u32>& writesWhileInactive)
+            : m_writesWhileInactive(writesWhileInactive)
+        {
+            SetSourceId(sourceId);
+        }
+
+        void ReadInput([[maybe_unused]] const AudioStreamData& data) override {}
+
+        void WriteOutput(AkAudioBuffer* akBuffer) override
+        {
+            if (!m_active)
+            {
+                ++m_writesWhileInactive;
+            }
+            akBuffer->uValidFrames = akBuffer->MaxFrames();
+            akBuffer->eState = AK_DataReady;
+        }
+
+        bool IsOk() const override
+        {
+            return true;
+        }
+
+        void OnActivated() override
+        {
+            m_active = true;
+        }
+
+        void OnDeactivated() override
+        {
+            m_active = false;
+        }
+
+    private:
+        AZStd::atomic_bool m_active{ false };
+        AZStd::atomic<AZ::u32>& m_writesWhileInactive;
+    };
+
+    class AudioSourceManager_Test
+        : public AudioSourceManager
+    {
+    public:
+        using AudioSourceManager::AddInactiveSource;
+        using AudioSourceManager::WriteSourceOutput;
+    };
+
+    TEST(AudioSourceManagerTests, WriteSourceOutput_SourcesChurnedConcurrently_NoOutputAfterDeactivation)
+    {
+        constexpr AkPlayingID PlayingIdCount = 16;
+        constexpr AZ::u32 ChurnIterations = 2000;
+        constexpr AkUInt16 FrameCount = 64;
+
+        AudioSourceManager_Test manager;
+        AZStd::atomic<AZ::u32> writesWhileInactive{ 0 };
+        AZStd::atomic_bool stopRendering{ false };
+
+        // Fake render thread, feeding every playing id as the Wwise "Execute" callback would.
+        AZStd::thread renderThread(
+            [&]()
+            {
+                AZStd::vector<AkInt16> samples(FrameCount);
+                AkAudioBuffer akBuffer;
+                while (!stopRendering)
+                {
+                    for (AkPlayingID playingId = 1; playingId <= PlayingIdCount; ++playingId)
+                    {
+                        akBuffer.AttachInterleavedData(samples.data(), FrameCount, 0, AkChannelConfig(1, AK_SPEAKER_SETUP_MONO));
+                        akBuffer.eState = AK_DataNeeded;
+                        manager.WriteSourceOutput(playingId, &akBuffer);
+                    }
+                }
+            });
+
+        // Game thread, creating, activating, deactivating and destroying sources while they are being rendered.
+        for (AZ::u32 iteration = 0; iteration < ChurnIterations; ++iteration)
+        {
+            const TAudioSourceId sourceId = iteration + 1;
+            const AkPlayingID playingId = (iteration % PlayingIdCount) + 1;
+            manager.AddInactiveSource(AZStd::make_unique<CountingAudioInputSource>(sourceId, writesWhileInactive));
+            manager.ActivateSource(sourceId, playingId);
+            AZStd::this_thread::yield();
+            manager.DeactivateSource(playingId);
+            manager.DestroySource(sourceId);
+        }
+
+        stopRendering = true;
+        renderThread.join();
+        manager.Shutdown();
+
+        EXPECT_EQ(writesWhileInactive.load(), 0u);
+        EXPECT_EQ(manager.FindPlayingSource(1), AK_INVALID_PLAYING_ID);
+    }
+
+    TEST(AudioSourceManagerTests, QueueDeactivateSource_ManySourcesPlaying_NoOutputAfterDeactivation)
+    {
+        constexpr AkPlayingID PlayingIdCount = 64;
+        constexpr AZ::u32 ChurnRounds = 100;
+        constexpr AkUInt16 FrameCount = 64;
+
+        AudioSourceManager_Test manager;
+        AZStd::atomic<AZ::u32> writesWhileInactive{ 0 };
+        AZStd::atomic_bool stopRendering{ false };
+
+        // Fake render thread, feeding every playing id as the Wwise "Execute" callback would.
+        AZStd::thread renderThread(
+            [&]()
+            {
+                AZStd::vector<AkInt16> samples(FrameCount);
+                AkAudioBuffer akBuffer;
+                while (!stopRendering)
+                {
+                    for (AkPlayingID playingId = 1; playingId <= PlayingIdCount; ++playingId)
+                    {
+                        akBuffer.AttachInterleavedData(samples.data(), FrameCount, 0, AkChannelConfig(1, AK_SPEAKER_SETUP_MONO));
+                        akBuffer.eState = AK_DataNeeded;
+                        manager.WriteSourceOutput(playingId, &akBuffer);
+                    }
+                }
+            });
+
+        for (AZ::u32 round = 0; round < ChurnRounds; ++round)
+        {
+            // Every playing id has a source playing at once.
+            const TAudioSourceId firstSourceId = round * PlayingIdCount + 1;
+            for (AkPlayingID playingId = 1; playingId <= PlayingIdCount; ++playingId)
+            {
+                const TAudioSourceId sourceId = firstSourceId + playingId - 1;
+                manager.AddInactiveSource(AZStd::make_unique<CountingAudioInputSource>(sourceId, writesWhileInactive));
+                manager.ActivateSource(sourceId, playingId);
+            }
+
+            // Fake sound engine thread, ending the events of all sources as the Wwise event callback would,
+            // while this thread processes the queued deactivations as the audio system thread would.
+            AZStd::atomic_bool eventsEnded{ false };
+            AZStd::thread eventThread(
+                [&]()
+                {
+                    for (TAudioSourceId sourceId = firstSourceId; sourceId < firstSourceId + PlayingIdCount; ++sourceId)
+                    {
+                        manager.QueueDeactivateSource(sourceId);
+                    }
+                    eventsEnded = true;
+                });
+            while (!eventsEnded)
+            {
+                manager.ProcessQueuedDeactivations();
+            }
+            eventThread.join();
+            manager.ProcessQueuedDeactivations();
+
+            for (TAudioSourceId sourceId = firstSourceId; sourceId < firstSourceId + PlayingIdCount; ++sourceId)
+            {
+                EXPECT_EQ(manager.FindPlayingSource(sourceId), AK_INVALID_PLAYING_ID);
+                manager.DestroySource(sourceId);
+            }
+        }
+
+        stopRendering = true;
+        renderThread.join();
+        manager.Shutdown();
+
+        EXPECT_EQ(writesWhileInactive.load(), 0u);
+    }
+
+    class AudioInputFileTests
+        : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            // The application provides the AZ::IO::Streamer that streamed files are read with.
+            m_app.Start(AZ::ComponentApplication::Descriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            if (m_prevFileIO)
+            {
+                AZ::IO::FileIOBase::SetInstance(nullptr);
+            }
+            m_fileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetInstance(m_fileIO.get());
+        }
+
+        void TearDown() override
+        {
+            m_fileIO.reset();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            if (m_prevFileIO)
+            {
+                AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+                m_prevFileIO = nullptr;
+            }
+
+            m_app.Stop();
+        }
+
+        //! Write a 16-bit stereo wav file with a deterministic, non-repeating signal.
+        AZStd::string WriteWavFile(const char* fileName, AZ::u32 numFrames)
+        {
+            constexpr AZ::u16 NumChannels = 2;
+            constexpr AZ::u16 BitsPerSample = 16;
+            constexpr AZ::u32 SampleRate = 48000;
+
+            AZStd::vector<AZ::s16> samples(numFrames * NumChannels);
+            AZ::u32 state = 12345;
+            for (AZ::s16& sample : samples)
+            {
+                state = state * 1664525u + 1013904223u;
+                sample = static_cast<AZ::s16>(state >> 16);
+            }
+
+            const AZ::u32 dataSize = static_cast<AZ::u32>(samples.size() * sizeof(AZ::s16));
+            WavHeader header;
+            ::memcpy(header.riff.tag, "RIFF", 4);
+            header.riff.size = dataSize + WavHeader::MinSize - sizeof(ChunkHeader);
+            ::memcpy(header.wave, "WAVE", 4);
+            ::memcpy(header.fmt.header.tag, "fmt ", 4);
+            header.fmt.header.size = sizeof(FmtChunk) - sizeof(ChunkHeader);
+            header.fmt.audioFormat = 1;
+            header.fmt.numChannels = NumChannels;
+            header.fmt.sampleRate = SampleRate;
+            header.fmt.byteRate = SampleRate * NumChannels * (BitsPerSample >> 3);
+            header.fmt.blockAlign = NumChannels * (BitsPerSample >> 3);
+            header.fmt.bitsPerSample = BitsPerSample;
+            ::memcpy(header.data.tag, "data", 4);
+            header.data.size = dataSize;
+
+            const AZ::IO::Path filePath = AZ::IO::Path(m_tempDirectory.GetDirectory()) / fileName;
+            AZ::IO::SystemFile file;
+            file.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY);
+            file.Write(&header, sizeof(header));
+            file.Write(samples.data(), dataSize);
+            file.Close();
+
+            return filePath.String();
+        }
+
+        //! Copy all data of a file source, retrying while streamed data isn't ready yet.
+        static AZStd::vector<AZ::u8> CopyAllData(AudioInputFile& inputFile, size_t frameBytes, size_t expectedSize)
+        {
+            constexpr size_t FramesPerCopy = 1024;
+            AZStd::vector<AZ::u8> output;
+            AZStd::vector<AZ::u8> block(FramesPerCopy * frameBytes);
+            const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(30);
+            while (output.size() < expectedSize && AZStd::chrono::steady_clock::now() < timeout)
+            {
+                const size_t framesCopied = inputFile.CopyData(FramesPerCopy, block.data());
+                if (framesCopied == 0)
+                {
+                    AZStd::this_thread::yield();
+                    continue;
+                }
+                output.insert(output.end(), block.begin(), block.begin() + framesCopied * frameBytes);
+            }
+            return output;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_fileIO;
+
+    private:
+        AzFramework::Application m_app;
+        AZ::IO::FileIOBase* m_prevFileIO{ nullptr };
+    };
+
+    TEST_F(AudioInputFileTests, LargeWavFile_Streamed_BoundedBufferAndIdenticalOutput)
+    {
+        constexpr AZ::u32 NumFrames = 1024 * 1024;  // 4 MiB of 16-bit stereo data
+        constexpr size_t FrameBytes = 4;
+        constexpr size_t DataSize = NumFrames * FrameBytes;
+        constexpr size_t StreamRingSize = AudioInputFile::StreamChunkSize * AudioInputFile::StreamChunkCount;
+
+        SAudioInputConfig config;
+        config.m_sourceType = AudioInputSourceType::WavFile;
+        config.m_sourceFilename = WriteWavFile("large.wav", NumFrames);
+
+        // The file data is held in memory of the audio allocator, so its usage shows how much of the file is resident.
+        auto& audioAllocator = AZ::AllocatorInstance<AudioImplAllocator>::Get();
+
+        const size_t allocatedBeforeWholeFile = audioAllocator.NumAllocatedBytes();
+        AudioInputFile wholeFile(config, AZStd::numeric_limits<size_t>::max());
+        const size_t wholeFileAllocated = audioAllocator.NumAllocatedBytes() - allocatedBeforeWholeFile;
+        ASSERT_TRUE(wholeFile.IsOk());
+        EXPECT_FALSE(wholeFile.IsStreaming());
+        EXPECT_GE(wholeFileAllocated, DataSize);
+
+        const size_t allocatedBeforeStreamedFile = audioAllocator.NumAllocatedBytes();
+        AudioInputFile streamedFile(config);
+        const size_t streamedFileAllocated = audioAllocator.NumAllocatedBytes() - allocatedBeforeStreamedFile;
+        ASSERT_TRUE(streamedFile.IsOk());
+        EXPECT_TRUE(streamedFile.IsStreaming());
+
+        // Only the stream ring is allocated, with some slack for the parser and the refill worker.
+        constexpr size_t AllocationSlack = 16 * 1024;
+        EXPECT_LE(streamedFileAllocated, StreamRingSize + AllocationSlack);
+
+        const AZStd::vector<AZ::u8> wholeFileOutput = CopyAllData(wholeFile, FrameBytes, DataSize);
+        const AZStd::vector<AZ::u8> streamedOutput = CopyAllData(streamedFile, FrameBytes, DataSize);
+
+        // The stream ring never grows while the data is consumed.
+        EXPECT_LE(audioAllocator.NumAllocatedBytes() - allocatedBeforeStreamedFile, StreamRingSize + AllocationSlack);
+
+        ASSERT_EQ(wholeFileOutput.size(), DataSize);
+        ASSERT_EQ(streamedOutput.size(), DataSize);
+        EXPECT_TRUE(wholeFileOutput == streamedOutput);
+
+        // Nothing is left to copy past the end of the data.
+        AZ::u8 extraFrame[FrameBytes];
+        EXPECT_EQ(streamedFile.CopyData(1, extraFrame), 0u);
+    }
+
+    TEST_F(AudioInputFileTests, LargeWavFile_ChunkStillLoading_NoDataReady)
+    {
+        constexpr AZ::u32 NumFrames = 1024 * 1024;
+        constexpr AZ::u16 FramesPerBuffer = 512;
+        constexpr AZ::u16 NumChannels = 2;
+
+        SAudioInputConfig config;
+        config.m_sourceType = AudioInputSourceType::WavFile;
+        config.m_sourceFilename = WriteWavFile("underrun.wav", NumFrames);
+
+        // Hold back the stream reads, so that the chunks stay in flight until processing resumes.
+        auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        ASSERT_NE(streamer, nullptr);
+        streamer->SuspendProcessing();
+
+        AudioInputFile streamedFile(config);
+        ASSERT_TRUE(streamedFile.IsOk());
+        ASSERT_TRUE(streamedFile.IsStreaming());
+
+        AZStd::vector<AZ::s16> samples(FramesPerBuffer * NumChannels);
+        AkAudioBuffer akBuffer;
+        akBuffer.AttachInterleavedData(samples.data(), FramesPerBuffer, 0, AkChannelConfig(NumChannels, AK_SPEAKER_SETUP_STEREO));
+        akBuffer.eState = AK_DataNeeded;
+        streamedFile.WriteOutput(&akBuffer);
+
+        // An underrun isn't the end of the data, the voice keeps asking for more.
+        EXPECT_EQ(akBuffer.eState, AK_NoDataReady);
+        EXPECT_EQ(akBuffer.uValidFrames, 0u);
+
+        streamer->ResumeProcessing();
+
+        const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(30);
+        do
+        {
+            AZStd::this_thread::yield();
+            akBuffer.eState = AK_DataNeeded;
+            streamedFile.WriteOutput(&akBuffer);
+        } while (akBuffer.eState == AK_NoDataReady && AZStd::chrono::steady_clock::now() < timeout);
+
+        EXPECT_EQ(akBuffer.eState, AK_DataReady);
+        EXPECT_EQ(akBuffer.uValidFrames, FramesPerBuffer);
+    }
+
+    TEST_F(AudioInputFileTests, SmallWavFile_LoadedAtOnce)
+    {
+        constexpr AZ::u32 NumFrames = 1024;
+
+        SAudioInputConfig config;
+        config.m_sourceType = AudioInputSourceType::WavFile;
+        config.m_sourceFilename = WriteWavFile("small.wav", NumFrames);
+
+        AudioInputFile inputFile(config);
+        ASSERT_TRUE(inputFile.IsOk());
+        EXPECT_FALSE(inputFile.IsStreaming());
+        EXPECT_EQ(inputFile.GetBufferSize(), NumFrames * 4u);
+    }
+
     class AudioSystemImpl_wwise_Test
         : public CAudioSystemImpl_wwise
     {
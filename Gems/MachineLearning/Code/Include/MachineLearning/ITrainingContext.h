@@ -12,10 +12,32 @@
 
 namespace MachineLearning
 {
+    //! Controls how accumulated gradients are applied to model parameters during gradient descent.
+    struct OptimizerParameters
+    {
+        OptimizerTypes m_optimizer = OptimizerTypes::Sgd;
+
+        //! Velocity decay used by the Momentum and Nesterov optimizers.
+        float m_momentum = 0.9f;
+
+        //! Exponential decay rates for the first and second moment estimates used by the Adam and AdamW optimizers.
+        float m_beta1 = 0.9f;
+        float m_beta2 = 0.999f;
+
+        //! Added to the second moment estimate to avoid division by zero in the Adam and AdamW optimizers.
+        float m_epsilon = 1.0e-8f;
+
+        //! Decoupled weight decay used by the AdamW optimizer, this is scaled by the learning rate and only applied to weights.
+        float m_weightDecay = 0.01f;
+    };
+
     //! This is a heavier weight context suitable for backpropagation and training of models.
+    //! Any optimizer state, such as moment estimates, is owned by the training context rather than the model.
     struct ITrainingContext
     {
         virtual ~ITrainingContext() = default;
+
+        OptimizerParameters m_optimizerParameters;
     };
 
     using ITrainingContextPtr = ITrainingContext*;
@@ -14,7 +14,8 @@
 namespace MachineLearning
 {
     AZ_ENUM_CLASS(LossFunctions,
-        MeanSquaredError
+        MeanSquaredError,
+        CrossEntropy
     );
 
     AZ_ENUM_CLASS(ActivationFunctions,
@@ -24,6 +25,14 @@ namespace MachineLearning
         Linear
     );
 
+    AZ_ENUM_CLASS(OptimizerTypes,
+        Sgd,
+        Momentum,
+        Nesterov,
+        Adam,
+        AdamW
+    );
+
     AZ_ENUM_CLASS(AssetTypes,
         TestData,
         TestLabels,
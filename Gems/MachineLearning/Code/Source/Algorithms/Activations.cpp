@@ -46,6 +46,39 @@ namespace MachineLearning
         return maxIndex;
     }
 
+    AZ::Simd::Vec4::FloatType ExpApproximate(AZ::Simd::Vec4::FloatArgType value)
+    {
+        // Range reduction, exp(x) = 2^n * exp(r) where n = round(x / ln(2)) and |r| <= ln(2) / 2
+        // ln(2) is split into a high and low part (Cody-Waite) so that r is computed without significant cancellation error
+        const AZ::Simd::Vec4::FloatType x = AZ::Simd::Vec4::Min(AZ::Simd::Vec4::Max(value, AZ::Simd::Vec4::Splat(-87.3f)), AZ::Simd::Vec4::Splat(88.3f));
+        const AZ::Simd::Vec4::FloatType n = AZ::Simd::Vec4::Floor(AZ::Simd::Vec4::Madd(x, AZ::Simd::Vec4::Splat(1.44269504088896341f), AZ::Simd::Vec4::Splat(0.5f)));
+        AZ::Simd::Vec4::FloatType r = AZ::Simd::Vec4::Sub(x, AZ::Simd::Vec4::Mul(n, AZ::Simd::Vec4::Splat(0.693359375f)));
+        r = AZ::Simd::Vec4::Sub(r, AZ::Simd::Vec4::Mul(n, AZ::Simd::Vec4::Splat(-2.12194440e-4f)));
+
+        // Minimax polynomial approximation of exp(r) on [-ln(2) / 2, ln(2) / 2], the coefficients are from the Cephes math library
+        AZ::Simd::Vec4::FloatType polynomial = AZ::Simd::Vec4::Splat(1.9875691500e-4f);
+        polynomial = AZ::Simd::Vec4::Madd(polynomial, r, AZ::Simd::Vec4::Splat(1.3981999507e-3f));
+        polynomial = AZ::Simd::Vec4::Madd(polynomial, r, AZ::Simd::Vec4::Splat(8.3334519073e-3f));
+        polynomial = AZ::Simd::Vec4::Madd(polynomial, r, AZ::Simd::Vec4::Splat(4.1665795894e-2f));
+        polynomial = AZ::Simd::Vec4::Madd(polynomial, r, AZ::Simd::Vec4::Splat(1.6666665459e-1f));
+        polynomial = AZ::Simd::Vec4::Madd(polynomial, r, AZ::Simd::Vec4::Splat(5.0000001201e-1f));
+        polynomial = AZ::Simd::Vec4::Add(AZ::Simd::Vec4::Madd(polynomial, AZ::Simd::Vec4::Mul(r, r), r), AZ::Simd::Vec4::Splat(1.0f));
+
+        // Construct 2^n directly by writing (n + 127) into the exponent bits of a float
+        // The clamp above guarantees n lies within [-126, 127], so the biased exponent is always a valid normal exponent
+        // (n + 127) * 2^23 is computed in floating point, where it is exactly representable, to avoid relying on integer shifts
+        const AZ::Simd::Vec4::FloatType biasedExponent = AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Add(n, AZ::Simd::Vec4::Splat(127.0f)), AZ::Simd::Vec4::Splat(8388608.0f));
+        const AZ::Simd::Vec4::FloatType powerOfTwo = AZ::Simd::Vec4::CastToFloat(AZ::Simd::Vec4::ConvertToInt(biasedExponent));
+        return AZ::Simd::Vec4::Mul(polynomial, powerOfTwo);
+    }
+
+    AZ::Simd::Vec4::FloatType SigmoidApproximate(AZ::Simd::Vec4::FloatArgType value)
+    {
+        const AZ::Simd::Vec4::FloatType one = AZ::Simd::Vec4::Splat(1.0f);
+        const AZ::Simd::Vec4::FloatType negated = AZ::Simd::Vec4::Sub(AZ::Simd::Vec4::ZeroFloat(), value);
+        return AZ::Simd::Vec4::Div(one, AZ::Simd::Vec4::Add(one, ExpApproximate(negated)));
+    }
+
     void Activate(ActivationFunctions activationFunction, const AZ::VectorN& sourceVector, AZ::VectorN& output)
     {
         output.Resize(sourceVector.GetDimensionality());
@@ -83,57 +116,73 @@ namespace MachineLearning
 
     void Sigmoid(const AZ::VectorN& sourceVector, AZ::VectorN& output)
     {
-        const AZ::Vector4 vecZero = AZ::Vector4::CreateZero();
-        const AZ::Vector4 vecOne = AZ::Vector4::CreateOne();
-        const AZ::Vector4 epsilon = AZ::Vector4(AZ::Constants::Tolerance);
         const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
         output.Resize(sourceVector.GetDimensionality());
         for (AZStd::size_t iter = 0; iter < numElements; ++iter)
         {
             const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
             AZ::Vector4& outputElement = output.GetVectorValues()[iter];
-            const AZ::Vector4 divisor = (vecOne + (-sourceElement).GetExpEstimate()).GetMax(epsilon);
-            outputElement = vecOne / divisor;
-            outputElement = outputElement.GetClamp(vecZero, vecOne);
+            outputElement.SetSimdValue(SigmoidApproximate(sourceElement.GetSimdValue()));
         }
         output.FixLastVectorElement();
     }
 
     void Softmax(const AZ::VectorN& sourceVector, AZ::VectorN& output)
     {
-        const AZ::Vector4 vecZero = AZ::Vector4::CreateZero();
-        const AZ::Vector4 vecOne = AZ::Vector4::CreateOne();
-
         // Naive softmax is simply softmax(source) = exp(source) / sum(exp(source))
         // Here we apply the exp-normalization trick to avoid exp overflow
         // x = max(source)
         // y = exp(source - x)
         // softmax(source) = y / sum(y)
+        const AZStd::size_t dimensionality = sourceVector.GetDimensionality();
         const AZStd::size_t numElements = sourceVector.GetVectorValues().size();
-        output.Resize(sourceVector.GetDimensionality());
+        output.Resize(dimensionality);
+        if (dimensionality == 0)
+        {
+            return;
+        }
 
-        AZ::Vector4 max = sourceVector.GetVectorValues()[0];
-        for (AZStd::size_t iter = 1; iter < numElements; ++iter)
+        // The unused elements of the last vector are zero, so they must be excluded when computing the maximum
+        const AZStd::size_t fullElements = dimensionality / 4;
+        float max = sourceVector.GetElement(0);
+        if (fullElements > 0)
+        {
+            AZ::Simd::Vec4::FloatType maxValues = sourceVector.GetVectorValues()[0].GetSimdValue();
+            for (AZStd::size_t iter = 1; iter < fullElements; ++iter)
+            {
+                maxValues = AZ::Simd::Vec4::Max(maxValues, sourceVector.GetVectorValues()[iter].GetSimdValue());
+            }
+            const AZ::Vector4 maxVector(maxValues);
+            max = AZ::GetMax(AZ::GetMax(maxVector.GetX(), maxVector.GetY()), AZ::GetMax(maxVector.GetZ(), maxVector.GetW()));
+        }
+        for (AZStd::size_t iter = fullElements * 4; iter < dimensionality; ++iter)
         {
-            max.GetMax(sourceVector.GetVectorValues()[iter]);
+            max = AZ::GetMax(max, sourceVector.GetElement(iter));
         }
 
-        AZ::Vector4 partialSum = vecZero;
+        const AZ::Simd::Vec4::FloatType maxValue = AZ::Simd::Vec4::Splat(max);
         for (AZStd::size_t iter = 0; iter < numElements; ++iter)
         {
             const AZ::Vector4& sourceElement = sourceVector.GetVectorValues()[iter];
             AZ::Vector4& outputElement = output.GetVectorValues()[iter];
-            outputElement = (sourceElement - max).GetExpEstimate();
-            outputElement = outputElement.GetClamp(vecZero, vecOne);
-            partialSum += outputElement;
+            outputElement.SetSimdValue(ExpApproximate(AZ::Simd::Vec4::Sub(sourceElement.GetSimdValue(), maxValue)));
+        }
+
+        // Zero the unused elements of the last vector before summing, so that they don't contribute exp(0 - max)
+        output.FixLastVectorElement();
+        AZ::Simd::Vec4::FloatType partialSum = AZ::Simd::Vec4::ZeroFloat();
+        for (const AZ::Vector4& element : output.GetVectorValues())
+        {
+            partialSum = AZ::Simd::Vec4::Add(partialSum, element.GetSimdValue());
         }
+        const float sum = AZ::Vector4(partialSum).Dot(AZ::Vector4::CreateOne());
 
-        const float divisor = AZ::GetMax(1.0f / partialSum.Dot(vecOne), AZ::Constants::Tolerance);
+        // The maximum element always contributes exp(0) = 1 to the sum, so the divisor can never be zero
+        const AZ::Simd::Vec4::FloatType divisor = AZ::Simd::Vec4::Splat(1.0f / sum);
         for (AZ::Vector4& element : output.GetVectorValues())
         {
-            element = element * divisor;
+            element.SetSimdValue(AZ::Simd::Vec4::Mul(element.GetSimdValue(), divisor));
         }
-        output.FixLastVectorElement();
     }
 
     void Linear(const AZ::VectorN& sourceVector, AZ::VectorN& output)
@@ -199,19 +248,29 @@ namespace MachineLearning
 
     void Softmax_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
     {
-        // Note that this is completely unvectorized
+        // The full softmax Jacobian is J(i, j) = y(i) * (delta(i, j) - y(j)), so the product with the back-propagated gradients reduces to
+        // output(i) = y(i) * (g(i) - sum(y(j) * g(j)))
+        // This avoids ever forming the Jacobian, making this linear rather than quadratic in the layer size
+        const AZStd::size_t numElements = activationOutput.GetVectorValues().size();
         output.Resize(activationOutput.GetDimensionality());
-        for (AZStd::size_t i = 0; i < activationOutput.GetDimensionality(); ++i)
+
+        AZ::Simd::Vec4::FloatType partialSum = AZ::Simd::Vec4::ZeroFloat();
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
         {
-            float gradient = 0.0f;
-            for (AZStd::size_t j = 0; j < activationOutput.GetDimensionality(); ++j)
-            {
-                const float ithElement = activationOutput.GetElement(i);
-                const float jthElement = activationOutput.GetElement(j) * backGradients.GetElement(j);
-                gradient += (i == j) ? (1.0f - ithElement) * jthElement : -ithElement * jthElement;
-            }
-            output.SetElement(i, gradient);
+            const AZ::Simd::Vec4::FloatType activationElement = activationOutput.GetVectorValues()[iter].GetSimdValue();
+            const AZ::Simd::Vec4::FloatType backGradientElement = backGradients.GetVectorValues()[iter].GetSimdValue();
+            partialSum = AZ::Simd::Vec4::Madd(activationElement, backGradientElement, partialSum);
+        }
+
+        const AZ::Simd::Vec4::FloatType dotProduct = AZ::Simd::Vec4::Splat(AZ::Vector4(partialSum).Dot(AZ::Vector4::CreateOne()));
+        for (AZStd::size_t iter = 0; iter < numElements; ++iter)
+        {
+            const AZ::Simd::Vec4::FloatType activationElement = activationOutput.GetVectorValues()[iter].GetSimdValue();
+            const AZ::Simd::Vec4::FloatType backGradientElement = backGradients.GetVectorValues()[iter].GetSimdValue();
+            AZ::Vector4& outputElement = output.GetVectorValues()[iter];
+            outputElement.SetSimdValue(AZ::Simd::Vec4::Mul(activationElement, AZ::Simd::Vec4::Sub(backGradientElement, dotProduct)));
         }
+        output.FixLastVectorElement();
     }
 
     void Linear_Derivative([[maybe_unused]] const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output)
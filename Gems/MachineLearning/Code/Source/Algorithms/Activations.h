@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Math/VectorN.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <MachineLearning/INeuralNetwork.h>
 
@@ -23,6 +24,15 @@ namespace MachineLearning
     //! Reverses one-hot encoding, returns the index of the element with the largest value.
     AZStd::size_t ArgMaxDecode(const AZ::VectorN& vector);
 
+    //! Computes a polynomial approximation of exp(x) for each element of the source value.
+    //! Inputs are clamped to the range [-87.3, 88.3] so the result never overflows to infinity.
+    //! Within that range the maximum relative error against a double precision exp is below 2.0e-7, or roughly two ulp.
+    AZ::Simd::Vec4::FloatType ExpApproximate(AZ::Simd::Vec4::FloatArgType value);
+
+    //! Computes 1 / (1 + exp(-x)) for each element of the source value using ExpApproximate.
+    //! The maximum absolute error against a double precision sigmoid is below 2.0e-7 for all finite inputs.
+    AZ::Simd::Vec4::FloatType SigmoidApproximate(AZ::Simd::Vec4::FloatArgType value);
+
     //! Computes the requested activation function applied to all elements of the source vector.
     void Activate(ActivationFunctions activationFunction, const AZ::VectorN& sourceVector, AZ::VectorN& output);
 
@@ -48,7 +58,7 @@ namespace MachineLearning
     //! Computes the derivative of the sigmoid activation function applied to all elements of the original source vector.
     void Sigmoid_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
 
-    //! Computes the derivative of the sigmoid activation function applied to all elements of the original source vector.
+    //! Computes the derivative of the softmax activation function applied to all elements of the original source vector.
     void Softmax_Derivative(const AZ::VectorN& activationOutput, const AZ::VectorN& backGradients, AZ::VectorN& output);
 
     //! Computes the derivative linear activation function applied to all elements of the original source vector.
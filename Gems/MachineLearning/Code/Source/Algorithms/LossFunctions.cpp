@@ -7,20 +7,43 @@
  */
 
 #include <Algorithms/LossFunctions.h>
+#include <Algorithms/Activations.h>
 #include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/math.h>
 
 namespace MachineLearning
 {
+    //! Guards against log(0) for probabilities that have saturated to zero.
+    static constexpr float MinimumProbability = 1.0e-7f;
+
     float ComputeTotalCost(LossFunctions lossFunction, const AZ::VectorN& expected, const AZ::VectorN& actual)
     {
-        AZ::VectorN costs;
-        ComputeLoss(lossFunction, expected, actual, costs);
-        AZ::Vector4 accumulator = AZ::Vector4::CreateZero();
-        for (const AZ::Vector4& element : costs.GetVectorValues())
+        AZ_Assert(expected.GetDimensionality() == actual.GetDimensionality(), "The dimensionality of expected and actual must match");
+
+        // This is computed directly rather than through ComputeLoss so that no temporary vectors are required
+        switch (lossFunction)
         {
-            accumulator += element;
+        case LossFunctions::MeanSquaredError:
+            {
+                AZ::Simd::Vec4::FloatType accumulator = AZ::Simd::Vec4::ZeroFloat();
+                for (AZStd::size_t iter = 0; iter < actual.GetVectorValues().size(); ++iter)
+                {
+                    const AZ::Simd::Vec4::FloatType difference = AZ::Simd::Vec4::Sub(actual.GetVectorValues()[iter].GetSimdValue(), expected.GetVectorValues()[iter].GetSimdValue());
+                    accumulator = AZ::Simd::Vec4::Madd(difference, difference, accumulator);
+                }
+                return AZ::Vector4(accumulator).Dot(AZ::Vector4::CreateOne());
+            }
+        case LossFunctions::CrossEntropy:
+            {
+                float accumulator = 0.0f;
+                for (AZStd::size_t iter = 0; iter < actual.GetDimensionality(); ++iter)
+                {
+                    accumulator -= expected.GetElement(iter) * AZStd::log(AZ::GetMax(actual.GetElement(iter), MinimumProbability));
+                }
+                return accumulator;
+            }
         }
-        return accumulator.Dot(AZ::Vector4::CreateOne());
+        return 0.0f;
     }
 
     void ComputeLoss(LossFunctions costFunction, const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
@@ -32,12 +55,29 @@ namespace MachineLearning
         case LossFunctions::MeanSquaredError:
             MeanSquaredError(expected, actual, output);
             break;
+        case LossFunctions::CrossEntropy:
+            CrossEntropy(expected, actual, output);
+            break;
         }
     }
 
     void MeanSquaredError(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
     {
-        output = (actual - expected).GetSquare();
+        output.Resize(actual.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < actual.GetVectorValues().size(); ++iter)
+        {
+            const AZ::Simd::Vec4::FloatType difference = AZ::Simd::Vec4::Sub(actual.GetVectorValues()[iter].GetSimdValue(), expected.GetVectorValues()[iter].GetSimdValue());
+            output.GetVectorValues()[iter].SetSimdValue(AZ::Simd::Vec4::Mul(difference, difference));
+        }
+    }
+
+    void CrossEntropy(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
+    {
+        output.Resize(actual.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < actual.GetDimensionality(); ++iter)
+        {
+            output.SetElement(iter, -expected.GetElement(iter) * AZStd::log(AZ::GetMax(actual.GetElement(iter), MinimumProbability)));
+        }
     }
 
     void ComputeLoss_Derivative(LossFunctions costFunction, const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
@@ -49,11 +89,64 @@ namespace MachineLearning
         case LossFunctions::MeanSquaredError:
             MeanSquaredError_Derivative(expected, actual, output);
             break;
+        case LossFunctions::CrossEntropy:
+            CrossEntropy_Derivative(expected, actual, output);
+            break;
         }
     }
 
     void MeanSquaredError_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
     {
-        output = (expected - actual);
+        output.Resize(actual.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < actual.GetVectorValues().size(); ++iter)
+        {
+            output.GetVectorValues()[iter].SetSimdValue(AZ::Simd::Vec4::Sub(actual.GetVectorValues()[iter].GetSimdValue(), expected.GetVectorValues()[iter].GetSimdValue()));
+        }
+    }
+
+    void CrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output)
+    {
+        output.Resize(actual.GetDimensionality());
+        for (AZStd::size_t iter = 0; iter < actual.GetDimensionality(); ++iter)
+        {
+            output.SetElement(iter, -expected.GetElement(iter) / AZ::GetMax(actual.GetElement(iter), MinimumProbability));
+        }
+    }
+
+    bool HasFusedLoss_Derivative(ActivationFunctions activationFunction, LossFunctions lossFunction)
+    {
+        return (activationFunction == ActivationFunctions::Softmax) && (lossFunction == LossFunctions::CrossEntropy);
+    }
+
+    float SoftmaxCrossEntropy(const AZ::VectorN& expected, const AZ::VectorN& logits, AZ::VectorN& softmaxOutput)
+    {
+        AZ_Assert(expected.GetDimensionality() == logits.GetDimensionality(), "The dimensionality of expected and logits must match");
+        Softmax(logits, softmaxOutput);
+
+        // log(softmax(x)_i) = x_i - max - log(sum(exp(x - max))), where the sum is recovered from the largest softmax output
+        // Since exp(max - max) = 1, the largest softmax output is exactly 1 / sum
+        float max = logits.GetElement(0);
+        float maxProbability = softmaxOutput.GetElement(0);
+        for (AZStd::size_t iter = 1; iter < logits.GetDimensionality(); ++iter)
+        {
+            if (logits.GetElement(iter) > max)
+            {
+                max = logits.GetElement(iter);
+                maxProbability = softmaxOutput.GetElement(iter);
+            }
+        }
+        const float logSum = -AZStd::log(maxProbability);
+
+        float loss = 0.0f;
+        for (AZStd::size_t iter = 0; iter < logits.GetDimensionality(); ++iter)
+        {
+            loss -= expected.GetElement(iter) * (logits.GetElement(iter) - max - logSum);
+        }
+        return loss;
+    }
+
+    void SoftmaxCrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& softmaxOutput, AZ::VectorN& output)
+    {
+        MeanSquaredError_Derivative(expected, softmaxOutput, output);
     }
 }
@@ -19,12 +19,29 @@ namespace MachineLearning
     //! Computes the gradient of the loss using across all elements of the source vectors using the requested cost function.
     void ComputeLoss(LossFunctions lossFunction, const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 
-    //! Computes the derivative of the rectified linear unit function (ReLU) applied to all elements of the source vector.
+    //! Computes the squared error between each element of the expected and actual vectors.
     void MeanSquaredError(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 
+    //! Computes the cross-entropy between each element of the expected and actual vectors, actual is expected to be a probability distribution.
+    void CrossEntropy(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
+
     //! Computes the gradient of the loss using across all elements of the source vectors using the requested cost function.
     void ComputeLoss_Derivative(LossFunctions lossFunction, const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
 
-    //! Computes the derivative of the rectified linear unit function (ReLU) applied to all elements of the source vector.
+    //! Computes the derivative of the squared error with respect to each element of the actual vector.
     void MeanSquaredError_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
+
+    //! Computes the derivative of the cross-entropy with respect to each element of the actual vector.
+    void CrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& actual, AZ::VectorN& output);
+
+    //! Returns true if the requested activation function and loss function have a fused derivative implementation.
+    bool HasFusedLoss_Derivative(ActivationFunctions activationFunction, LossFunctions lossFunction);
+
+    //! Computes softmax(logits) into softmaxOutput and returns the cross-entropy loss against the expected vector in a single pass.
+    //! The loss is computed from the log-sum-exp of the logits rather than the log of the softmax output, so it remains finite for saturated outputs.
+    float SoftmaxCrossEntropy(const AZ::VectorN& expected, const AZ::VectorN& logits, AZ::VectorN& softmaxOutput);
+
+    //! Computes the derivative of the cross-entropy loss with respect to the inputs of a softmax activation.
+    //! The softmax Jacobian and the cross-entropy derivative cancel, leaving simply (softmaxOutput - expected).
+    void SoftmaxCrossEntropy_Derivative(const AZ::VectorN& expected, const AZ::VectorN& softmaxOutput, AZ::VectorN& output);
 }
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Algorithms/Optimizers.h>
+#include <AzCore/std/math.h>
+
+namespace MachineLearning
+{
+    bool UsesFirstMoment(OptimizerTypes optimizer)
+    {
+        return optimizer != OptimizerTypes::Sgd;
+    }
+
+    bool UsesSecondMoment(OptimizerTypes optimizer)
+    {
+        return (optimizer == OptimizerTypes::Adam) || (optimizer == OptimizerTypes::AdamW);
+    }
+
+    OptimizerStepConstants::OptimizerStepConstants(const OptimizerParameters& parameters, AZStd::size_t step, float learningRate, bool applyWeightDecay)
+    {
+        float stepLearningRate = learningRate;
+        float stepEpsilon = parameters.m_epsilon;
+        if (UsesSecondMoment(parameters.m_optimizer))
+        {
+            // Adam bias correction, lr * mhat / (sqrt(vhat) + eps) is rewritten as lr' * m / (sqrt(v) + eps')
+            // where lr' = lr * sqrt(1 - b2^t) / (1 - b1^t) and eps' = eps * sqrt(1 - b2^t), which avoids two divisions per parameter
+            const double exponent = static_cast<double>(AZ::GetMax<AZStd::size_t>(step, 1));
+            const double beta1Correction = 1.0 - AZStd::pow(static_cast<double>(parameters.m_beta1), exponent);
+            const double beta2Correction = AZStd::sqrt(1.0 - AZStd::pow(static_cast<double>(parameters.m_beta2), exponent));
+            stepLearningRate = static_cast<float>(static_cast<double>(learningRate) * beta2Correction / beta1Correction);
+            stepEpsilon = static_cast<float>(static_cast<double>(parameters.m_epsilon) * beta2Correction);
+        }
+
+        m_learningRate = AZ::Simd::Vec4::Splat(stepLearningRate);
+        m_momentum = AZ::Simd::Vec4::Splat(parameters.m_momentum);
+        m_beta1 = AZ::Simd::Vec4::Splat(parameters.m_beta1);
+        m_oneMinusBeta1 = AZ::Simd::Vec4::Splat(1.0f - parameters.m_beta1);
+        m_beta2 = AZ::Simd::Vec4::Splat(parameters.m_beta2);
+        m_oneMinusBeta2 = AZ::Simd::Vec4::Splat(1.0f - parameters.m_beta2);
+        m_epsilon = AZ::Simd::Vec4::Splat(stepEpsilon);
+        m_weightDecay = AZ::Simd::Vec4::Splat(applyWeightDecay ? learningRate * parameters.m_weightDecay : 0.0f);
+    }
+}
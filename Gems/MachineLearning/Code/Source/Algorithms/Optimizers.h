@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdMath.h>
+#include <MachineLearning/ITrainingContext.h>
+
+namespace MachineLearning
+{
+    //! Returns true if the requested optimizer maintains a first moment (velocity) estimate for each parameter.
+    bool UsesFirstMoment(OptimizerTypes optimizer);
+
+    //! Returns true if the requested optimizer maintains a second moment estimate for each parameter.
+    bool UsesSecondMoment(OptimizerTypes optimizer);
+
+    //! The per-step constants required by OptimizerStep, these are computed once per gradient descent step and splatted for SIMD use.
+    struct OptimizerStepConstants
+    {
+        //! @param parameters the optimizer hyperparameters
+        //! @param step the one-based index of the current gradient descent step, used for Adam bias correction
+        //! @param learningRate the learning rate to use for this step
+        //! @param applyWeightDecay true if decoupled weight decay should be applied, this is generally true for weights and false for biases
+        OptimizerStepConstants(const OptimizerParameters& parameters, AZStd::size_t step, float learningRate, bool applyWeightDecay);
+
+        AZ::Simd::Vec4::FloatType m_learningRate;
+        AZ::Simd::Vec4::FloatType m_momentum;
+        AZ::Simd::Vec4::FloatType m_beta1;
+        AZ::Simd::Vec4::FloatType m_oneMinusBeta1;
+        AZ::Simd::Vec4::FloatType m_beta2;
+        AZ::Simd::Vec4::FloatType m_oneMinusBeta2;
+        AZ::Simd::Vec4::FloatType m_epsilon;
+        AZ::Simd::Vec4::FloatType m_weightDecay;
+    };
+
+    //! Computes a single optimizer update for four parameters, returning the updated parameter values.
+    //! The moment estimates are updated in place, optimizers that do not use them leave them untouched.
+    template <OptimizerTypes Optimizer>
+    AZ_FORCE_INLINE AZ::Simd::Vec4::FloatType OptimizerStep
+    (
+        const OptimizerStepConstants& constants,
+        AZ::Simd::Vec4::FloatArgType parameter,
+        AZ::Simd::Vec4::FloatArgType gradient,
+        AZ::Simd::Vec4::FloatType& moment,
+        AZ::Simd::Vec4::FloatType& secondMoment
+    )
+    {
+        if constexpr (Optimizer == OptimizerTypes::Sgd)
+        {
+            // p = p - lr * g
+            return AZ::Simd::Vec4::Sub(parameter, AZ::Simd::Vec4::Mul(gradient, constants.m_learningRate));
+        }
+        else if constexpr (Optimizer == OptimizerTypes::Momentum)
+        {
+            // v = mu * v + g, p = p - lr * v
+            moment = AZ::Simd::Vec4::Madd(moment, constants.m_momentum, gradient);
+            return AZ::Simd::Vec4::Sub(parameter, AZ::Simd::Vec4::Mul(moment, constants.m_learningRate));
+        }
+        else if constexpr (Optimizer == OptimizerTypes::Nesterov)
+        {
+            // v = mu * v + g, p = p - lr * (g + mu * v)
+            moment = AZ::Simd::Vec4::Madd(moment, constants.m_momentum, gradient);
+            const AZ::Simd::Vec4::FloatType lookahead = AZ::Simd::Vec4::Madd(moment, constants.m_momentum, gradient);
+            return AZ::Simd::Vec4::Sub(parameter, AZ::Simd::Vec4::Mul(lookahead, constants.m_learningRate));
+        }
+        else
+        {
+            // m = b1 * m + (1 - b1) * g, v = b2 * v + (1 - b2) * g^2, p = p - lr * m / (sqrt(v) + eps)
+            // Bias correction is folded into the learning rate and epsilon constants
+            moment = AZ::Simd::Vec4::Madd(moment, constants.m_beta1, AZ::Simd::Vec4::Mul(gradient, constants.m_oneMinusBeta1));
+            secondMoment = AZ::Simd::Vec4::Madd(secondMoment, constants.m_beta2, AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Mul(gradient, gradient), constants.m_oneMinusBeta2));
+            const AZ::Simd::Vec4::FloatType update = AZ::Simd::Vec4::Div(moment, AZ::Simd::Vec4::Add(AZ::Simd::Vec4::Sqrt(secondMoment), constants.m_epsilon));
+            const AZ::Simd::Vec4::FloatType result = AZ::Simd::Vec4::Sub(parameter, AZ::Simd::Vec4::Mul(update, constants.m_learningRate));
+            if constexpr (Optimizer == OptimizerTypes::AdamW)
+            {
+                // Decoupled weight decay, p = p - lr * wd * p, computed from the original parameter value
+                return AZ::Simd::Vec4::Sub(result, AZ::Simd::Vec4::Mul(parameter, constants.m_weightDecay));
+            }
+            return result;
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Algorithms/Quantization.h>
+#include <Algorithms/Activations.h>
+#include <Models/QuantizedMultilayerPerceptron.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+namespace MachineLearning
+{
+    QuantizationParameters ComputeQuantizationParameters(float minValue, float maxValue)
+    {
+        constexpr float quantizedMin = -128.0f;
+        constexpr float quantizedMax = 127.0f;
+
+        minValue = AZ::GetMin(minValue, 0.0f);
+        maxValue = AZ::GetMax(maxValue, 0.0f);
+
+        QuantizationParameters result;
+        const float range = maxValue - minValue;
+        if (range <= AZ::Constants::FloatEpsilon)
+        {
+            return result;
+        }
+
+        result.m_scale = range / (quantizedMax - quantizedMin);
+        const float zeroPoint = quantizedMin - minValue / result.m_scale;
+        result.m_zeroPoint = static_cast<int32_t>(AZ::GetClamp(AZStd::round(zeroPoint), quantizedMin, quantizedMax));
+        return result;
+    }
+
+    int8_t QuantizeValue(float value, const QuantizationParameters& parameters)
+    {
+        const float quantized = AZStd::round(value / parameters.m_scale) + static_cast<float>(parameters.m_zeroPoint);
+        return static_cast<int8_t>(AZ::GetClamp(quantized, -128.0f, 127.0f));
+    }
+
+    int32_t QuantizeVector(const AZ::VectorN& sourceVector, const QuantizationParameters& parameters, AZStd::vector<int8_t>& output)
+    {
+        const AZStd::size_t dimensionality = sourceVector.GetDimensionality();
+        const AZStd::size_t paddedSize = ((dimensionality + QuantizedBlockSize - 1) / QuantizedBlockSize) * QuantizedBlockSize;
+        output.resize(paddedSize);
+
+        int32_t sum = 0;
+        AZStd::size_t index = 0;
+        for (const AZ::Vector4& element : sourceVector.GetVectorValues())
+        {
+            for (int32_t component = 0; (component < 4) && (index < dimensionality); ++component, ++index)
+            {
+                output[index] = QuantizeValue(element.GetElement(component), parameters);
+                sum += output[index];
+            }
+        }
+
+        // Padding is always zero so that it contributes nothing to the dot product
+        for (; index < paddedSize; ++index)
+        {
+            output[index] = 0;
+        }
+        return sum;
+    }
+
+    int32_t DotProductInt8(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count)
+    {
+        AZ_Assert((count % QuantizedBlockSize) == 0, "Quantized buffers must be padded to a multiple of %u elements", static_cast<uint32_t>(QuantizedBlockSize));
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        __m128i accumulator = _mm_setzero_si128();
+        for (AZStd::size_t iter = 0; iter < count; iter += QuantizedBlockSize)
+        {
+            const __m128i lhsValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + iter));
+            const __m128i rhsValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + iter));
+
+            // Sign extend each half of the 8-bit values to 16-bit, SSE2 lacks a direct instruction for this so we duplicate and arithmetic shift
+            const __m128i lhsLow = _mm_srai_epi16(_mm_unpacklo_epi8(lhsValues, lhsValues), 8);
+            const __m128i lhsHigh = _mm_srai_epi16(_mm_unpackhi_epi8(lhsValues, lhsValues), 8);
+            const __m128i rhsLow = _mm_srai_epi16(_mm_unpacklo_epi8(rhsValues, rhsValues), 8);
+            const __m128i rhsHigh = _mm_srai_epi16(_mm_unpackhi_epi8(rhsValues, rhsValues), 8);
+
+            // Multiply 16-bit pairs and horizontally add adjacent products into 32-bit lanes
+            accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(lhsLow, rhsLow));
+            accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(lhsHigh, rhsHigh));
+        }
+        accumulator = _mm_add_epi32(accumulator, _mm_shuffle_epi32(accumulator, _MM_SHUFFLE(1, 0, 3, 2)));
+        accumulator = _mm_add_epi32(accumulator, _mm_shuffle_epi32(accumulator, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(accumulator);
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+        int32x4_t accumulator = vdupq_n_s32(0);
+        for (AZStd::size_t iter = 0; iter < count; iter += QuantizedBlockSize)
+        {
+            const int8x16_t lhsValues = vld1q_s8(lhs + iter);
+            const int8x16_t rhsValues = vld1q_s8(rhs + iter);
+            const int16x8_t productLow = vmull_s8(vget_low_s8(lhsValues), vget_low_s8(rhsValues));
+            const int16x8_t productHigh = vmull_s8(vget_high_s8(lhsValues), vget_high_s8(rhsValues));
+            accumulator = vpadalq_s16(accumulator, productLow);
+            accumulator = vpadalq_s16(accumulator, productHigh);
+        }
+        return vgetq_lane_s32(accumulator, 0) + vgetq_lane_s32(accumulator, 1) + vgetq_lane_s32(accumulator, 2) + vgetq_lane_s32(accumulator, 3);
+#else
+        int32_t accumulator = 0;
+        for (AZStd::size_t iter = 0; iter < count; ++iter)
+        {
+            accumulator += static_cast<int32_t>(lhs[iter]) * static_cast<int32_t>(rhs[iter]);
+        }
+        return accumulator;
+#endif
+    }
+
+    QuantizationReport CompareQuantizedModel(INeuralNetwork& floatModel, INeuralNetwork& quantizedModel, ILabeledTrainingData& testData)
+    {
+        QuantizationReport report;
+        report.m_sampleCount = testData.GetSampleCount();
+        report.m_floatParameterBytes = floatModel.GetParameterCount() * sizeof(float);
+        if (const QuantizedMultilayerPerceptron* quantizedMlp = azrtti_cast<const QuantizedMultilayerPerceptron*>(&quantizedModel))
+        {
+            report.m_quantizedParameterBytes = quantizedMlp->GetParameterBytes();
+        }
+
+        if (report.m_sampleCount == 0)
+        {
+            return report;
+        }
+
+        AZStd::unique_ptr<IInferenceContext> floatContext(floatModel.CreateInferenceContext());
+        AZStd::unique_ptr<IInferenceContext> quantizedContext(quantizedModel.CreateInferenceContext());
+
+        // Copy the outputs of the float model so that we can compare them against the quantized model outputs after timing both passes independently
+        AZStd::vector<AZ::VectorN> floatOutputs;
+        floatOutputs.resize(report.m_sampleCount);
+
+        const auto floatStart = AZStd::chrono::steady_clock::now();
+        for (AZStd::size_t iter = 0; iter < report.m_sampleCount; ++iter)
+        {
+            floatOutputs[iter] = *floatModel.Forward(floatContext.get(), testData.GetDataByIndex(iter));
+        }
+        const auto floatEnd = AZStd::chrono::steady_clock::now();
+
+        AZStd::vector<AZ::VectorN> quantizedOutputs;
+        quantizedOutputs.resize(report.m_sampleCount);
+
+        const auto quantizedStart = AZStd::chrono::steady_clock::now();
+        for (AZStd::size_t iter = 0; iter < report.m_sampleCount; ++iter)
+        {
+            quantizedOutputs[iter] = *quantizedModel.Forward(quantizedContext.get(), testData.GetDataByIndex(iter));
+        }
+        const auto quantizedEnd = AZStd::chrono::steady_clock::now();
+
+        for (AZStd::size_t iter = 0; iter < report.m_sampleCount; ++iter)
+        {
+            const AZStd::size_t expected = ArgMaxDecode(testData.GetLabelByIndex(iter));
+            const AZStd::size_t floatPrediction = ArgMaxDecode(floatOutputs[iter]);
+            const AZStd::size_t quantizedPrediction = ArgMaxDecode(quantizedOutputs[iter]);
+            report.m_floatCorrectPredictions += (floatPrediction == expected) ? 1 : 0;
+            report.m_quantizedCorrectPredictions += (quantizedPrediction == expected) ? 1 : 0;
+            report.m_matchingPredictions += (floatPrediction == quantizedPrediction) ? 1 : 0;
+
+            for (AZStd::size_t element = 0; element < floatOutputs[iter].GetDimensionality(); ++element)
+            {
+                const float error = AZ::GetAbs(floatOutputs[iter].GetElement(element) - quantizedOutputs[iter].GetElement(element));
+                report.m_maxAbsoluteError = AZ::GetMax(report.m_maxAbsoluteError, error);
+            }
+        }
+
+        const double sampleCount = static_cast<double>(report.m_sampleCount);
+        report.m_floatMicrosecondsPerSample = static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(floatEnd - floatStart).count()) / sampleCount;
+        report.m_quantizedMicrosecondsPerSample = static_cast<double>(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(quantizedEnd - quantizedStart).count()) / sampleCount;
+        return report;
+    }
+
+    void LogQuantizationReport(const QuantizationReport& report)
+    {
+        const double sampleCount = static_cast<double>(AZ::GetMax<AZStd::size_t>(report.m_sampleCount, 1));
+        AZLOG_INFO("Quantization report over %u samples", static_cast<uint32_t>(report.m_sampleCount));
+        AZLOG_INFO("  Float accuracy: %.2f%%, quantized accuracy: %.2f%%, matching predictions: %.2f%%",
+            100.0 * static_cast<double>(report.m_floatCorrectPredictions) / sampleCount,
+            100.0 * static_cast<double>(report.m_quantizedCorrectPredictions) / sampleCount,
+            100.0 * static_cast<double>(report.m_matchingPredictions) / sampleCount);
+        AZLOG_INFO("  Max absolute output error: %f", report.m_maxAbsoluteError);
+        AZLOG_INFO("  Float latency: %.3fus per sample, quantized latency: %.3fus per sample", report.m_floatMicrosecondsPerSample, report.m_quantizedMicrosecondsPerSample);
+        AZLOG_INFO("  Float parameters: %u bytes, quantized parameters: %u bytes", static_cast<uint32_t>(report.m_floatParameterBytes), static_cast<uint32_t>(report.m_quantizedParameterBytes));
+    }
+}
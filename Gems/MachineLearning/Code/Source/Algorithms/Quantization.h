@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/VectorN.h>
+#include <AzCore/std/containers/vector.h>
+#include <MachineLearning/INeuralNetwork.h>
+#include <MachineLearning/ILabeledTrainingData.h>
+
+namespace MachineLearning
+{
+    //! The number of int8 elements processed by a single iteration of the int8 dot product kernel.
+    //! Quantized buffers passed to DotProductInt8 must be padded to a multiple of this value.
+    static constexpr AZStd::size_t QuantizedBlockSize = 16;
+
+    //! Affine quantization parameters mapping a range of real values onto the signed 8-bit integer range.
+    //! real = scale * (quantized - zeroPoint)
+    struct QuantizationParameters
+    {
+        float m_scale = 1.0f;
+        int32_t m_zeroPoint = 0;
+    };
+
+    //! Computes the quantization parameters required to represent the provided range of real values.
+    //! The range is always expanded to include zero so that zero padding can be represented exactly.
+    QuantizationParameters ComputeQuantizationParameters(float minValue, float maxValue);
+
+    //! Quantizes a single real value using the provided quantization parameters.
+    int8_t QuantizeValue(float value, const QuantizationParameters& parameters);
+
+    //! Quantizes the source vector into the output buffer, which is resized and zero padded to a multiple of QuantizedBlockSize.
+    //! Returns the sum of all quantized elements, which is required to correct for the zero point when computing dot products.
+    int32_t QuantizeVector(const AZ::VectorN& sourceVector, const QuantizationParameters& parameters, AZStd::vector<int8_t>& output);
+
+    //! Computes the integer dot product of two int8 buffers, count must be a multiple of QuantizedBlockSize.
+    //! This uses SSE2 or NEON when available, and falls back to a scalar implementation otherwise.
+    int32_t DotProductInt8(const int8_t* lhs, const int8_t* rhs, AZStd::size_t count);
+
+    //! The results of comparing a quantized model against the float model it was generated from.
+    struct QuantizationReport
+    {
+        AZStd::size_t m_sampleCount = 0;
+        AZStd::size_t m_floatCorrectPredictions = 0;
+        AZStd::size_t m_quantizedCorrectPredictions = 0;
+        AZStd::size_t m_matchingPredictions = 0;
+        float m_maxAbsoluteError = 0.0f;
+        double m_floatMicrosecondsPerSample = 0.0;
+        double m_quantizedMicrosecondsPerSample = 0.0;
+        AZStd::size_t m_floatParameterBytes = 0;
+        AZStd::size_t m_quantizedParameterBytes = 0;
+    };
+
+    //! Runs both models over the provided labeled data set and compares their accuracy and latency.
+    QuantizationReport CompareQuantizedModel(INeuralNetwork& floatModel, INeuralNetwork& quantizedModel, ILabeledTrainingData& testData);
+
+    //! Dumps the contents of a quantization report to the log.
+    void LogQuantizationReport(const QuantizationReport& report);
+}
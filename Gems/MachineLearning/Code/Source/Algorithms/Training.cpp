@@ -32,6 +32,7 @@ namespace MachineLearning
         ILabeledTrainingDataPtr trainingData,
         ILabeledTrainingDataPtr testData,
         LossFunctions costFunction,
+        OptimizerTypes optimizer,
         AZStd::size_t totalIterations,
         AZStd::size_t batchSize,
         float learningRate,
@@ -43,6 +44,7 @@ namespace MachineLearning
         m_trainData = trainingData;
         m_testData = testData;
         m_costFunction = costFunction;
+        m_optimizerParameters.m_optimizer = optimizer;
         m_totalIterations = totalIterations;
         m_batchSize = batchSize;
         m_learningRate = learningRate;
@@ -62,6 +64,10 @@ namespace MachineLearning
     void SupervisedLearningCycle::StartTraining()
     {
         InitializeContexts();
+        if (m_trainingContext != nullptr)
+        {
+            m_trainingContext->m_optimizerParameters = m_optimizerParameters;
+        }
 
         // Start training
         m_currentEpoch = 0;
@@ -123,7 +129,8 @@ namespace MachineLearning
                 const AZ::VectorN& label = m_trainData.GetLabelByIndex(m_currentIndex);
                 m_model->Reverse(m_trainingContext.get(), m_costFunction, activations, label);
             }
-            AZStd::lock_guard lock(m_mutex);
+
+            // Gradient descent publishes a new parameter version without locking, inference against the model may continue while we train
             m_model->GradientDescent(m_trainingContext.get(), m_learningRate);
         }
     }
@@ -34,6 +34,7 @@ namespace MachineLearning
             ILabeledTrainingDataPtr trainingData,
             ILabeledTrainingDataPtr testData,
             LossFunctions costFunction,
+            OptimizerTypes optimizer,
             AZStd::size_t totalIterations,
             AZStd::size_t batchSize,
             float learningRate,
@@ -57,6 +58,7 @@ namespace MachineLearning
         TrainingDataView m_trainData;
         TrainingDataView m_testData;
         LossFunctions m_costFunction = LossFunctions::MeanSquaredError;
+        OptimizerParameters m_optimizerParameters;
         AZStd::size_t m_totalIterations = 0;
         AZStd::size_t m_batchSize = 0;
         float m_learningRate = 0.0f;
@@ -75,7 +77,7 @@ namespace MachineLearning
         AZStd::unique_ptr<AZ::JobManager> m_trainingJobManager;
         AZStd::unique_ptr<AZ::JobContext> m_trainingjobContext;
 
-        //! Guards model state.
+        //! Guards training data state.
         mutable AZStd::recursive_mutex m_mutex;
     };
 }
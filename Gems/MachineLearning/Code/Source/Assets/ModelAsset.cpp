@@ -7,11 +7,302 @@
  */
 
 #include <Assets/ModelAsset.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 
 namespace MachineLearning
 {
+    static uint64_t AlignOffset(uint64_t offset)
+    {
+        return (offset + ModelAssetAlignment - 1) & ~(ModelAssetAlignment - 1);
+    }
+
+    //! Returns true if the block of bytes starting at offset lies within the first totalSize bytes of the model, without overflowing.
+    static bool IsBlockInBounds(uint64_t offset, uint64_t bytes, uint64_t totalSize)
+    {
+        return (offset <= totalSize) && (bytes <= totalSize - offset);
+    }
+
+    //! Returns the number of four element SIMD blocks needed to store the given number of elements.
+    static uint64_t GetBlockCount(uint64_t elements)
+    {
+        return (elements / 4) + (((elements % 4) != 0) ? 1 : 0);
+    }
+
+    //! Returns true if the parameter block sizes of a layer header match the storage of its dimensions, so that nothing is sized from a corrupt header.
+    static bool HasMatchingParameterBytes(const ModelAssetLayerHeader& layerHeader)
+    {
+        const uint64_t rowBlocks = GetBlockCount(layerHeader.m_outputSize);
+        const uint64_t colBlocks = GetBlockCount(layerHeader.m_inputSize);
+        if ((layerHeader.m_biasBytes % sizeof(AZ::Vector4) != 0) || (layerHeader.m_biasBytes / sizeof(AZ::Vector4) != rowBlocks))
+        {
+            return false;
+        }
+        if ((rowBlocks != 0) && (colBlocks > layerHeader.m_weightBytes / sizeof(AZ::Matrix4x4) / rowBlocks))
+        {
+            return false;
+        }
+        return rowBlocks * colBlocks * sizeof(AZ::Matrix4x4) == layerHeader.m_weightBytes;
+    }
+
+    //! Tracks the current position while sequentially reading or writing a binary model, inserting or skipping padding as required.
+    class BinaryModelCursor
+    {
+    public:
+
+        BinaryModelCursor(AZ::IO::GenericStream& stream, uint64_t position)
+            : m_stream(stream)
+            , m_position(position)
+        {
+        }
+
+        bool WriteAt(uint64_t offset, const void* data, uint64_t bytes)
+        {
+            if (offset < m_position)
+            {
+                return false;
+            }
+
+            const uint8_t padding[ModelAssetAlignment] = {};
+            while (m_position < offset)
+            {
+                const uint64_t paddingBytes = AZ::GetMin(offset - m_position, ModelAssetAlignment);
+                if (m_stream.Write(paddingBytes, padding) != paddingBytes)
+                {
+                    return false;
+                }
+                m_position += paddingBytes;
+            }
+
+            if ((bytes > 0) && (m_stream.Write(bytes, data) != bytes))
+            {
+                return false;
+            }
+            m_position += bytes;
+            return true;
+        }
+
+        bool ReadAt(uint64_t offset, void* data, uint64_t bytes)
+        {
+            if (offset < m_position)
+            {
+                return false;
+            }
+
+            // Blocks are always laid out in increasing offset order, so padding is skipped rather than seeking, which keeps this usable on forward only streams
+            uint8_t padding[ModelAssetAlignment];
+            while (m_position < offset)
+            {
+                const uint64_t paddingBytes = AZ::GetMin(offset - m_position, ModelAssetAlignment);
+                if (m_stream.Read(paddingBytes, padding) != paddingBytes)
+                {
+                    return false;
+                }
+                m_position += paddingBytes;
+            }
+
+            if ((bytes > 0) && (m_stream.Read(bytes, data) != bytes))
+            {
+                return false;
+            }
+            m_position += bytes;
+            return true;
+        }
+
+    private:
+
+        AZ::IO::GenericStream& m_stream;
+        uint64_t m_position = 0;
+    };
+
+    bool WriteBinaryModel(const ModelAsset& model, AZ::IO::GenericStream& stream)
+    {
+        ModelAssetHeader header;
+        header.m_headerSize = sizeof(ModelAssetHeader);
+        header.m_layerCount = static_cast<uint32_t>(model.m_layers.size());
+        header.m_activationCount = model.m_activationCount;
+        header.m_layerTableOffset = sizeof(ModelAssetHeader);
+        header.m_nameOffset = header.m_layerTableOffset + header.m_layerCount * sizeof(ModelAssetLayerHeader);
+        header.m_nameLength = model.m_name.size();
+
+        AZStd::vector<ModelAssetLayerHeader> layerTable(model.m_layers.size());
+        uint64_t offset = AlignOffset(header.m_nameOffset + header.m_nameLength);
+        for (AZStd::size_t iter = 0; iter < model.m_layers.size(); ++iter)
+        {
+            const Layer& layer = model.m_layers[iter];
+            ModelAssetLayerHeader& layerHeader = layerTable[iter];
+            layerHeader.m_inputSize = layer.m_inputSize;
+            layerHeader.m_outputSize = layer.m_outputSize;
+            layerHeader.m_activationFunction = static_cast<uint32_t>(layer.m_activationFunction);
+            layerHeader.m_weightOffset = offset;
+            layerHeader.m_weightBytes = layer.m_weights.GetMatrixElements().size() * sizeof(AZ::Matrix4x4);
+            offset = AlignOffset(offset + layerHeader.m_weightBytes);
+            layerHeader.m_biasOffset = offset;
+            layerHeader.m_biasBytes = layer.m_biases.GetVectorValues().size() * sizeof(AZ::Vector4);
+            offset = AlignOffset(offset + layerHeader.m_biasBytes);
+        }
+        header.m_totalSize = offset;
+
+        BinaryModelCursor cursor(stream, 0);
+        bool result = cursor.WriteAt(0, &header, sizeof(header))
+                   && cursor.WriteAt(header.m_layerTableOffset, layerTable.data(), layerTable.size() * sizeof(ModelAssetLayerHeader))
+                   && cursor.WriteAt(header.m_nameOffset, model.m_name.data(), header.m_nameLength);
+        for (AZStd::size_t iter = 0; (iter < model.m_layers.size()) && result; ++iter)
+        {
+            const Layer& layer = model.m_layers[iter];
+            result = cursor.WriteAt(layerTable[iter].m_weightOffset, layer.m_weights.GetMatrixElements().data(), layerTable[iter].m_weightBytes)
+                  && cursor.WriteAt(layerTable[iter].m_biasOffset, layer.m_biases.GetVectorValues().data(), layerTable[iter].m_biasBytes);
+        }
+
+        // Pad the final block so the file size is always a multiple of the alignment
+        return result && cursor.WriteAt(header.m_totalSize, nullptr, 0);
+    }
+
+    static bool ReadBinaryModel(AZ::IO::GenericStream& stream, const ModelAssetHeader& header, ModelAsset& model)
+    {
+        if (header.m_version > ModelAssetVersion)
+        {
+            AZLOG_WARN("Binary model version %u is newer than the supported version %u", header.m_version, ModelAssetVersion);
+            return false;
+        }
+
+        if ((header.m_headerSize < sizeof(ModelAssetHeader)) || (header.m_totalSize > stream.GetLength()))
+        {
+            AZLOG_WARN("Binary model header is corrupt");
+            return false;
+        }
+
+        // Nothing is sized from the header until the blocks it describes are known to lie within the model
+        const uint64_t layerTableBytes = static_cast<uint64_t>(header.m_layerCount) * sizeof(ModelAssetLayerHeader);
+        if (!IsBlockInBounds(header.m_layerTableOffset, layerTableBytes, header.m_totalSize)
+         || !IsBlockInBounds(header.m_nameOffset, header.m_nameLength, header.m_totalSize))
+        {
+            AZLOG_WARN("Binary model layer table or name lies outside of the model");
+            return false;
+        }
+
+        BinaryModelCursor cursor(stream, sizeof(ModelAssetHeader));
+        AZStd::vector<ModelAssetLayerHeader> layerTable(header.m_layerCount);
+        model.m_name.resize(header.m_nameLength);
+        if (!cursor.ReadAt(header.m_layerTableOffset, layerTable.data(), layerTable.size() * sizeof(ModelAssetLayerHeader))
+         || !cursor.ReadAt(header.m_nameOffset, model.m_name.data(), header.m_nameLength))
+        {
+            AZLOG_WARN("Binary model layer table is truncated");
+            return false;
+        }
+
+        model.m_activationCount = header.m_activationCount;
+        model.m_layers.clear();
+        model.m_layers.resize(header.m_layerCount);
+        for (AZStd::size_t iter = 0; iter < layerTable.size(); ++iter)
+        {
+            const ModelAssetLayerHeader& layerHeader = layerTable[iter];
+            if (layerHeader.m_activationFunction > static_cast<uint32_t>(ActivationFunctions::Linear))
+            {
+                AZLOG_WARN("Binary model layer %u has an unknown activation function", static_cast<uint32_t>(iter));
+                return false;
+            }
+
+            if (!IsBlockInBounds(layerHeader.m_weightOffset, layerHeader.m_weightBytes, header.m_totalSize)
+             || !IsBlockInBounds(layerHeader.m_biasOffset, layerHeader.m_biasBytes, header.m_totalSize)
+             || !HasMatchingParameterBytes(layerHeader))
+            {
+                AZLOG_WARN("Binary model layer %u parameters lie outside of the model or do not match its dimensionality", static_cast<uint32_t>(iter));
+                return false;
+            }
+
+            // Size the runtime storage first, then stream the parameter blocks directly into it
+            Layer& layer = model.m_layers[iter];
+            layer.m_inputSize = layerHeader.m_inputSize;
+            layer.m_outputSize = layerHeader.m_outputSize;
+            layer.m_activationFunction = static_cast<ActivationFunctions>(layerHeader.m_activationFunction);
+            layer.m_weights.Resize(layer.m_outputSize, layer.m_inputSize);
+            layer.m_biases.Resize(layer.m_outputSize);
+
+            AZStd::vector<AZ::Matrix4x4>& weights = layer.m_weights.GetMatrixElements();
+            AZStd::vector<AZ::Vector4>& biases = layer.m_biases.GetVectorValues();
+            if ((layerHeader.m_weightBytes != weights.size() * sizeof(AZ::Matrix4x4)) || (layerHeader.m_biasBytes != biases.size() * sizeof(AZ::Vector4)))
+            {
+                AZLOG_WARN("Binary model layer %u parameter sizes do not match its dimensionality", static_cast<uint32_t>(iter));
+                return false;
+            }
+
+            if (!cursor.ReadAt(layerHeader.m_weightOffset, weights.data(), layerHeader.m_weightBytes)
+             || !cursor.ReadAt(layerHeader.m_biasOffset, biases.data(), layerHeader.m_biasBytes))
+            {
+                AZLOG_WARN("Binary model layer %u parameters are truncated", static_cast<uint32_t>(iter));
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadModel(AZ::IO::GenericStream& stream, ModelAsset& model)
+    {
+        const AZ::IO::SizeType length = stream.GetLength();
+
+        ModelAssetHeader header;
+        const AZ::IO::SizeType headerBytes = stream.Read(AZ::GetMin<AZ::IO::SizeType>(sizeof(header), length), &header);
+        if ((headerBytes == sizeof(header)) && (header.m_magic == ModelAssetMagic))
+        {
+            return ReadBinaryModel(stream, header, model);
+        }
+
+        // Legacy serialized model, the bytes already consumed while checking for a header are the start of the serialized data
+        AZStd::vector<uint8_t> serializeBuffer;
+        serializeBuffer.resize(length);
+        memcpy(serializeBuffer.data(), &header, headerBytes);
+        if (stream.Read(length - headerBytes, serializeBuffer.data() + headerBytes) != length - headerBytes)
+        {
+            return false;
+        }
+        AzNetworking::NetworkOutputSerializer serializer(serializeBuffer.data(), static_cast<uint32_t>(serializeBuffer.size()));
+        return model.Serialize(serializer);
+    }
+
+    bool ConvertModelFile(const char* sourcePath, const char* destinationPath)
+    {
+        // The source is read in full before the destination is opened, so converting a file in place is safe
+        ModelAsset model;
+        {
+            AZ::IO::FileIOStream sourceStream(sourcePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+            if (!sourceStream.IsOpen() || !ReadModel(sourceStream, model))
+            {
+                AZLOG_WARN("Failed to read model %s", sourcePath);
+                return false;
+            }
+        }
+
+        AZ::IO::FileIOStream destinationStream(destinationPath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!destinationStream.IsOpen() || !WriteBinaryModel(model, destinationStream))
+        {
+            AZLOG_WARN("Failed to write model %s", destinationPath);
+            return false;
+        }
+        return true;
+    }
+
+    static void ml_convertModel(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("Usage: ml_convertModel <source> [destination]");
+            return;
+        }
+
+        const AZStd::string sourcePath(arguments[0]);
+        const AZStd::string destinationPath = (arguments.size() > 1) ? AZStd::string(arguments[1]) : sourcePath;
+        if (ConvertModelFile(sourcePath.c_str(), destinationPath.c_str()))
+        {
+            AZLOG_INFO("Converted %s to the binary model format at %s", sourcePath.c_str(), destinationPath.c_str());
+        }
+    }
+    AZ_CONSOLEFREEFUNC(ml_convertModel, AZ::ConsoleFunctorFlags::Null, "Converts a model file to the aligned binary model format, usage: ml_convertModel <source> [destination]");
+
     void ModelAsset::Reflect(AZ::ReflectContext* context)
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -64,13 +355,7 @@ namespace MachineLearning
         ModelAsset* assetData = asset.GetAs<ModelAsset>();
         AZ_Assert(assetData, "Asset is of the wrong type.");
 
-        const AZ::IO::SizeType length = stream->GetLength();
-
-        AZStd::vector<uint8_t> serializeBuffer;
-        serializeBuffer.resize(length);
-        stream->Read(length, serializeBuffer.data());
-        AzNetworking::NetworkOutputSerializer serializer(serializeBuffer.data(), static_cast<uint32_t>(serializeBuffer.size()));
-        if (assetData->Serialize(serializer))
+        if (ReadModel(*stream, *assetData))
         {
             return AZ::Data::AssetHandler::LoadResult::LoadComplete;
         }
@@ -83,15 +368,7 @@ namespace MachineLearning
         ModelAsset* assetData = asset.GetAs<ModelAsset>();
         AZ_Assert(assetData, "Asset is of the wrong type.");
 
-        AZStd::vector<uint8_t> serializeBuffer;
-        serializeBuffer.resize(assetData->EstimateSerializeSize());
-        AzNetworking::NetworkInputSerializer serializer(serializeBuffer.data(), static_cast<uint32_t>(serializeBuffer.size()));
-        if (assetData->Serialize(serializer))
-        {
-            stream->Write(serializer.GetSize(), serializeBuffer.data());
-            return true;
-        }
-
-        return false;
+        // Models are always saved in the binary format, legacy models are converted the first time they are saved
+        return WriteBinaryModel(*assetData, *stream);
     }
 }
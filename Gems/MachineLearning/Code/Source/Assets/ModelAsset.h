@@ -14,8 +14,68 @@
 #include <AzFramework/Asset/GenericAssetHandler.h>
 #include <Models/Layer.h>
 
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
 namespace MachineLearning
 {
+    class ModelAsset;
+
+    //! Identifies the binary model format, this reads as "MLMB" in a little-endian file.
+    static constexpr uint32_t ModelAssetMagic = 0x424D4C4D;
+
+    //! Incremented whenever the binary model layout changes.
+    static constexpr uint32_t ModelAssetVersion = 1;
+
+    //! All layer parameter blocks are aligned to this many bytes relative to the start of the file.
+    static constexpr uint64_t ModelAssetAlignment = 64;
+
+    //! The header at the start of a binary model file.
+    //! All offsets are in bytes from the start of the file, and all values are little-endian.
+    struct ModelAssetHeader
+    {
+        uint32_t m_magic = ModelAssetMagic;
+        uint32_t m_version = ModelAssetVersion;
+        uint32_t m_headerSize = 0;
+        uint32_t m_layerCount = 0;
+        uint64_t m_activationCount = 0;
+        uint64_t m_layerTableOffset = 0;
+        uint64_t m_nameOffset = 0;
+        uint64_t m_nameLength = 0;
+        uint64_t m_totalSize = 0;
+        uint64_t m_reserved = 0;
+    };
+    static_assert(sizeof(ModelAssetHeader) == ModelAssetAlignment, "ModelAssetHeader must occupy exactly one aligned block");
+
+    //! Describes a single layer within a binary model file.
+    //! Weights are stored as the raw AZ::Matrix4x4 blocks of an AZ::MatrixMxN, and biases as the raw AZ::Vector4 elements of an AZ::VectorN.
+    //! This matches the runtime storage layout exactly, so parameter blocks can be read or mapped directly into layer storage without conversion.
+    struct ModelAssetLayerHeader
+    {
+        uint64_t m_inputSize = 0;
+        uint64_t m_outputSize = 0;
+        uint32_t m_activationFunction = 0;
+        uint32_t m_reserved = 0;
+        uint64_t m_weightOffset = 0;
+        uint64_t m_weightBytes = 0;
+        uint64_t m_biasOffset = 0;
+        uint64_t m_biasBytes = 0;
+        uint64_t m_reserved2 = 0;
+    };
+    static_assert(sizeof(ModelAssetLayerHeader) == ModelAssetAlignment, "ModelAssetLayerHeader must occupy exactly one aligned block");
+
+    //! Writes the provided model to the stream in the binary model format.
+    bool WriteBinaryModel(const ModelAsset& model, AZ::IO::GenericStream& stream);
+
+    //! Reads a model from the stream, this supports both the binary model format and the legacy serialized format.
+    //! Binary models are streamed directly into layer storage, legacy models are read into an intermediate buffer and deserialized.
+    bool ReadModel(AZ::IO::GenericStream& stream, ModelAsset& model);
+
+    //! Converts a model file from any supported format into the binary model format, the source and destination paths may be the same.
+    bool ConvertModelFile(const char* sourcePath, const char* destinationPath);
+
     class ModelAsset final
         : public AZ::Data::AssetData
     {
@@ -9,6 +9,7 @@
 #include <Source/Debug/MachineLearningDebugTrainingWindow.h>
 #include <Source/Assets/MnistDataLoader.h>
 #include <Source/Algorithms/Activations.h>
+#include <Source/Models/QuantizedMultilayerPerceptron.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
@@ -22,6 +23,7 @@
 namespace MachineLearning
 {
     AZ_CVAR(bool, ml_logAccuracyValues, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Dumps the actual and expected labels during accuracy calculations");
+    AZ_CVAR(uint32_t, ml_quantizationCalibrationSamples, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of training samples used to calibrate activation ranges when quantizing a model");
 
 #ifdef IMGUI_ENABLED
     int32_t AZStdStringResizeCallback(ImGuiInputTextCallbackData* data)
@@ -126,6 +128,28 @@ namespace MachineLearning
         }
     }
 
+    void MachineLearningDebugTrainingWindow::QuantizeAndCompare(TrainingInstance* trainingInstance)
+    {
+        MultilayerPerceptron* floatModel = azrtti_cast<MultilayerPerceptron*>(m_selectedModel.get());
+        if (floatModel == nullptr)
+        {
+            AZLOG_WARN("Quantization is only supported for multilayer perceptron models");
+            return;
+        }
+
+        // Calibrate against the training data and evaluate against the test data so that the report reflects unseen samples
+        QuantizedMultilayerPerceptron quantizedModel;
+        if (!quantizedModel.Quantize(*floatModel, trainingInstance->m_trainingCycle.m_trainData, ml_quantizationCalibrationSamples))
+        {
+            AZLOG_WARN("Failed to quantize model %s", floatModel->GetName().c_str());
+            return;
+        }
+
+        trainingInstance->m_quantizationReport = CompareQuantizedModel(*floatModel, quantizedModel, trainingInstance->m_trainingCycle.m_testData);
+        trainingInstance->m_hasQuantizationReport = true;
+        LogQuantizationReport(trainingInstance->m_quantizationReport);
+    }
+
     void DrawDataPanel(TrainingDataView& data, AZStd::string& dataName, AZStd::string& labelName)
     {
         ImGui::PushID(&data);
@@ -256,6 +280,12 @@ namespace MachineLearning
                     LoadTestTrainData(trainingInstance);
                     RecalculateAccuracy(trainingInstance, trainingInstance->m_trainingCycle.m_trainData);
                 }
+                ImGui::SameLine();
+                if (ImGui::Button("Quantize and compare on test data"))
+                {
+                    LoadTestTrainData(trainingInstance);
+                    QuantizeAndCompare(trainingInstance);
+                }
             }
  
             ImGui::NewLine();
@@ -301,6 +331,39 @@ namespace MachineLearning
                 ImGui::NewLine();
             }
 
+            if (trainingInstance->m_hasQuantizationReport && ImGui::BeginTable("Quantization", 3, flags))
+            {
+                const QuantizationReport& report = trainingInstance->m_quantizationReport;
+                const float sampleCount = static_cast<float>(AZ::GetMax<AZStd::size_t>(report.m_sampleCount, 1));
+                ImGui::TableSetupColumn("Metric", ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 32.0f);
+                ImGui::TableSetupColumn("Float", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableSetupColumn("Int8", ImGuiTableColumnFlags_WidthStretch);
+                ImGui::TableHeadersRow();
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("Accuracy");
+                ImGui::TableNextColumn();
+                ImGui::Text("%f", static_cast<float>(report.m_floatCorrectPredictions) * 100.0f / sampleCount);
+                ImGui::TableNextColumn();
+                ImGui::Text("%f", static_cast<float>(report.m_quantizedCorrectPredictions) * 100.0f / sampleCount);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("Latency per sample (us)");
+                ImGui::TableNextColumn();
+                ImGui::Text("%f", report.m_floatMicrosecondsPerSample);
+                ImGui::TableNextColumn();
+                ImGui::Text("%f", report.m_quantizedMicrosecondsPerSample);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("Parameter bytes");
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", static_cast<uint32_t>(report.m_floatParameterBytes));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", static_cast<uint32_t>(report.m_quantizedParameterBytes));
+                ImGui::EndTable();
+                ImGui::NewLine();
+            }
+
             trainingInstance->m_testHistogram.Draw(ImGui::GetColumnWidth(), 200.0f);
             trainingInstance->m_trainHistogram.Draw(ImGui::GetColumnWidth(), 200.0f);
             ImGui::NewLine();
@@ -311,7 +374,7 @@ namespace MachineLearning
             trainingInstance->m_trainingCycle.m_totalIterations = totalIterations;
 
             int32_t costMetric = static_cast<int32_t>(trainingInstance->m_trainingCycle.m_costFunction);
-            ImGui::Combo("Cost metric", &costMetric, "MeanSquaredError\0");
+            ImGui::Combo("Cost metric", &costMetric, "MeanSquaredError\0CrossEntropy\0");
             trainingInstance->m_trainingCycle.m_costFunction = static_cast<LossFunctions>(costMetric);
             ImGui::NewLine();
 
@@ -320,6 +383,29 @@ namespace MachineLearning
             ImGui::SliderFloat("EarlyStop", &trainingInstance->m_trainingCycle.m_earlyStopCost, 0.0f, 1.0f);
             ImGui::NewLine();
 
+            // Optimizer changes are applied the next time training is started
+            OptimizerParameters& optimizerParameters = trainingInstance->m_trainingCycle.m_optimizerParameters;
+            int32_t optimizer = static_cast<int32_t>(optimizerParameters.m_optimizer);
+            ImGui::Combo("Optimizer", &optimizer, "Sgd\0Momentum\0Nesterov\0Adam\0AdamW\0");
+            optimizerParameters.m_optimizer = static_cast<OptimizerTypes>(optimizer);
+            switch (optimizerParameters.m_optimizer)
+            {
+            case OptimizerTypes::Momentum:
+            case OptimizerTypes::Nesterov:
+                ImGui::SliderFloat("Momentum", &optimizerParameters.m_momentum, 0.0f, 0.999f);
+                break;
+            case OptimizerTypes::AdamW:
+                ImGui::SliderFloat("WeightDecay", &optimizerParameters.m_weightDecay, 0.0f, 0.1f);
+                [[fallthrough]];
+            case OptimizerTypes::Adam:
+                ImGui::SliderFloat("Beta1", &optimizerParameters.m_beta1, 0.0f, 0.999f);
+                ImGui::SliderFloat("Beta2", &optimizerParameters.m_beta2, 0.0f, 0.9999f, "%.4f");
+                break;
+            default:
+                break;
+            }
+            ImGui::NewLine();
+
             ImGui::PushItemWidth(ImGui::GetWindowWidth() * 0.4f);
 
             ImGui::Checkbox("Shuffle data", &trainingInstance->m_trainingCycle.m_shuffleTrainingData);
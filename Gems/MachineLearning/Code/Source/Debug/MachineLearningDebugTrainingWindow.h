@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/map.h>
 #include <MachineLearning/IMachineLearning.h>
 #include <Algorithms/Training.h>
+#include <Algorithms/Quantization.h>
 
 #ifdef IMGUI_ENABLED
 #   include <imgui/imgui.h>
@@ -36,6 +37,9 @@ namespace MachineLearning
         int32_t m_correctPredictions = 0;
         int32_t m_incorrectPredictions = 0;
 
+        bool m_hasQuantizationReport = false;
+        QuantizationReport m_quantizationReport;
+
 #ifdef IMGUI_ENABLED
         ImGui::LYImGuiUtils::HistogramContainer m_testHistogram;
         ImGui::LYImGuiUtils::HistogramContainer m_trainHistogram;
@@ -50,6 +54,7 @@ namespace MachineLearning
         TrainingInstance* RetrieveTrainingInstance(INeuralNetworkPtr modelPtr);
         void LoadTestTrainData(TrainingInstance* trainingInstance);
         void RecalculateAccuracy(TrainingInstance* trainingInstance, ILabeledTrainingData& data);
+        void QuantizeAndCompare(TrainingInstance* trainingInstance);
 
 #ifdef IMGUI_ENABLED
         void OnImGuiUpdate();
@@ -25,12 +25,14 @@ namespace AZ
 {
     AZ_TYPE_INFO_SPECIALIZE(MachineLearning::ActivationFunctions, "{2ABF758E-CA69-41AC-BC95-B47AD7DEA31B}");
     AZ_TYPE_INFO_SPECIALIZE(MachineLearning::LossFunctions, "{18098C74-9AD0-4F1D-8093-545344620AD1}");
+    AZ_TYPE_INFO_SPECIALIZE(MachineLearning::OptimizerTypes, "{7D3B9E52-1A6C-4F08-B2E4-95C1D0A7F863}");
 }
 
 namespace MachineLearning
 {
     AZ_ENUM_DEFINE_REFLECT_UTILITIES(ActivationFunctions);
     AZ_ENUM_DEFINE_REFLECT_UTILITIES(LossFunctions);
+    AZ_ENUM_DEFINE_REFLECT_UTILITIES(OptimizerTypes);
 
     AZ_COMPONENT_IMPL(MachineLearningSystemComponent, "MachineLearningSystemComponent", MachineLearningSystemComponentTypeId);
 
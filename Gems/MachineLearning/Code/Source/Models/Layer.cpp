@@ -9,6 +9,7 @@
 #include <Models/MultilayerPerceptron.h>
 #include <Algorithms/Activations.h>
 #include <Algorithms/LossFunctions.h>
+#include <Algorithms/Optimizers.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -172,7 +173,7 @@ namespace MachineLearning
         OnSizesChanged();
     }
 
-    const AZ::VectorN& Layer::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations)
+    const AZ::VectorN& Layer::Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) const
     {
         inferenceData.m_output = m_biases;
         AZ::VectorMatrixMultiply(m_weights, activations, inferenceData.m_output);
@@ -180,7 +181,14 @@ namespace MachineLearning
         return inferenceData.m_output;
     }
 
-    void Layer::AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients)
+    void Layer::AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& previousLayerGradients) const
+    {
+        // Compute the partial derivatives of the output with respect to the activation function
+        Activate_Derivative(m_activationFunction, inferenceData.m_output, previousLayerGradients, trainingData.m_activationGradients);
+        AccumulateActivationGradients(samples, trainingData);
+    }
+
+    void Layer::AccumulateActivationGradients(AZStd::size_t samples, LayerTrainingData& trainingData) const
     {
         // Ensure our bias gradient vector is appropriately sized
         if (trainingData.m_biasGradients.GetDimensionality() != m_outputSize)
@@ -200,9 +208,6 @@ namespace MachineLearning
             trainingData.m_backpropagationGradients = AZ::VectorN::CreateZero(m_inputSize);
         }
 
-        // Compute the partial derivatives of the output with respect to the activation function
-        Activate_Derivative(m_activationFunction, inferenceData.m_output, previousLayerGradients, trainingData.m_activationGradients);
-
         // Accumulate the partial derivatives of the weight matrix with respect to the loss function
         AccumulateWeightGradients(trainingData.m_activationGradients, *trainingData.m_lastInput, trainingData.m_weightGradients, samples);
 
@@ -233,10 +238,121 @@ namespace MachineLearning
         }
     }
 
+    template <OptimizerTypes Optimizer>
+    static void ApplyOptimizer(const Layer& source, LayerTrainingData& trainingData, const OptimizerStepConstants& weightConstants, const OptimizerStepConstants& biasConstants, Layer& output)
+    {
+        constexpr bool usesFirstMoment = (Optimizer != OptimizerTypes::Sgd);
+        constexpr bool usesSecondMoment = (Optimizer == OptimizerTypes::Adam) || (Optimizer == OptimizerTypes::AdamW);
+
+        // Placeholder moments for optimizers that do not maintain one or both moment estimates, these are never read
+        AZ::Simd::Vec4::FloatType unusedMoment = AZ::Simd::Vec4::ZeroFloat();
+        AZ::Simd::Vec4::FloatType unusedSecondMoment = AZ::Simd::Vec4::ZeroFloat();
+
+        // Parameters, gradients and moments share the same blocked layout, so each is visited exactly once in a single pass
+        const AZStd::vector<AZ::Matrix4x4>& sourceWeights = source.m_weights.GetMatrixElements();
+        const AZStd::vector<AZ::Matrix4x4>& weightGradients = trainingData.m_weightGradients.GetMatrixElements();
+        AZStd::vector<AZ::Matrix4x4>& weightMoments = trainingData.m_weightMoments.GetMatrixElements();
+        AZStd::vector<AZ::Matrix4x4>& weightSecondMoments = trainingData.m_weightSecondMoments.GetMatrixElements();
+        AZStd::vector<AZ::Matrix4x4>& outputWeights = output.m_weights.GetMatrixElements();
+        for (AZStd::size_t iter = 0; iter < sourceWeights.size(); ++iter)
+        {
+            for (int32_t row = 0; row < 4; ++row)
+            {
+                AZ::Simd::Vec4::FloatType& moment = usesFirstMoment ? weightMoments[iter].GetSimdValues()[row] : unusedMoment;
+                AZ::Simd::Vec4::FloatType& secondMoment = usesSecondMoment ? weightSecondMoments[iter].GetSimdValues()[row] : unusedSecondMoment;
+                outputWeights[iter].GetSimdValues()[row] = OptimizerStep<Optimizer>
+                (
+                    weightConstants,
+                    sourceWeights[iter].GetSimdValues()[row],
+                    weightGradients[iter].GetSimdValues()[row],
+                    moment,
+                    secondMoment
+                );
+            }
+        }
+
+        const AZStd::vector<AZ::Vector4>& sourceBiases = source.m_biases.GetVectorValues();
+        const AZStd::vector<AZ::Vector4>& biasGradients = trainingData.m_biasGradients.GetVectorValues();
+        AZStd::vector<AZ::Vector4>& biasMoments = trainingData.m_biasMoments.GetVectorValues();
+        AZStd::vector<AZ::Vector4>& biasSecondMoments = trainingData.m_biasSecondMoments.GetVectorValues();
+        AZStd::vector<AZ::Vector4>& outputBiases = output.m_biases.GetVectorValues();
+        for (AZStd::size_t iter = 0; iter < sourceBiases.size(); ++iter)
+        {
+            AZ::Simd::Vec4::FloatType moment = usesFirstMoment ? biasMoments[iter].GetSimdValue() : unusedMoment;
+            AZ::Simd::Vec4::FloatType secondMoment = usesSecondMoment ? biasSecondMoments[iter].GetSimdValue() : unusedSecondMoment;
+            outputBiases[iter].SetSimdValue(OptimizerStep<Optimizer>(biasConstants, sourceBiases[iter].GetSimdValue(), biasGradients[iter].GetSimdValue(), moment, secondMoment));
+            if constexpr (usesFirstMoment)
+            {
+                biasMoments[iter].SetSimdValue(moment);
+            }
+            if constexpr (usesSecondMoment)
+            {
+                biasSecondMoments[iter].SetSimdValue(secondMoment);
+            }
+        }
+    }
+
     void Layer::ApplyGradients(LayerTrainingData& trainingData, float learningRate)
     {
-        m_weights -= trainingData.m_weightGradients * learningRate;
-        m_biases -= trainingData.m_biasGradients * learningRate;
+        ApplyGradients(trainingData, OptimizerParameters(), 1, learningRate, *this);
+    }
+
+    void Layer::ApplyGradients(LayerTrainingData& trainingData, const OptimizerParameters& optimizer, AZStd::size_t step, float learningRate, Layer& output) const
+    {
+        AZ_Assert((output.m_weights.GetRowCount() == m_weights.GetRowCount()) && (output.m_weights.GetColumnCount() == m_weights.GetColumnCount()), "Output layer weights must match the dimensionality of the source layer");
+        AZ_Assert(output.m_biases.GetDimensionality() == m_biases.GetDimensionality(), "Output layer biases must match the dimensionality of the source layer");
+
+        // Ensure any moment estimates required by the optimizer are appropriately sized, these start at zero
+        if (UsesFirstMoment(optimizer.m_optimizer))
+        {
+            if ((trainingData.m_weightMoments.GetRowCount() != m_outputSize) || (trainingData.m_weightMoments.GetColumnCount() != m_inputSize))
+            {
+                trainingData.m_weightMoments = AZ::MatrixMxN::CreateZero(m_outputSize, m_inputSize);
+            }
+            if (trainingData.m_biasMoments.GetDimensionality() != m_outputSize)
+            {
+                trainingData.m_biasMoments = AZ::VectorN::CreateZero(m_outputSize);
+            }
+        }
+
+        if (UsesSecondMoment(optimizer.m_optimizer))
+        {
+            if ((trainingData.m_weightSecondMoments.GetRowCount() != m_outputSize) || (trainingData.m_weightSecondMoments.GetColumnCount() != m_inputSize))
+            {
+                trainingData.m_weightSecondMoments = AZ::MatrixMxN::CreateZero(m_outputSize, m_inputSize);
+            }
+            if (trainingData.m_biasSecondMoments.GetDimensionality() != m_outputSize)
+            {
+                trainingData.m_biasSecondMoments = AZ::VectorN::CreateZero(m_outputSize);
+            }
+        }
+
+        // Weight decay is only ever applied to weights, decaying biases towards zero has no regularizing effect
+        const OptimizerStepConstants weightConstants(optimizer, step, learningRate, true);
+        const OptimizerStepConstants biasConstants(optimizer, step, learningRate, false);
+        switch (optimizer.m_optimizer)
+        {
+        case OptimizerTypes::Sgd:
+            ApplyOptimizer<OptimizerTypes::Sgd>(*this, trainingData, weightConstants, biasConstants, output);
+            break;
+        case OptimizerTypes::Momentum:
+            ApplyOptimizer<OptimizerTypes::Momentum>(*this, trainingData, weightConstants, biasConstants, output);
+            break;
+        case OptimizerTypes::Nesterov:
+            ApplyOptimizer<OptimizerTypes::Nesterov>(*this, trainingData, weightConstants, biasConstants, output);
+            break;
+        case OptimizerTypes::Adam:
+            ApplyOptimizer<OptimizerTypes::Adam>(*this, trainingData, weightConstants, biasConstants, output);
+            break;
+        case OptimizerTypes::AdamW:
+            ApplyOptimizer<OptimizerTypes::AdamW>(*this, trainingData, weightConstants, biasConstants, output);
+            break;
+        default:
+            // The output layer is published as the new parameters, so it must always be written, fall back to plain SGD
+            AZ_Assert(false, "Unknown optimizer type %u", static_cast<uint32_t>(optimizer.m_optimizer));
+            ApplyOptimizer<OptimizerTypes::Sgd>(*this, trainingData, weightConstants, biasConstants, output);
+            break;
+        }
 
         trainingData.m_biasGradients.SetZero();
         trainingData.m_weightGradients.SetZero();
@@ -39,15 +39,27 @@ namespace MachineLearning
         Layer& operator=(const Layer&) = default;
 
         //! Performs a basic forward pass on this layer, outputs are stored in m_output.
-        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations);
+        const AZ::VectorN& Forward(LayerInferenceData& inferenceData, const AZ::VectorN& activations) const;
 
         //! Performs a gradient computation against the provided expected output using the provided gradients from the previous layer.
         //! This method presumes that we've completed a forward pass immediately prior to fill all the relevant vectors
-        void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& expected);
+        //! Gradients are only written to the training data, so this may be invoked on a published parameter buffer.
+        void AccumulateGradients(AZStd::size_t samples, LayerTrainingData& trainingData, LayerInferenceData& inferenceData, const AZ::VectorN& expected) const;
+
+        //! Accumulates weight, bias and back-propagation gradients from activation gradients already stored in trainingData.m_activationGradients.
+        //! This is used directly when the activation derivative has been fused with the loss derivative.
+        void AccumulateActivationGradients(AZStd::size_t samples, LayerTrainingData& trainingData) const;
 
         //! Applies the current gradient values to the layers weights and biases and resets the gradient values for a new accumulation pass.
         void ApplyGradients(LayerTrainingData& trainingData, float learningRate);
 
+        //! Applies the current gradient values to the layers weights and biases using the requested optimizer, writing the updated parameters to the output layer.
+        //! This leaves the parameters of this layer untouched so that they may continue to be read while the output layer is written.
+        //! The output layer must share the same dimensionality as this layer, it may also be this layer.
+        //! Any optimizer moment estimates are stored in and updated within the training data.
+        //! @param step the one-based index of the current gradient descent step, used for bias correction by the Adam optimizers
+        void ApplyGradients(LayerTrainingData& trainingData, const OptimizerParameters& optimizer, AZStd::size_t step, float learningRate, Layer& output) const;
+
         //! Base serialize method for all serializable structures or classes to implement.
         //! @param serializer ISerializer instance to use for serialization
         //! @return boolean true for success, false for serialization failure
@@ -82,5 +94,11 @@ namespace MachineLearning
         AZ::VectorN m_biasGradients;
         AZ::MatrixMxN m_weightGradients;
         AZ::VectorN m_backpropagationGradients;
+
+        // Optimizer moment estimates, these are only allocated if the selected optimizer requires them
+        AZ::MatrixMxN m_weightMoments;
+        AZ::MatrixMxN m_weightSecondMoments;
+        AZ::VectorN m_biasMoments;
+        AZ::VectorN m_biasSecondMoments;
     };
 }
@@ -16,17 +16,36 @@
 #include <AzCore/IO/FileReader.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 
 namespace MachineLearning
 {
+    //! Gradient descent may have published the parameters in the back buffer, while reflection only knows about m_layers.
+    //! Collapsing the parameter buffers before any reflected access makes serialization, the inspector and edits see the published parameters.
+    class MultilayerPerceptronSerializeEvents
+        : public AZ::SerializeContext::IEventHandler
+    {
+    public:
+        void OnReadBegin(void* classPtr) override
+        {
+            reinterpret_cast<MultilayerPerceptron*>(classPtr)->ResetParameterBuffers();
+        }
+
+        void OnWriteBegin(void* classPtr) override
+        {
+            reinterpret_cast<MultilayerPerceptron*>(classPtr)->ResetParameterBuffers();
+        }
+    };
+
     void MultilayerPerceptron::Reflect(AZ::ReflectContext* context)
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<MultilayerPerceptron>()
                 ->Version(1)
+                ->EventHandler<MultilayerPerceptronSerializeEvents>()
                 ->Field("Name", &MultilayerPerceptron::m_name)
                 ->Field("TestDataFile", &MultilayerPerceptron::m_testDataFile)
                 ->Field("TestLabelFile", &MultilayerPerceptron::m_testLabelFile)
@@ -65,7 +84,7 @@ namespace MachineLearning
                 Method("GetName", &MultilayerPerceptron::GetName)->
                 Method("GetLayerCount", &MultilayerPerceptron::GetLayerCount)->
                 Property("ActivationCount", BehaviorValueProperty(&MultilayerPerceptron::m_activationCount))->
-                Property("Layers", BehaviorValueProperty(&MultilayerPerceptron::m_layers))
+                Property("Layers", &MultilayerPerceptron::GetLayers, &MultilayerPerceptron::SetLayers)
                 ;
         }
     }
@@ -81,7 +100,7 @@ namespace MachineLearning
         , m_trainDataFile(rhs.m_trainDataFile)
         , m_trainLabelFile(rhs.m_trainLabelFile)
         , m_activationCount(rhs.m_activationCount)
-        , m_layers(rhs.m_layers)
+        , m_layers(rhs.GetLayers())
     {
     }
 
@@ -96,23 +115,26 @@ namespace MachineLearning
 
     MultilayerPerceptron& MultilayerPerceptron::operator=(const MultilayerPerceptron& rhs)
     {
+        ResetParameterBuffers();
         m_name = rhs.m_name;
         m_testDataFile = rhs.m_testDataFile;
         m_testLabelFile = rhs.m_testLabelFile;
         m_trainDataFile = rhs.m_trainDataFile;
         m_trainLabelFile = rhs.m_trainLabelFile;
         m_activationCount = rhs.m_activationCount;
-        m_layers = rhs.m_layers;
+        m_layers = rhs.GetLayers();
         OnActivationCountChanged();
         return *this;
     }
 
     MultilayerPerceptron& MultilayerPerceptron::operator=(const ModelAsset& asset)
     {
+        ResetParameterBuffers();
         m_name = asset.m_name;
         m_activationCount = asset.m_activationCount;
+
+        // The asset holds trained parameters, so unlike a topology change these must not be reinitialized
         m_layers = asset.m_layers;
-        OnActivationCountChanged();
         return *this;
     }
 
@@ -144,9 +166,10 @@ namespace MachineLearning
 
     AZStd::size_t MultilayerPerceptron::GetOutputDimensionality() const
     {
-        if (!m_layers.empty())
+        const AZStd::vector<Layer>& layers = GetLayers();
+        if (!layers.empty())
         {
-            return m_layers.back().m_biases.GetDimensionality();
+            return layers.back().m_biases.GetDimensionality();
         }
         return m_activationCount;
     }
@@ -158,12 +181,12 @@ namespace MachineLearning
 
     AZ::MatrixMxN MultilayerPerceptron::GetLayerWeights(AZStd::size_t layerIndex) const
     {
-        return m_layers[layerIndex].m_weights;
+        return GetLayers()[layerIndex].m_weights;
     }
 
     AZ::VectorN MultilayerPerceptron::GetLayerBiases(AZStd::size_t layerIndex) const
     {
-        return m_layers[layerIndex].m_biases;
+        return GetLayers()[layerIndex].m_biases;
     }
 
     AZStd::size_t MultilayerPerceptron::GetParameterCount() const
@@ -189,14 +212,21 @@ namespace MachineLearning
     const AZ::VectorN* MultilayerPerceptron::Forward(IInferenceContextPtr context, const AZ::VectorN& activations)
     {
         MlpInferenceContext* forwardContext = static_cast<MlpInferenceContext*>(context);
-        forwardContext->m_layerData.resize(m_layers.size());
+
+        // Pin the published parameters for the duration of the forward pass, gradient descent will not write to them until they are released
+        const AZStd::size_t parameterVersion = AcquireParameters();
+        const AZStd::vector<Layer>& layers = GetLayerBuffer(parameterVersion);
+        forwardContext->m_parameterVersion = parameterVersion;
+        forwardContext->m_layerData.resize(layers.size());
 
         const AZ::VectorN* lastLayerOutput = &activations;
-        for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+        for (AZStd::size_t iter = 0; iter < layers.size(); ++iter)
         {
-            m_layers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
+            layers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
             lastLayerOutput = &forwardContext->m_layerData[iter].m_output;
         }
+
+        ReleaseParameters(parameterVersion);
         return lastLayerOutput;
     }
 
@@ -204,29 +234,49 @@ namespace MachineLearning
     {
         MlpTrainingContext* reverseContext = static_cast<MlpTrainingContext*>(context);
         MlpInferenceContext* forwardContext = &reverseContext->m_forward;
-        reverseContext->m_layerData.resize(m_layers.size());
-        forwardContext->m_layerData.resize(m_layers.size());
+
+        // The training thread is the only writer of the parameter buffers and only ever writes to the back buffer, so the published parameters can be read without pinning
+        const AZStd::size_t parameterVersion = m_parameterVersion.load();
+        const AZStd::vector<Layer>& layers = GetLayerBuffer(parameterVersion);
+        forwardContext->m_parameterVersion = parameterVersion;
+        reverseContext->m_layerData.resize(layers.size());
+        forwardContext->m_layerData.resize(layers.size());
 
         ++reverseContext->m_trainingSampleSize;
 
         // First feed-forward the activations to get our current model predictions
         // We do additional book-keeping over a standard forward pass to make gradient calculations easier
         const AZ::VectorN* lastLayerOutput = &activations;
-        for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+        for (AZStd::size_t iter = 0; iter < layers.size(); ++iter)
         {
             reverseContext->m_layerData[iter].m_lastInput = lastLayerOutput;
-            m_layers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
+            layers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
             lastLayerOutput = &forwardContext->m_layerData[iter].m_output;
         }
 
+        if (layers.empty())
+        {
+            return;
+        }
+
         // Compute the partial derivatives of the loss function with respect to the final layer output
-        AZ::VectorN costGradients;
-        ComputeLoss_Derivative(lossFunction, *lastLayerOutput, expected, costGradients);
+        const int64_t lastLayer = static_cast<int64_t>(layers.size()) - 1;
+        if (HasFusedLoss_Derivative(layers[lastLayer].m_activationFunction, lossFunction))
+        {
+            // The activation and loss derivatives are fused, so this writes gradients with respect to the final layer's pre-activation output directly
+            SoftmaxCrossEntropy_Derivative(expected, *lastLayerOutput, reverseContext->m_layerData[lastLayer].m_activationGradients);
+            layers[lastLayer].AccumulateActivationGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[lastLayer]);
+        }
+        else
+        {
+            ComputeLoss_Derivative(lossFunction, expected, *lastLayerOutput, reverseContext->m_costGradients);
+            layers[lastLayer].AccumulateGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[lastLayer], forwardContext->m_layerData[lastLayer], reverseContext->m_costGradients);
+        }
 
-        AZ::VectorN* lossGradient = &costGradients;
-        for (int64_t iter = static_cast<int64_t>(m_layers.size()) - 1; iter >= 0; --iter)
+        const AZ::VectorN* lossGradient = &reverseContext->m_layerData[lastLayer].m_backpropagationGradients;
+        for (int64_t iter = lastLayer - 1; iter >= 0; --iter)
         {
-            m_layers[iter].AccumulateGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[iter], forwardContext->m_layerData[iter], *lossGradient);
+            layers[iter].AccumulateGradients(reverseContext->m_trainingSampleSize, reverseContext->m_layerData[iter], forwardContext->m_layerData[iter], *lossGradient);
             lossGradient = &reverseContext->m_layerData[iter].m_backpropagationGradients;
         }
     }
@@ -236,16 +286,56 @@ namespace MachineLearning
         MlpTrainingContext* reverseContext = static_cast<MlpTrainingContext*>(context);
         if (reverseContext->m_trainingSampleSize > 0)
         {
-            for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+            const AZStd::size_t frontVersion = m_parameterVersion.load();
+            const AZStd::size_t backVersion = frontVersion + 1;
+            const AZStd::vector<Layer>& frontLayers = GetLayerBuffer(frontVersion);
+            AZStd::vector<Layer>& backLayers = GetLayerBuffer(backVersion);
+
+            // Wait for any readers still pinning the previous parameter version to finish, this only ever stalls the training thread
+            while (m_parameterReaders[backVersion & 1].load() > 0)
             {
-                m_layers[iter].ApplyGradients(reverseContext->m_layerData[iter], learningRate);
+                AZStd::this_thread::yield();
             }
+
+            if (backLayers.size() != frontLayers.size())
+            {
+                backLayers = frontLayers;
+            }
+
+            // Moment estimates accumulated by a different optimizer are meaningless, so discard them and restart bias correction
+            const OptimizerParameters& optimizer = reverseContext->m_optimizerParameters;
+            if (optimizer.m_optimizer != reverseContext->m_optimizerStateType)
+            {
+                for (LayerTrainingData& layerData : reverseContext->m_layerData)
+                {
+                    layerData.m_weightMoments = AZ::MatrixMxN();
+                    layerData.m_weightSecondMoments = AZ::MatrixMxN();
+                    layerData.m_biasMoments = AZ::VectorN();
+                    layerData.m_biasSecondMoments = AZ::VectorN();
+                }
+                reverseContext->m_optimizerStep = 0;
+                reverseContext->m_optimizerStateType = optimizer.m_optimizer;
+            }
+            ++reverseContext->m_optimizerStep;
+
+            for (AZStd::size_t iter = 0; iter < frontLayers.size(); ++iter)
+            {
+                frontLayers[iter].ApplyGradients(reverseContext->m_layerData[iter], optimizer, reverseContext->m_optimizerStep, learningRate, backLayers[iter]);
+            }
+
+            // Publish the updated parameters, new readers will pin the back buffer from here on
+            m_parameterVersion.store(backVersion);
         }
         reverseContext->m_trainingSampleSize = 0;
     }
 
     void MultilayerPerceptron::OnActivationCountChanged()
     {
+        // All layer parameters are reinitialized below, so rather than consolidating the parameter buffers we simply discard the back buffer
+        // This is required as edit context changes are applied directly to m_layers
+        m_backLayers.clear();
+        m_parameterVersion.store(0);
+
         AZStd::size_t lastLayerDimensionality = m_activationCount;
         for (Layer& layer : m_layers)
         {
@@ -276,6 +366,7 @@ namespace MachineLearning
     void MultilayerPerceptron::AddLayer(AZStd::size_t layerDimensionality, ActivationFunctions activationFunction)
     {
         // This is not thread safe, this should only be used during model configuration
+        ResetParameterBuffers();
         const AZStd::size_t lastLayerDimensionality = GetOutputDimensionality();
         m_layers.push_back(AZStd::move(Layer(activationFunction, lastLayerDimensionality, layerDimensionality)));
     }
@@ -283,6 +374,61 @@ namespace MachineLearning
     Layer* MultilayerPerceptron::GetLayer(AZStd::size_t layerIndex)
     {
         // This is not thread safe, this method should only be used by unit testing to inspect layer weights and biases for correctness
-        return &m_layers[layerIndex];
+        return &GetLayerBuffer(m_parameterVersion.load())[layerIndex];
+    }
+
+    const AZStd::vector<Layer>& MultilayerPerceptron::GetLayers() const
+    {
+        return ((m_parameterVersion.load() & 1) == 0) ? m_layers : m_backLayers;
+    }
+
+    void MultilayerPerceptron::SetLayers(const AZStd::vector<Layer>& layers)
+    {
+        // This is not thread safe, this should only be used during model configuration
+        ResetParameterBuffers();
+        m_layers = layers;
+    }
+
+    AZStd::size_t MultilayerPerceptron::GetParameterVersion() const
+    {
+        return m_parameterVersion.load();
+    }
+
+    AZStd::size_t MultilayerPerceptron::AcquireParameters() const
+    {
+        for (;;)
+        {
+            const AZStd::size_t parameterVersion = m_parameterVersion.load();
+            m_parameterReaders[parameterVersion & 1].fetch_add(1);
+
+            // If a new version was published before we registered as a reader, gradient descent may already be writing to the buffer we pinned
+            // In that case release it and retry against the newly published version
+            if (m_parameterVersion.load() == parameterVersion)
+            {
+                return parameterVersion;
+            }
+            m_parameterReaders[parameterVersion & 1].fetch_sub(1);
+        }
+    }
+
+    void MultilayerPerceptron::ReleaseParameters(AZStd::size_t parameterVersion) const
+    {
+        m_parameterReaders[parameterVersion & 1].fetch_sub(1);
+    }
+
+    AZStd::vector<Layer>& MultilayerPerceptron::GetLayerBuffer(AZStd::size_t parameterVersion)
+    {
+        return ((parameterVersion & 1) == 0) ? m_layers : m_backLayers;
+    }
+
+    void MultilayerPerceptron::ResetParameterBuffers()
+    {
+        // This is not thread safe, this should only be used during model configuration
+        if ((m_parameterVersion.load() & 1) != 0)
+        {
+            m_layers.swap(m_backLayers);
+        }
+        m_backLayers.clear();
+        m_parameterVersion.store(0);
     }
 }
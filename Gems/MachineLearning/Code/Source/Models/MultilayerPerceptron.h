@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Math/MatrixMxN.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <MachineLearning/INeuralNetwork.h>
 #include <Models/Layer.h>
 #include <Assets/ModelAsset.h>
@@ -16,6 +17,8 @@
 namespace MachineLearning
 {
     //! This is a basic multilayer perceptron neural network capable of basic training and feed forward operations.
+    //! Layer weights and biases are double buffered, gradient descent writes to the back buffer and then publishes it with an atomic version increment.
+    //! This allows Forward to be invoked from any number of threads without locking while a single training thread runs Reverse and GradientDescent.
     class MultilayerPerceptron
         : public INeuralNetwork
     {
@@ -58,12 +61,35 @@ namespace MachineLearning
         void AddLayer(AZStd::size_t layerDimensionality, ActivationFunctions activationFunction = ActivationFunctions::ReLU);
 
         //! Retrieves a specific layer from the model, this is not thread safe and should only be used during unit testing to validate model parameters.
+        //! The returned layer belongs to the currently published parameter buffer, it will be recycled as the back buffer by the next gradient descent step.
         Layer* GetLayer(AZStd::size_t layerIndex);
 
+        //! Returns the set of layers holding the currently published parameters, this is not thread safe with respect to gradient descent.
+        const AZStd::vector<Layer>& GetLayers() const;
+
+        //! Replaces all layers and their parameters, this is not thread safe and should only be used during model configuration.
+        void SetLayers(const AZStd::vector<Layer>& layers);
+
+        //! Returns the current parameter version, this is incremented each time gradient descent publishes a new set of parameters.
+        AZStd::size_t GetParameterVersion() const;
+
     private:
 
         void OnActivationCountChanged();
 
+        //! Pins the currently published parameter buffer so that gradient descent will not write to it, returns the pinned parameter version.
+        AZStd::size_t AcquireParameters() const;
+
+        //! Releases a parameter buffer previously pinned by AcquireParameters.
+        void ReleaseParameters(AZStd::size_t parameterVersion) const;
+
+        //! Returns the layer buffer holding the parameters for the requested parameter version.
+        AZStd::vector<Layer>& GetLayerBuffer(AZStd::size_t parameterVersion);
+
+        //! Collapses the parameter double buffer back into m_layers, this is not thread safe and is only used when the model topology changes
+        //! or before the reflected layers are accessed.
+        void ResetParameterBuffers();
+
         //! The model name.
         AZStd::string m_name;
 
@@ -77,15 +103,29 @@ namespace MachineLearning
         AZStd::size_t m_activationCount = 0;
 
         //! The set of layers in the network.
+        //! This is parameter buffer zero and also holds the reflected model configuration.
         AZStd::vector<Layer> m_layers;
 
+        //! Parameter buffer one, this is lazily allocated by the first gradient descent step after any topology change.
+        AZStd::vector<Layer> m_backLayers;
+
+        //! The currently published parameter version, the low bit selects the published parameter buffer.
+        AZStd::atomic<AZStd::size_t> m_parameterVersion = 0;
+
+        //! The number of readers currently pinning each parameter buffer.
+        mutable AZStd::atomic<AZStd::size_t> m_parameterReaders[2] = { 0, 0 };
+
         IAssetPersistenceProxy* m_proxy = nullptr;
         friend class MultilayerPerceptronEditorComponent;
+        friend class MultilayerPerceptronSerializeEvents;
     };
 
     struct MlpInferenceContext
         : public IInferenceContext
     {
+        //! The parameter version used to compute the most recent forward pass.
+        AZStd::size_t m_parameterVersion = 0;
+
         AZStd::vector<LayerInferenceData> m_layerData;
     };
 
@@ -98,7 +138,16 @@ namespace MachineLearning
         //! The number of accumulated training samples.
         AZStd::size_t m_trainingSampleSize = 0;
 
+        //! The number of gradient descent steps applied using the current optimizer state.
+        AZStd::size_t m_optimizerStep = 0;
+
+        //! The optimizer that produced the moment estimates currently held in the layer training data.
+        OptimizerTypes m_optimizerStateType = OptimizerTypes::Sgd;
+
         //! The set of layer training data.
         AZStd::vector<LayerTrainingData> m_layerData;
+
+        //! The partial derivatives of the loss with respect to the final layer output, kept here to avoid reallocating each sample.
+        AZ::VectorN m_costGradients;
     };
 }
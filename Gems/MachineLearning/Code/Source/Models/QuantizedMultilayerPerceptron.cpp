@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Models/QuantizedMultilayerPerceptron.h>
+#include <Algorithms/Activations.h>
+
+namespace MachineLearning
+{
+    static void ExpandRange(const AZ::VectorN& source, float& min, float& max)
+    {
+        for (AZStd::size_t iter = 0; iter < source.GetDimensionality(); ++iter)
+        {
+            min = AZ::GetMin(min, source.GetElement(iter));
+            max = AZ::GetMax(max, source.GetElement(iter));
+        }
+    }
+
+    QuantizedLayer::QuantizedLayer(const Layer& layer, float inputMin, float inputMax)
+        : m_inputSize(layer.m_inputSize)
+        , m_outputSize(layer.m_outputSize)
+        , m_paddedInputSize(((layer.m_inputSize + QuantizedBlockSize - 1) / QuantizedBlockSize) * QuantizedBlockSize)
+        , m_inputQuantization(ComputeQuantizationParameters(inputMin, inputMax))
+        , m_biases(layer.m_biases)
+        , m_activationFunction(layer.m_activationFunction)
+    {
+        float weightMin = 0.0f;
+        float weightMax = 0.0f;
+        for (AZStd::size_t row = 0; row < m_outputSize; ++row)
+        {
+            for (AZStd::size_t col = 0; col < m_inputSize; ++col)
+            {
+                const float weight = layer.m_weights.GetElement(row, col);
+                weightMin = AZ::GetMin(weightMin, weight);
+                weightMax = AZ::GetMax(weightMax, weight);
+            }
+        }
+        m_weightQuantization = ComputeQuantizationParameters(weightMin, weightMax);
+
+        // Padding elements are zero, the zero points of both weights and inputs are corrected for using the row and input sums during inference
+        m_weights.resize(m_outputSize * m_paddedInputSize, 0);
+        m_weightRowSums.resize(m_outputSize, 0);
+        for (AZStd::size_t row = 0; row < m_outputSize; ++row)
+        {
+            int8_t* rowWeights = m_weights.data() + row * m_paddedInputSize;
+            for (AZStd::size_t col = 0; col < m_inputSize; ++col)
+            {
+                rowWeights[col] = QuantizeValue(layer.m_weights.GetElement(row, col), m_weightQuantization);
+                m_weightRowSums[row] += rowWeights[col];
+            }
+        }
+    }
+
+    const AZ::VectorN& QuantizedLayer::Forward(QuantizedLayerInferenceData& inferenceData, const AZ::VectorN& activations) const
+    {
+        const int32_t inputSum = QuantizeVector(activations, m_inputQuantization, inferenceData.m_quantizedInput);
+
+        // With real = scale * (quantized - zeroPoint) for both weights and inputs, the real dot product expands to
+        // scale_w * scale_i * (sum(q_w * q_i) - zeroPoint_w * sum(q_i) - zeroPoint_i * sum(q_w) + n * zeroPoint_w * zeroPoint_i)
+        const int32_t weightZeroPoint = m_weightQuantization.m_zeroPoint;
+        const int32_t inputZeroPoint = m_inputQuantization.m_zeroPoint;
+        const int32_t zeroPointCorrection = static_cast<int32_t>(m_inputSize) * weightZeroPoint * inputZeroPoint - weightZeroPoint * inputSum;
+        const float outputScale = m_weightQuantization.m_scale * m_inputQuantization.m_scale;
+
+        inferenceData.m_output = m_biases;
+        for (AZStd::size_t row = 0; row < m_outputSize; ++row)
+        {
+            const int8_t* rowWeights = m_weights.data() + row * m_paddedInputSize;
+            const int32_t dotProduct = DotProductInt8(rowWeights, inferenceData.m_quantizedInput.data(), m_paddedInputSize);
+            const int32_t accumulator = dotProduct + zeroPointCorrection - inputZeroPoint * m_weightRowSums[row];
+            inferenceData.m_output.SetElement(row, inferenceData.m_output.GetElement(row) + outputScale * static_cast<float>(accumulator));
+        }
+
+        Activate(m_activationFunction, inferenceData.m_output, inferenceData.m_output);
+        return inferenceData.m_output;
+    }
+
+    AZStd::size_t QuantizedLayer::GetParameterBytes() const
+    {
+        return m_weights.size() * sizeof(int8_t)
+             + m_weightRowSums.size() * sizeof(int32_t)
+             + m_outputSize * sizeof(float) // m_biases
+             + sizeof(m_weightQuantization)
+             + sizeof(m_inputQuantization);
+    }
+
+    bool QuantizedMultilayerPerceptron::Quantize(MultilayerPerceptron& model, ILabeledTrainingData& calibrationData, AZStd::size_t maxCalibrationSamples)
+    {
+        const AZStd::vector<Layer>& layers = model.GetLayers();
+        AZStd::size_t sampleCount = calibrationData.GetSampleCount();
+        if (maxCalibrationSamples > 0)
+        {
+            sampleCount = AZ::GetMin(sampleCount, maxCalibrationSamples);
+        }
+
+        if (layers.empty() || sampleCount == 0)
+        {
+            return false;
+        }
+
+        // Calibration pass, record the range of the input activations for each layer by running the float model over the calibration data
+        // Ranges start at zero as quantization ranges must always be able to represent zero exactly
+        AZStd::vector<float> inputMins(layers.size(), 0.0f);
+        AZStd::vector<float> inputMaxs(layers.size(), 0.0f);
+        MlpInferenceContext calibrationContext;
+        for (AZStd::size_t sample = 0; sample < sampleCount; ++sample)
+        {
+            const AZ::VectorN& activations = calibrationData.GetDataByIndex(sample);
+            model.Forward(&calibrationContext, activations);
+            ExpandRange(activations, inputMins[0], inputMaxs[0]);
+            for (AZStd::size_t iter = 1; iter < layers.size(); ++iter)
+            {
+                ExpandRange(calibrationContext.m_layerData[iter - 1].m_output, inputMins[iter], inputMaxs[iter]);
+            }
+        }
+
+        m_name = model.GetName();
+        m_activationCount = model.GetInputDimensionality();
+        m_layers.clear();
+        m_layers.reserve(layers.size());
+        for (AZStd::size_t iter = 0; iter < layers.size(); ++iter)
+        {
+            m_layers.emplace_back(layers[iter], inputMins[iter], inputMaxs[iter]);
+        }
+        return true;
+    }
+
+    AZStd::string QuantizedMultilayerPerceptron::GetName() const
+    {
+        return m_name;
+    }
+
+    AZStd::size_t QuantizedMultilayerPerceptron::GetInputDimensionality() const
+    {
+        return m_activationCount;
+    }
+
+    AZStd::size_t QuantizedMultilayerPerceptron::GetOutputDimensionality() const
+    {
+        if (!m_layers.empty())
+        {
+            return m_layers.back().m_outputSize;
+        }
+        return m_activationCount;
+    }
+
+    AZStd::size_t QuantizedMultilayerPerceptron::GetLayerCount() const
+    {
+        return m_layers.size();
+    }
+
+    AZStd::size_t QuantizedMultilayerPerceptron::GetParameterCount() const
+    {
+        AZStd::size_t parameterCount = 0;
+        for (const QuantizedLayer& layer : m_layers)
+        {
+            parameterCount += layer.m_inputSize * layer.m_outputSize + layer.m_outputSize;
+        }
+        return parameterCount;
+    }
+
+    IInferenceContextPtr QuantizedMultilayerPerceptron::CreateInferenceContext()
+    {
+        return new QuantizedMlpInferenceContext();
+    }
+
+    const AZ::VectorN* QuantizedMultilayerPerceptron::Forward(IInferenceContextPtr context, const AZ::VectorN& activations)
+    {
+        QuantizedMlpInferenceContext* forwardContext = static_cast<QuantizedMlpInferenceContext*>(context);
+        forwardContext->m_layerData.resize(m_layers.size());
+
+        const AZ::VectorN* lastLayerOutput = &activations;
+        for (AZStd::size_t iter = 0; iter < m_layers.size(); ++iter)
+        {
+            m_layers[iter].Forward(forwardContext->m_layerData[iter], *lastLayerOutput);
+            lastLayerOutput = &forwardContext->m_layerData[iter].m_output;
+        }
+        return lastLayerOutput;
+    }
+
+    AZStd::size_t QuantizedMultilayerPerceptron::GetParameterBytes() const
+    {
+        AZStd::size_t parameterBytes = 0;
+        for (const QuantizedLayer& layer : m_layers)
+        {
+            parameterBytes += layer.GetParameterBytes();
+        }
+        return parameterBytes;
+    }
+
+    const QuantizedLayer* QuantizedMultilayerPerceptron::GetLayer(AZStd::size_t layerIndex) const
+    {
+        return &m_layers[layerIndex];
+    }
+}
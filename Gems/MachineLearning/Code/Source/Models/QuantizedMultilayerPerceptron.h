@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <MachineLearning/INeuralNetwork.h>
+#include <MachineLearning/ILabeledTrainingData.h>
+#include <Algorithms/Quantization.h>
+#include <Models/MultilayerPerceptron.h>
+
+namespace MachineLearning
+{
+    struct QuantizedLayerInferenceData;
+
+    //! A single layer of a neural network with int8 quantized weights, suitable only for inference.
+    //! Weights are stored row major with each row zero padded to a multiple of QuantizedBlockSize.
+    class QuantizedLayer
+    {
+    public:
+
+        AZ_TYPE_INFO(QuantizedLayer, "{0B5E1F6A-3D2C-4E79-9C1B-7A4D8E2F6C31}");
+
+        QuantizedLayer() = default;
+
+        //! Quantizes the provided float layer, inputMin and inputMax are the calibrated range of the layers input activations.
+        QuantizedLayer(const Layer& layer, float inputMin, float inputMax);
+
+        //! Performs a forward pass on this layer, outputs are dequantized to float and stored in m_output.
+        const AZ::VectorN& Forward(QuantizedLayerInferenceData& inferenceData, const AZ::VectorN& activations) const;
+
+        //! Returns the number of bytes used to store the layer parameters.
+        AZStd::size_t GetParameterBytes() const;
+
+        AZStd::size_t m_inputSize = 0;
+        AZStd::size_t m_outputSize = 0;
+        AZStd::size_t m_paddedInputSize = 0;
+        QuantizationParameters m_weightQuantization;
+        QuantizationParameters m_inputQuantization;
+        AZStd::vector<int8_t> m_weights;
+        AZStd::vector<int32_t> m_weightRowSums;
+        AZ::VectorN m_biases;
+        ActivationFunctions m_activationFunction = ActivationFunctions::ReLU;
+    };
+
+    //! These values are written to during quantized inference.
+    struct QuantizedLayerInferenceData
+    {
+        AZStd::vector<int8_t> m_quantizedInput;
+        AZ::VectorN m_output;
+    };
+
+    //! An inference-only multilayer perceptron using int8 quantized weights and activations.
+    //! This is generated from a trained MultilayerPerceptron and a set of calibration data, which is used to determine the range of each layers input activations.
+    class QuantizedMultilayerPerceptron
+        : public INeuralNetwork
+    {
+    public:
+
+        AZ_RTTI(QuantizedMultilayerPerceptron, "{8C2A4F71-5E0B-4D63-A1F8-3B9E7D2C5A14}", INeuralNetwork);
+
+        QuantizedMultilayerPerceptron() = default;
+        virtual ~QuantizedMultilayerPerceptron() = default;
+
+        //! Quantizes the provided model, calibrating activation ranges using up to maxCalibrationSamples samples from the calibration data.
+        //! A maxCalibrationSamples of zero will use the entire calibration data set.
+        bool Quantize(MultilayerPerceptron& model, ILabeledTrainingData& calibrationData, AZStd::size_t maxCalibrationSamples = 0);
+
+        //! INeuralNetwork interface
+        //! @{
+        AZStd::string GetName() const override;
+        AZStd::size_t GetInputDimensionality() const override;
+        AZStd::size_t GetOutputDimensionality() const override;
+        AZStd::size_t GetLayerCount() const override;
+        AZStd::size_t GetParameterCount() const override;
+        IInferenceContextPtr CreateInferenceContext() override;
+        const AZ::VectorN* Forward(IInferenceContextPtr context, const AZ::VectorN& activations) override;
+        //! @}
+
+        //! Returns the total number of bytes used to store the model parameters.
+        AZStd::size_t GetParameterBytes() const;
+
+        //! Retrieves a specific layer from the model, this should only be used during unit testing to validate model parameters.
+        const QuantizedLayer* GetLayer(AZStd::size_t layerIndex) const;
+
+    private:
+
+        //! The model name.
+        AZStd::string m_name;
+
+        //! The number of neurons in the activation layer.
+        AZStd::size_t m_activationCount = 0;
+
+        //! The set of quantized layers in the network.
+        AZStd::vector<QuantizedLayer> m_layers;
+    };
+
+    struct QuantizedMlpInferenceContext
+        : public IInferenceContext
+    {
+        AZStd::vector<QuantizedLayerInferenceData> m_layerData;
+    };
+}
@@ -25,10 +25,22 @@ namespace MachineLearning
         AZStd::size_t BatchSize,
         float LearningRate,
         float LearningRateDecay,
-        float EarlyStopCost
+        float EarlyStopCost,
+        AZStd::size_t Optimizer
     )
     {
-        SupervisedLearningCycle trainingInstance(Model, TrainingData, TestData, static_cast<LossFunctions>(CostFunction), TotalIterations, BatchSize, LearningRate, LearningRateDecay, EarlyStopCost);
+        // The optimizer pin is a plain integer, so reject values outside of the enumeration rather than training with an unknown optimizer
+        OptimizerTypes optimizer = OptimizerTypes::Sgd;
+        if (Optimizer <= static_cast<AZStd::size_t>(OptimizerTypes::AdamW))
+        {
+            optimizer = static_cast<OptimizerTypes>(Optimizer);
+        }
+        else
+        {
+            AZLOG_ERROR("Unknown optimizer %zu, expected a value from 0 to %zu, falling back to SGD", Optimizer, static_cast<AZStd::size_t>(OptimizerTypes::AdamW));
+        }
+
+        SupervisedLearningCycle trainingInstance(Model, TrainingData, TestData, static_cast<LossFunctions>(CostFunction), optimizer, TotalIterations, BatchSize, LearningRate, LearningRateDecay, EarlyStopCost);
 
         trainingInstance.StartTraining();
         while (!trainingInstance.m_trainingComplete)
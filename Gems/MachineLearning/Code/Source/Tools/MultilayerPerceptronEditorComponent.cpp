@@ -177,7 +177,7 @@ namespace MachineLearning
         {
             m_asset->m_name = m_model.m_name;
             m_asset->m_activationCount = m_model.m_activationCount;
-            m_asset->m_layers = m_model.m_layers;
+            m_asset->m_layers = m_model.GetLayers();
             return m_asset.Save();
         }
 
@@ -196,7 +196,7 @@ namespace MachineLearning
         m_asset = CreateOrFindAsset<ModelAsset>(absolutePath, m_asset.GetAutoLoadBehavior());
         m_asset->m_name = m_model.m_name;
         m_asset->m_activationCount = m_model.m_activationCount;
-        m_asset->m_layers = m_model.m_layers;
+        m_asset->m_layers = m_model.GetLayers();
 
         AZ::Data::AssetBus::Handler::BusDisconnect();
         AZ::Data::AssetBus::Handler::BusConnect(m_asset.GetId());
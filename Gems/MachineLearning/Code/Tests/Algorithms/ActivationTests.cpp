@@ -9,6 +9,8 @@
 #include <AzTest/AzTest.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <Algorithms/Activations.h>
+#include <AzCore/std/math.h>
+#include <cmath>
 
 namespace UnitTest
 {
@@ -109,4 +111,176 @@ namespace UnitTest
             ASSERT_EQ(output.GetElement(iter), sourceVector.GetElement(iter));
         }
     }
+
+    TEST_F(MachineLearning_Activations, TestExpApproximateAccuracy)
+    {
+        // Sweep the full supported input range and compare against a double precision reference
+        float maxRelativeError = 0.0f;
+        for (float value = -87.0f; value <= 88.0f; value += 0.01f)
+        {
+            const AZ::Vector4 approximate(MachineLearning::ExpApproximate(AZ::Simd::Vec4::Splat(value)));
+            const double reference = AZStd::exp(static_cast<double>(value));
+            const float relativeError = static_cast<float>(AZStd::abs((static_cast<double>(approximate.GetX()) - reference) / reference));
+            maxRelativeError = AZ::GetMax(maxRelativeError, relativeError);
+        }
+        EXPECT_LT(maxRelativeError, 2.0e-7f);
+
+        // Out of range inputs are clamped rather than overflowing to infinity or flushing to zero
+        const AZ::Vector4 large(MachineLearning::ExpApproximate(AZ::Simd::Vec4::Splat(1000.0f)));
+        const AZ::Vector4 small(MachineLearning::ExpApproximate(AZ::Simd::Vec4::Splat(-1000.0f)));
+        EXPECT_LE(AZStd::abs(large.GetX()), AZ::Constants::FloatMax);
+        EXPECT_GT(small.GetX(), 0.0f);
+    }
+
+    TEST_F(MachineLearning_Activations, TestSigmoidApproximateAccuracy)
+    {
+        float maxAbsoluteError = 0.0f;
+        for (float value = -100.0f; value <= 100.0f; value += 0.01f)
+        {
+            const AZ::Vector4 approximate(MachineLearning::SigmoidApproximate(AZ::Simd::Vec4::Splat(value)));
+            const double reference = 1.0 / (1.0 + AZStd::exp(-static_cast<double>(value)));
+            maxAbsoluteError = AZ::GetMax(maxAbsoluteError, static_cast<float>(AZStd::abs(static_cast<double>(approximate.GetX()) - reference)));
+        }
+        EXPECT_LT(maxAbsoluteError, 2.0e-7f);
+    }
+
+    TEST_F(MachineLearning_Activations, TestSoftmaxAccuracy)
+    {
+        // 10 elements leaves unused elements in the last vector, which must not contribute to the distribution
+        AZ::VectorN output;
+        AZ::VectorN sourceVector = AZ::VectorN::CreateRandom(10);
+        sourceVector *= 200.0f;
+        sourceVector -= 100.0f;
+        MachineLearning::Softmax(sourceVector, output);
+
+        double max = sourceVector.GetElement(0);
+        for (AZStd::size_t iter = 1; iter < sourceVector.GetDimensionality(); ++iter)
+        {
+            max = AZ::GetMax(max, static_cast<double>(sourceVector.GetElement(iter)));
+        }
+
+        double sum = 0.0;
+        for (AZStd::size_t iter = 0; iter < sourceVector.GetDimensionality(); ++iter)
+        {
+            sum += AZStd::exp(static_cast<double>(sourceVector.GetElement(iter)) - max);
+        }
+
+        for (AZStd::size_t iter = 0; iter < sourceVector.GetDimensionality(); ++iter)
+        {
+            const double reference = AZStd::exp(static_cast<double>(sourceVector.GetElement(iter)) - max) / sum;
+            EXPECT_NEAR(output.GetElement(iter), reference, 1.0e-6);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestSoftmaxLargeInputs)
+    {
+        // Inputs well beyond the range of exp must still produce a valid probability distribution
+        AZ::VectorN output;
+        AZ::VectorN sourceVector = AZ::VectorN::CreateZero(6);
+        sourceVector.SetElement(0, 10000.0f);
+        sourceVector.SetElement(1, 9999.0f);
+        sourceVector.SetElement(2, -10000.0f);
+        MachineLearning::Softmax(sourceVector, output);
+
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            EXPECT_LE(AZStd::abs(output.GetElement(iter)), AZ::Constants::FloatMax);
+        }
+        EXPECT_NEAR(output.L1Norm(), 1.0f, AZ::Constants::Tolerance);
+        EXPECT_NEAR(output.GetElement(0), 1.0f / (1.0f + AZStd::exp(-1.0f)), AZ::Constants::Tolerance);
+    }
+
+    TEST_F(MachineLearning_Activations, TestSoftmaxNegativeInputsPartialVector)
+    {
+        // With a dimensionality that isn't a multiple of 4, the unused elements of the last vector must not skew the sum
+        for (AZStd::size_t dimensionality : { 5, 7 })
+        {
+            AZ::VectorN output;
+            AZ::VectorN sourceVector = AZ::VectorN::CreateZero(dimensionality);
+            for (AZStd::size_t iter = 0; iter < dimensionality; ++iter)
+            {
+                sourceVector.SetElement(iter, -30.0f - static_cast<float>(iter));
+            }
+            MachineLearning::Softmax(sourceVector, output);
+
+            float sum = 0.0f;
+            for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+            {
+                EXPECT_TRUE(std::isfinite(output.GetElement(iter)));
+                EXPECT_GE(output.GetElement(iter), 0.0f);
+                sum += output.GetElement(iter);
+            }
+            EXPECT_NEAR(sum, 1.0f, AZ::Constants::Tolerance);
+        }
+    }
+
+    TEST_F(MachineLearning_Activations, TestSoftmaxDerivative)
+    {
+        AZ::VectorN sourceVector = AZ::VectorN::CreateRandom(7);
+        AZ::VectorN backGradients = AZ::VectorN::CreateRandom(7);
+        AZ::VectorN activationOutput;
+        AZ::VectorN output;
+        MachineLearning::Softmax(sourceVector, activationOutput);
+        MachineLearning::Softmax_Derivative(activationOutput, backGradients, output);
+
+        // Compare against an explicit product with the full softmax Jacobian
+        for (AZStd::size_t i = 0; i < activationOutput.GetDimensionality(); ++i)
+        {
+            float reference = 0.0f;
+            for (AZStd::size_t j = 0; j < activationOutput.GetDimensionality(); ++j)
+            {
+                const float delta = (i == j) ? 1.0f : 0.0f;
+                reference += activationOutput.GetElement(i) * (delta - activationOutput.GetElement(j)) * backGradients.GetElement(j);
+            }
+            EXPECT_NEAR(output.GetElement(i), reference, 1.0e-6f);
+        }
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class MachineLearning_ActivationsBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_F(MachineLearning_ActivationsBenchmark, BM_Sigmoid)(benchmark::State& state)
+    {
+        AZ::VectorN output = AZ::VectorN::CreateZero(1024);
+        AZ::VectorN sourceVector = AZ::VectorN::CreateRandom(1024);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Sigmoid(sourceVector, output);
+            benchmark::DoNotOptimize(output.GetVectorValues().data());
+        }
+        state.SetItemsProcessed(state.iterations() * sourceVector.GetDimensionality());
+    }
+
+    BENCHMARK_F(MachineLearning_ActivationsBenchmark, BM_Softmax)(benchmark::State& state)
+    {
+        AZ::VectorN output = AZ::VectorN::CreateZero(1024);
+        AZ::VectorN sourceVector = AZ::VectorN::CreateRandom(1024);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Softmax(sourceVector, output);
+            benchmark::DoNotOptimize(output.GetVectorValues().data());
+        }
+        state.SetItemsProcessed(state.iterations() * sourceVector.GetDimensionality());
+    }
+
+    BENCHMARK_F(MachineLearning_ActivationsBenchmark, BM_SoftmaxDerivative)(benchmark::State& state)
+    {
+        AZ::VectorN activationOutput;
+        AZ::VectorN output = AZ::VectorN::CreateZero(1024);
+        AZ::VectorN backGradients = AZ::VectorN::CreateRandom(1024);
+        MachineLearning::Softmax(AZ::VectorN::CreateRandom(1024), activationOutput);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Softmax_Derivative(activationOutput, backGradients, output);
+            benchmark::DoNotOptimize(output.GetVectorValues().data());
+        }
+        state.SetItemsProcessed(state.iterations() * activationOutput.GetDimensionality());
+    }
 }
+#endif
@@ -9,6 +9,8 @@
 #include <AzTest/AzTest.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <Algorithms/LossFunctions.h>
+#include <Algorithms/Activations.h>
+#include <AzCore/std/math.h>
 
 namespace UnitTest
 {
@@ -25,4 +27,127 @@ namespace UnitTest
         const float totalLoss1 = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::MeanSquaredError, expected, actual);
         EXPECT_EQ(totalLoss1, 1024.0f);
     }
+
+    TEST_F(MachineLearning_LossFunctions, TestMeanSquaredErrorDerivative)
+    {
+        AZ::VectorN expected = AZ::VectorN::CreateRandom(13);
+        AZ::VectorN actual = AZ::VectorN::CreateRandom(13);
+        AZ::VectorN output;
+        MachineLearning::ComputeLoss_Derivative(MachineLearning::LossFunctions::MeanSquaredError, expected, actual, output);
+
+        // The gradient points away from the expected values, so that gradient descent moves the actual values towards them
+        for (AZStd::size_t iter = 0; iter < output.GetDimensionality(); ++iter)
+        {
+            EXPECT_FLOAT_EQ(output.GetElement(iter), actual.GetElement(iter) - expected.GetElement(iter));
+        }
+    }
+
+    TEST_F(MachineLearning_LossFunctions, TestCrossEntropy)
+    {
+        AZ::VectorN expected;
+        MachineLearning::OneHotEncode(2, 10, expected);
+
+        AZ::VectorN actual = AZ::VectorN::CreateZero(10);
+        actual.SetElement(2, 0.25f);
+        actual.SetElement(5, 0.75f);
+
+        const float totalLoss = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CrossEntropy, expected, actual);
+        EXPECT_NEAR(totalLoss, -AZStd::log(0.25f), AZ::Constants::Tolerance);
+
+        // Zero probability for the expected label must not produce an infinite loss
+        actual.SetElement(2, 0.0f);
+        const float saturatedLoss = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CrossEntropy, expected, actual);
+        EXPECT_LE(AZStd::abs(saturatedLoss), AZ::Constants::FloatMax);
+    }
+
+    TEST_F(MachineLearning_LossFunctions, TestFusedSoftmaxCrossEntropy)
+    {
+        AZ::VectorN expected;
+        MachineLearning::OneHotEncode(3, 10, expected);
+
+        AZ::VectorN logits = AZ::VectorN::CreateRandom(10);
+        logits *= 10.0f;
+        logits -= 5.0f;
+
+        // The fused forward pass must match softmax followed by cross-entropy
+        AZ::VectorN fusedOutput;
+        const float fusedLoss = MachineLearning::SoftmaxCrossEntropy(expected, logits, fusedOutput);
+
+        AZ::VectorN softmaxOutput;
+        MachineLearning::Softmax(logits, softmaxOutput);
+        const float unfusedLoss = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::CrossEntropy, expected, softmaxOutput);
+        EXPECT_NEAR(fusedLoss, unfusedLoss, 1.0e-4f);
+
+        // The fused backward pass must match the cross-entropy derivative back-propagated through the softmax derivative
+        AZ::VectorN fusedGradients;
+        MachineLearning::SoftmaxCrossEntropy_Derivative(expected, softmaxOutput, fusedGradients);
+
+        AZ::VectorN lossGradients;
+        AZ::VectorN unfusedGradients;
+        MachineLearning::CrossEntropy_Derivative(expected, softmaxOutput, lossGradients);
+        MachineLearning::Softmax_Derivative(softmaxOutput, lossGradients, unfusedGradients);
+        for (AZStd::size_t iter = 0; iter < fusedGradients.GetDimensionality(); ++iter)
+        {
+            EXPECT_NEAR(fusedGradients.GetElement(iter), unfusedGradients.GetElement(iter), 1.0e-4f);
+        }
+    }
+
+    TEST_F(MachineLearning_LossFunctions, TestFusedSoftmaxCrossEntropyLargeLogits)
+    {
+        AZ::VectorN expected;
+        MachineLearning::OneHotEncode(0, 4, expected);
+
+        // The expected label has a probability that underflows in float, the fused loss is still exact since it never takes log(softmax)
+        AZ::VectorN logits = AZ::VectorN::CreateZero(4);
+        logits.SetElement(0, -200.0f);
+        logits.SetElement(1, 200.0f);
+
+        AZ::VectorN softmaxOutput;
+        const float loss = MachineLearning::SoftmaxCrossEntropy(expected, logits, softmaxOutput);
+        EXPECT_NEAR(loss, 400.0f, 1.0e-2f);
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class MachineLearning_LossFunctionsBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    };
+
+    BENCHMARK_F(MachineLearning_LossFunctionsBenchmark, BM_SoftmaxCrossEntropyUnfused)(benchmark::State& state)
+    {
+        AZ::VectorN expected;
+        MachineLearning::OneHotEncode(3, 1024, expected);
+        AZ::VectorN logits = AZ::VectorN::CreateRandom(1024);
+        AZ::VectorN softmaxOutput;
+        AZ::VectorN lossGradients;
+        AZ::VectorN output;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Softmax(logits, softmaxOutput);
+            MachineLearning::CrossEntropy_Derivative(expected, softmaxOutput, lossGradients);
+            MachineLearning::Softmax_Derivative(softmaxOutput, lossGradients, output);
+            benchmark::DoNotOptimize(output.GetVectorValues().data());
+        }
+        state.SetItemsProcessed(state.iterations() * logits.GetDimensionality());
+    }
+
+    BENCHMARK_F(MachineLearning_LossFunctionsBenchmark, BM_SoftmaxCrossEntropyFused)(benchmark::State& state)
+    {
+        AZ::VectorN expected;
+        MachineLearning::OneHotEncode(3, 1024, expected);
+        AZ::VectorN logits = AZ::VectorN::CreateRandom(1024);
+        AZ::VectorN softmaxOutput;
+        AZ::VectorN output;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            MachineLearning::Softmax(logits, softmaxOutput);
+            MachineLearning::SoftmaxCrossEntropy_Derivative(expected, softmaxOutput, output);
+            benchmark::DoNotOptimize(output.GetVectorValues().data());
+        }
+        state.SetItemsProcessed(state.iterations() * logits.GetDimensionality());
+    }
 }
+#endif
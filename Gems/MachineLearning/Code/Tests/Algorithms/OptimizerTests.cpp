@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Algorithms/Optimizers.h>
+#include <Algorithms/LossFunctions.h>
+#include <Models/MultilayerPerceptron.h>
+#include <AzCore/std/math.h>
+
+namespace UnitTest
+{
+    class MachineLearning_Optimizers
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    // A straightforward scalar implementation of each optimizer, written directly from the textbook definitions
+    static float ReferenceStep(const MachineLearning::OptimizerParameters& parameters, AZStd::size_t step, float learningRate, bool applyWeightDecay, float parameter, float gradient, float& moment, float& secondMoment)
+    {
+        switch (parameters.m_optimizer)
+        {
+        case MachineLearning::OptimizerTypes::Sgd:
+            return parameter - learningRate * gradient;
+        case MachineLearning::OptimizerTypes::Momentum:
+            moment = parameters.m_momentum * moment + gradient;
+            return parameter - learningRate * moment;
+        case MachineLearning::OptimizerTypes::Nesterov:
+            moment = parameters.m_momentum * moment + gradient;
+            return parameter - learningRate * (gradient + parameters.m_momentum * moment);
+        case MachineLearning::OptimizerTypes::Adam:
+        case MachineLearning::OptimizerTypes::AdamW:
+            {
+                moment = parameters.m_beta1 * moment + (1.0f - parameters.m_beta1) * gradient;
+                secondMoment = parameters.m_beta2 * secondMoment + (1.0f - parameters.m_beta2) * gradient * gradient;
+                const float correctedMoment = moment / (1.0f - AZStd::pow(parameters.m_beta1, static_cast<float>(step)));
+                const float correctedSecondMoment = secondMoment / (1.0f - AZStd::pow(parameters.m_beta2, static_cast<float>(step)));
+                float result = parameter - learningRate * correctedMoment / (AZStd::sqrt(correctedSecondMoment) + parameters.m_epsilon);
+                if ((parameters.m_optimizer == MachineLearning::OptimizerTypes::AdamW) && applyWeightDecay)
+                {
+                    result -= learningRate * parameters.m_weightDecay * parameter;
+                }
+                return result;
+            }
+        }
+        return parameter;
+    }
+
+    TEST_F(MachineLearning_Optimizers, TestOptimizersMatchReference)
+    {
+        const MachineLearning::OptimizerTypes optimizers[] =
+        {
+            MachineLearning::OptimizerTypes::Sgd,
+            MachineLearning::OptimizerTypes::Momentum,
+            MachineLearning::OptimizerTypes::Nesterov,
+            MachineLearning::OptimizerTypes::Adam,
+            MachineLearning::OptimizerTypes::AdamW
+        };
+
+        // Dimensions are deliberately not multiples of four so that partially used blocks are exercised
+        constexpr AZStd::size_t inputSize = 5;
+        constexpr AZStd::size_t outputSize = 3;
+        constexpr AZStd::size_t totalSteps = 4;
+        constexpr float learningRate = 0.1f;
+
+        for (MachineLearning::OptimizerTypes optimizer : optimizers)
+        {
+            MachineLearning::OptimizerParameters parameters;
+            parameters.m_optimizer = optimizer;
+            parameters.m_weightDecay = 0.1f;
+
+            MachineLearning::Layer layer(MachineLearning::ActivationFunctions::Linear, inputSize, outputSize);
+            layer.m_weights = AZ::MatrixMxN::CreateRandom(outputSize, inputSize);
+            layer.m_biases = AZ::VectorN::CreateRandom(outputSize);
+
+            AZ::MatrixMxN expectedWeights = layer.m_weights;
+            AZ::VectorN expectedBiases = layer.m_biases;
+            AZ::MatrixMxN weightMoments = AZ::MatrixMxN::CreateZero(outputSize, inputSize);
+            AZ::MatrixMxN weightSecondMoments = AZ::MatrixMxN::CreateZero(outputSize, inputSize);
+            AZ::VectorN biasMoments = AZ::VectorN::CreateZero(outputSize);
+            AZ::VectorN biasSecondMoments = AZ::VectorN::CreateZero(outputSize);
+
+            MachineLearning::LayerTrainingData trainingData;
+            for (AZStd::size_t step = 1; step <= totalSteps; ++step)
+            {
+                trainingData.m_weightGradients = AZ::MatrixMxN::CreateRandom(outputSize, inputSize);
+                trainingData.m_weightGradients -= 0.5f;
+                trainingData.m_biasGradients = AZ::VectorN::CreateRandom(outputSize);
+                trainingData.m_biasGradients -= 0.5f;
+
+                for (AZStd::size_t row = 0; row < outputSize; ++row)
+                {
+                    for (AZStd::size_t col = 0; col < inputSize; ++col)
+                    {
+                        float moment = weightMoments.GetElement(row, col);
+                        float secondMoment = weightSecondMoments.GetElement(row, col);
+                        const float result = ReferenceStep(parameters, step, learningRate, true, expectedWeights.GetElement(row, col), trainingData.m_weightGradients.GetElement(row, col), moment, secondMoment);
+                        expectedWeights.SetElement(row, col, result);
+                        weightMoments.SetElement(row, col, moment);
+                        weightSecondMoments.SetElement(row, col, secondMoment);
+                    }
+
+                    float moment = biasMoments.GetElement(row);
+                    float secondMoment = biasSecondMoments.GetElement(row);
+                    const float result = ReferenceStep(parameters, step, learningRate, false, expectedBiases.GetElement(row), trainingData.m_biasGradients.GetElement(row), moment, secondMoment);
+                    expectedBiases.SetElement(row, result);
+                    biasMoments.SetElement(row, moment);
+                    biasSecondMoments.SetElement(row, secondMoment);
+                }
+
+                layer.ApplyGradients(trainingData, parameters, step, learningRate, layer);
+            }
+
+            for (AZStd::size_t row = 0; row < outputSize; ++row)
+            {
+                for (AZStd::size_t col = 0; col < inputSize; ++col)
+                {
+                    EXPECT_NEAR(layer.m_weights.GetElement(row, col), expectedWeights.GetElement(row, col), 1.0e-4f);
+                }
+                EXPECT_NEAR(layer.m_biases.GetElement(row), expectedBiases.GetElement(row), 1.0e-4f);
+            }
+
+            // Gradients are always reset after being applied
+            EXPECT_FLOAT_EQ(trainingData.m_weightGradients.GetElement(0, 0), 0.0f);
+            EXPECT_FLOAT_EQ(trainingData.m_biasGradients.GetElement(0), 0.0f);
+        }
+    }
+
+    TEST_F(MachineLearning_Optimizers, TestAdamConvergence)
+    {
+        // The same network as the MultilayerPerceptron gradient test, but trained with Adam using a tenth of the steps
+        const float layer0Weights[] = { 0.15f, 0.20f, 0.25f, 0.30f };
+        const float layer0Biases[] = { 0.35f, 0.35f };
+        const float layer1Weights[] = { 0.40f, 0.45f, 0.50f, 0.55f };
+        const float layer1Biases[] = { 0.60f, 0.60f };
+
+        MachineLearning::MultilayerPerceptron mlp(2);
+        MachineLearning::MlpInferenceContext inferenceData;
+        MachineLearning::MlpTrainingContext trainingData;
+        trainingData.m_optimizerParameters.m_optimizer = MachineLearning::OptimizerTypes::Adam;
+        mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+        mlp.AddLayer(2, MachineLearning::ActivationFunctions::Sigmoid);
+
+        MachineLearning::Layer* layer0 = mlp.GetLayer(0);
+        layer0->m_weights = AZ::MatrixMxN::CreateFromPackedFloats(2, 2, layer0Weights);
+        layer0->m_biases = AZ::VectorN::CreateFromFloats(2, layer0Biases);
+
+        MachineLearning::Layer* layer1 = mlp.GetLayer(1);
+        layer1->m_weights = AZ::MatrixMxN::CreateFromPackedFloats(2, 2, layer1Weights);
+        layer1->m_biases = AZ::VectorN::CreateFromFloats(2, layer1Biases);
+
+        const float activations[] = { 0.05f, 0.10f };
+        const float labels[] = { 0.01f, 0.99f };
+        const AZ::VectorN trainingInput = AZ::VectorN::CreateFromFloats(2, activations);
+        const AZ::VectorN trainingOutput = AZ::VectorN::CreateFromFloats(2, labels);
+
+        const AZStd::size_t numTrainingLoops = 1000;
+        for (AZStd::size_t iter = 0; iter < numTrainingLoops; ++iter)
+        {
+            mlp.Reverse(&trainingData, MachineLearning::LossFunctions::MeanSquaredError, trainingInput, trainingOutput);
+            mlp.GradientDescent(&trainingData, 0.1f);
+        }
+        EXPECT_EQ(trainingData.m_optimizerStep, numTrainingLoops);
+
+        const AZ::VectorN* trainedOutput = mlp.Forward(&inferenceData, trainingInput);
+        const float trainedCost = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::MeanSquaredError, trainingOutput, *trainedOutput);
+        EXPECT_LT(trainedCost, 5.0e-6f);
+
+        // Switching optimizers discards the existing moment estimates and restarts bias correction
+        trainingData.m_optimizerParameters.m_optimizer = MachineLearning::OptimizerTypes::Momentum;
+        mlp.Reverse(&trainingData, MachineLearning::LossFunctions::MeanSquaredError, trainingInput, trainingOutput);
+        mlp.GradientDescent(&trainingData, 0.1f);
+        EXPECT_EQ(trainingData.m_optimizerStep, 1);
+        EXPECT_EQ(trainingData.m_layerData[0].m_weightSecondMoments.GetRowCount(), 0);
+    }
+}
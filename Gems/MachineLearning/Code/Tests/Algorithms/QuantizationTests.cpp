@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Algorithms/Quantization.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MachineLearning_Quantization
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(MachineLearning_Quantization, TestQuantizationParameters)
+    {
+        // Zero must always be exactly representable
+        const MachineLearning::QuantizationParameters positive = MachineLearning::ComputeQuantizationParameters(0.0f, 1.0f);
+        EXPECT_EQ(MachineLearning::QuantizeValue(0.0f, positive), positive.m_zeroPoint);
+        EXPECT_EQ(MachineLearning::QuantizeValue(0.0f, positive), -128);
+        EXPECT_EQ(MachineLearning::QuantizeValue(1.0f, positive), 127);
+
+        const MachineLearning::QuantizationParameters symmetric = MachineLearning::ComputeQuantizationParameters(-2.0f, 2.0f);
+        EXPECT_NEAR(static_cast<float>(MachineLearning::QuantizeValue(0.0f, symmetric) - symmetric.m_zeroPoint) * symmetric.m_scale, 0.0f, AZ::Constants::Tolerance);
+        EXPECT_EQ(MachineLearning::QuantizeValue(-2.0f, symmetric), -128);
+        EXPECT_EQ(MachineLearning::QuantizeValue(2.0f, symmetric), 127);
+
+        // Values outside the calibrated range are clamped
+        EXPECT_EQ(MachineLearning::QuantizeValue(100.0f, symmetric), 127);
+        EXPECT_EQ(MachineLearning::QuantizeValue(-100.0f, symmetric), -128);
+    }
+
+    TEST_F(MachineLearning_Quantization, TestQuantizeVector)
+    {
+        AZ::VectorN sourceVector = AZ::VectorN::CreateRandom(37);
+        const MachineLearning::QuantizationParameters parameters = MachineLearning::ComputeQuantizationParameters(0.0f, 1.0f);
+
+        AZStd::vector<int8_t> quantized;
+        const int32_t sum = MachineLearning::QuantizeVector(sourceVector, parameters, quantized);
+        ASSERT_EQ(quantized.size() % MachineLearning::QuantizedBlockSize, 0);
+        ASSERT_GE(quantized.size(), sourceVector.GetDimensionality());
+
+        int32_t expectedSum = 0;
+        for (AZStd::size_t iter = 0; iter < sourceVector.GetDimensionality(); ++iter)
+        {
+            const float dequantized = static_cast<float>(quantized[iter] - parameters.m_zeroPoint) * parameters.m_scale;
+            EXPECT_NEAR(dequantized, sourceVector.GetElement(iter), parameters.m_scale);
+            expectedSum += quantized[iter];
+        }
+        EXPECT_EQ(sum, expectedSum);
+
+        // Padding must be zero so that it contributes nothing to dot products
+        for (AZStd::size_t iter = sourceVector.GetDimensionality(); iter < quantized.size(); ++iter)
+        {
+            EXPECT_EQ(quantized[iter], 0);
+        }
+    }
+
+    TEST_F(MachineLearning_Quantization, TestDotProductInt8)
+    {
+        std::mt19937 gen{ 1234 };
+        std::uniform_int_distribution<int32_t> dist{ -128, 127 };
+
+        for (AZStd::size_t count = MachineLearning::QuantizedBlockSize; count <= 1024; count += MachineLearning::QuantizedBlockSize)
+        {
+            AZStd::vector<int8_t> lhs(count);
+            AZStd::vector<int8_t> rhs(count);
+            int32_t expected = 0;
+            for (AZStd::size_t iter = 0; iter < count; ++iter)
+            {
+                lhs[iter] = static_cast<int8_t>(dist(gen));
+                rhs[iter] = static_cast<int8_t>(dist(gen));
+                expected += static_cast<int32_t>(lhs[iter]) * static_cast<int32_t>(rhs[iter]);
+            }
+            ASSERT_EQ(MachineLearning::DotProductInt8(lhs.data(), rhs.data(), count), expected);
+        }
+
+        // Extreme values must not saturate any intermediate products
+        AZStd::vector<int8_t> minimums(MachineLearning::QuantizedBlockSize, -128);
+        EXPECT_EQ(MachineLearning::DotProductInt8(minimums.data(), minimums.data(), minimums.size()), 128 * 128 * static_cast<int32_t>(MachineLearning::QuantizedBlockSize));
+    }
+}
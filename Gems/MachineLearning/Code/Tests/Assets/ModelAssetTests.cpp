@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <Assets/ModelAsset.h>
+
+namespace UnitTest
+{
+    class MachineLearning_ModelAsset
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    static void CreateTestModel(MachineLearning::ModelAsset& model)
+    {
+        // Dimensions are deliberately not multiples of four so that partially used blocks are exercised
+        model.m_name = "TestModel";
+        model.m_activationCount = 7;
+        model.m_layers.emplace_back(MachineLearning::ActivationFunctions::ReLU, 7, 5);
+        model.m_layers.emplace_back(MachineLearning::ActivationFunctions::Softmax, 5, 3);
+        for (MachineLearning::Layer& layer : model.m_layers)
+        {
+            layer.m_weights = AZ::MatrixMxN::CreateRandom(layer.m_outputSize, layer.m_inputSize);
+            layer.m_biases = AZ::VectorN::CreateRandom(layer.m_outputSize);
+        }
+    }
+
+    static void ExpectModelsEqual(const MachineLearning::ModelAsset& lhs, const MachineLearning::ModelAsset& rhs)
+    {
+        EXPECT_EQ(lhs.m_name, rhs.m_name);
+        EXPECT_EQ(lhs.m_activationCount, rhs.m_activationCount);
+        ASSERT_EQ(lhs.m_layers.size(), rhs.m_layers.size());
+        for (AZStd::size_t iter = 0; iter < lhs.m_layers.size(); ++iter)
+        {
+            const MachineLearning::Layer& lhsLayer = lhs.m_layers[iter];
+            const MachineLearning::Layer& rhsLayer = rhs.m_layers[iter];
+            EXPECT_EQ(lhsLayer.m_inputSize, rhsLayer.m_inputSize);
+            EXPECT_EQ(lhsLayer.m_outputSize, rhsLayer.m_outputSize);
+            EXPECT_EQ(lhsLayer.m_activationFunction, rhsLayer.m_activationFunction);
+            for (AZStd::size_t row = 0; row < lhsLayer.m_outputSize; ++row)
+            {
+                for (AZStd::size_t col = 0; col < lhsLayer.m_inputSize; ++col)
+                {
+                    EXPECT_EQ(lhsLayer.m_weights.GetElement(row, col), rhsLayer.m_weights.GetElement(row, col));
+                }
+                EXPECT_EQ(lhsLayer.m_biases.GetElement(row), rhsLayer.m_biases.GetElement(row));
+            }
+        }
+    }
+
+    TEST_F(MachineLearning_ModelAsset, TestBinaryRoundTrip)
+    {
+        MachineLearning::ModelAsset source;
+        CreateTestModel(source);
+
+        AZStd::vector<uint8_t> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> writeStream(&buffer);
+        EXPECT_TRUE(MachineLearning::WriteBinaryModel(source, writeStream));
+
+        // Validate the header and that every parameter block is aligned
+        ASSERT_GE(buffer.size(), sizeof(MachineLearning::ModelAssetHeader));
+        EXPECT_EQ(buffer.size() % MachineLearning::ModelAssetAlignment, 0);
+        MachineLearning::ModelAssetHeader header;
+        memcpy(&header, buffer.data(), sizeof(header));
+        EXPECT_EQ(header.m_magic, MachineLearning::ModelAssetMagic);
+        EXPECT_EQ(header.m_version, MachineLearning::ModelAssetVersion);
+        EXPECT_EQ(header.m_layerCount, 2);
+        EXPECT_EQ(header.m_totalSize, buffer.size());
+        for (uint32_t iter = 0; iter < header.m_layerCount; ++iter)
+        {
+            MachineLearning::ModelAssetLayerHeader layerHeader;
+            memcpy(&layerHeader, buffer.data() + header.m_layerTableOffset + iter * sizeof(layerHeader), sizeof(layerHeader));
+            EXPECT_EQ(layerHeader.m_weightOffset % MachineLearning::ModelAssetAlignment, 0);
+            EXPECT_EQ(layerHeader.m_biasOffset % MachineLearning::ModelAssetAlignment, 0);
+        }
+
+        MachineLearning::ModelAsset result;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> readStream(&buffer);
+        EXPECT_TRUE(MachineLearning::ReadModel(readStream, result));
+        ExpectModelsEqual(source, result);
+    }
+
+    TEST_F(MachineLearning_ModelAsset, TestLegacyConversion)
+    {
+        MachineLearning::ModelAsset source;
+        CreateTestModel(source);
+
+        // Write the model using the legacy serialized format
+        AZStd::vector<uint8_t> legacyBuffer;
+        legacyBuffer.resize(source.EstimateSerializeSize());
+        AzNetworking::NetworkInputSerializer serializer(legacyBuffer.data(), static_cast<uint32_t>(legacyBuffer.size()));
+        EXPECT_TRUE(source.Serialize(serializer));
+        legacyBuffer.resize(serializer.GetSize());
+
+        // The legacy model should still load, and convert to an identical binary model
+        MachineLearning::ModelAsset legacy;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> legacyStream(&legacyBuffer);
+        EXPECT_TRUE(MachineLearning::ReadModel(legacyStream, legacy));
+        ExpectModelsEqual(source, legacy);
+
+        AZStd::vector<uint8_t> binaryBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> writeStream(&binaryBuffer);
+        EXPECT_TRUE(MachineLearning::WriteBinaryModel(legacy, writeStream));
+
+        MachineLearning::ModelAsset converted;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> readStream(&binaryBuffer);
+        EXPECT_TRUE(MachineLearning::ReadModel(readStream, converted));
+        ExpectModelsEqual(source, converted);
+    }
+
+    TEST_F(MachineLearning_ModelAsset, TestTruncatedBinaryModel)
+    {
+        MachineLearning::ModelAsset source;
+        CreateTestModel(source);
+
+        AZStd::vector<uint8_t> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> writeStream(&buffer);
+        EXPECT_TRUE(MachineLearning::WriteBinaryModel(source, writeStream));
+
+        // Dropping the final parameter block must fail cleanly rather than reading past the end of the stream
+        buffer.resize(buffer.size() - MachineLearning::ModelAssetAlignment);
+        MachineLearning::ModelAsset result;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> readStream(&buffer);
+        EXPECT_FALSE(MachineLearning::ReadModel(readStream, result));
+    }
+
+    TEST_F(MachineLearning_ModelAsset, TestCorruptBinaryModelHeader)
+    {
+        MachineLearning::ModelAsset source;
+        CreateTestModel(source);
+
+        AZStd::vector<uint8_t> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> writeStream(&buffer);
+        EXPECT_TRUE(MachineLearning::WriteBinaryModel(source, writeStream));
+
+        MachineLearning::ModelAssetHeader header;
+        memcpy(&header, buffer.data(), sizeof(header));
+        MachineLearning::ModelAssetLayerHeader layerHeader;
+        memcpy(&layerHeader, buffer.data() + header.m_layerTableOffset, sizeof(layerHeader));
+
+        // Counts, offsets and sizes that lie outside of the model must be rejected before anything is allocated or read from them
+        auto readCorrupted = [&buffer](const MachineLearning::ModelAssetHeader& corruptHeader, const MachineLearning::ModelAssetLayerHeader& corruptLayerHeader)
+        {
+            AZStd::vector<uint8_t> corrupted = buffer;
+            memcpy(corrupted.data(), &corruptHeader, sizeof(corruptHeader));
+            memcpy(corrupted.data() + corruptHeader.m_layerTableOffset, &corruptLayerHeader, sizeof(corruptLayerHeader));
+            MachineLearning::ModelAsset result;
+            AZ::IO::ByteContainerStream<AZStd::vector<uint8_t>> readStream(&corrupted);
+            return MachineLearning::ReadModel(readStream, result);
+        };
+
+        EXPECT_TRUE(readCorrupted(header, layerHeader));
+        {
+            MachineLearning::ModelAssetHeader corrupt = header;
+            corrupt.m_layerCount = 0xFFFFFFFF;
+            EXPECT_FALSE(readCorrupted(corrupt, layerHeader));
+        }
+        {
+            MachineLearning::ModelAssetHeader corrupt = header;
+            corrupt.m_nameLength = ~0ull;
+            EXPECT_FALSE(readCorrupted(corrupt, layerHeader));
+        }
+        {
+            MachineLearning::ModelAssetHeader corrupt = header;
+            corrupt.m_nameOffset = header.m_totalSize;
+            EXPECT_FALSE(readCorrupted(corrupt, layerHeader));
+        }
+        {
+            MachineLearning::ModelAssetLayerHeader corrupt = layerHeader;
+            corrupt.m_weightOffset = ~0ull - MachineLearning::ModelAssetAlignment;
+            EXPECT_FALSE(readCorrupted(header, corrupt));
+        }
+        {
+            MachineLearning::ModelAssetLayerHeader corrupt = layerHeader;
+            corrupt.m_inputSize = ~0ull;
+            corrupt.m_outputSize = ~0ull;
+            EXPECT_FALSE(readCorrupted(header, corrupt));
+        }
+    }
+}
@@ -10,6 +10,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <Models/MultilayerPerceptron.h>
 #include <Algorithms/LossFunctions.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -87,6 +89,11 @@ namespace UnitTest
 
         mlp.GradientDescent(&trainingData, 0.5f);
 
+        // Gradient descent publishes a new parameter buffer, so we need to re-fetch the layers to examine the updated parameters
+        layer0 = mlp.GetLayer(0);
+        layer1 = mlp.GetLayer(1);
+        EXPECT_EQ(mlp.GetParameterVersion(), 1);
+
         EXPECT_NEAR(layer1->m_weights.GetElement(0, 0), 0.3590f, 0.01f);
         EXPECT_NEAR(layer1->m_weights.GetElement(0, 1), 0.4087f, 0.01f);
         EXPECT_NEAR(layer1->m_weights.GetElement(1, 0), 0.5113f, 0.01f);
@@ -110,4 +117,87 @@ namespace UnitTest
         float trainedCost = MachineLearning::ComputeTotalCost(MachineLearning::LossFunctions::MeanSquaredError, trainingOutput, *trainedOutput);
         EXPECT_LT(trainedCost, 5.0e-6f);
     }
+
+    TEST_F(MachineLearning_MLP, TestInferenceDuringTraining)
+    {
+        MachineLearning::MultilayerPerceptron mlp(8);
+        mlp.AddLayer(16, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(4, MachineLearning::ActivationFunctions::Sigmoid);
+
+        const AZ::VectorN trainingInput = AZ::VectorN::CreateOne(8);
+        const AZ::VectorN trainingOutput = AZ::VectorN::CreateZero(4);
+
+        // Run inference on a separate thread while the model is actively being trained, readers should always observe a consistent and monotonically increasing parameter version
+        AZStd::atomic<bool> trainingComplete = false;
+        AZStd::atomic<bool> inferenceValid = true;
+        AZStd::thread inferenceThread([&mlp, &trainingInput, &trainingComplete, &inferenceValid]()
+        {
+            MachineLearning::MlpInferenceContext inferenceData;
+            AZStd::size_t lastVersion = 0;
+            while (!trainingComplete)
+            {
+                const AZ::VectorN* output = mlp.Forward(&inferenceData, trainingInput);
+                for (AZStd::size_t iter = 0; iter < output->GetDimensionality(); ++iter)
+                {
+                    const float value = output->GetElement(iter);
+                    if (!(value >= 0.0f && value <= 1.0f))
+                    {
+                        inferenceValid = false;
+                    }
+                }
+
+                if (inferenceData.m_parameterVersion < lastVersion)
+                {
+                    inferenceValid = false;
+                }
+                lastVersion = inferenceData.m_parameterVersion;
+            }
+        });
+
+        MachineLearning::MlpTrainingContext trainingData;
+        const AZStd::size_t numTrainingLoops = 1000;
+        for (AZStd::size_t iter = 0; iter < numTrainingLoops; ++iter)
+        {
+            mlp.Reverse(&trainingData, MachineLearning::LossFunctions::MeanSquaredError, trainingInput, trainingOutput);
+            mlp.GradientDescent(&trainingData, 0.1f);
+        }
+        trainingComplete = true;
+        inferenceThread.join();
+
+        EXPECT_TRUE(inferenceValid);
+        EXPECT_EQ(mlp.GetParameterVersion(), numTrainingLoops);
+    }
+
+    TEST_F(MachineLearning_MLP, TestReflectedLayersHoldPublishedParameters)
+    {
+        MachineLearning::MultilayerPerceptron mlp(4);
+        mlp.AddLayer(4, MachineLearning::ActivationFunctions::Sigmoid);
+
+        // A single gradient descent step publishes the trained parameters in the back buffer
+        MachineLearning::MlpTrainingContext trainingData;
+        mlp.Reverse(&trainingData, MachineLearning::LossFunctions::MeanSquaredError, AZ::VectorN::CreateOne(4), AZ::VectorN::CreateZero(4));
+        mlp.GradientDescent(&trainingData, 0.1f);
+        ASSERT_EQ(mlp.GetParameterVersion(), 1);
+        const AZ::MatrixMxN trainedWeights = mlp.GetLayerWeights(0);
+        const AZ::VectorN trainedBiases = mlp.GetLayerBiases(0);
+
+        // Reflection only knows about m_layers, so any reflected access must first move the published parameters there
+        AZ::SerializeContext serializeContext;
+        MachineLearning::Layer::Reflect(&serializeContext);
+        MachineLearning::MultilayerPerceptron::Reflect(&serializeContext);
+        serializeContext.EnumerateObject(&mlp,
+            [](void*, const AZ::SerializeContext::ClassData*, const AZ::SerializeContext::ClassElement*) { return true; },
+            []() { return true; },
+            AZ::SerializeContext::ENUM_ACCESS_FOR_READ);
+
+        EXPECT_EQ(mlp.GetParameterVersion(), 0);
+        for (AZStd::size_t row = 0; row < trainedWeights.GetRowCount(); ++row)
+        {
+            for (AZStd::size_t col = 0; col < trainedWeights.GetColumnCount(); ++col)
+            {
+                EXPECT_EQ(mlp.GetLayerWeights(0).GetElement(row, col), trainedWeights.GetElement(row, col));
+            }
+            EXPECT_EQ(mlp.GetLayerBiases(0).GetElement(row), trainedBiases.GetElement(row));
+        }
+    }
 }
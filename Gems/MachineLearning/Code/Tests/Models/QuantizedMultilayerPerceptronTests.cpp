@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Models/QuantizedMultilayerPerceptron.h>
+#include <Algorithms/Activations.h>
+
+namespace UnitTest
+{
+    class MachineLearning_QuantizedMLP
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    //! A trivial in-memory labeled data set used to calibrate and evaluate quantized models.
+    class TestCalibrationData
+        : public MachineLearning::ILabeledTrainingData
+    {
+    public:
+        TestCalibrationData(AZStd::size_t sampleCount, AZStd::size_t inputSize, AZStd::size_t labelCount)
+        {
+            for (AZStd::size_t iter = 0; iter < sampleCount; ++iter)
+            {
+                m_data.push_back(AZ::VectorN::CreateRandom(inputSize));
+                AZ::VectorN label;
+                MachineLearning::OneHotEncode(iter % labelCount, labelCount, label);
+                m_labels.push_back(label);
+            }
+        }
+
+        bool LoadArchive(const AZ::IO::Path&, const AZ::IO::Path&) override { return false; }
+        AZStd::size_t GetSampleCount() const override { return m_data.size(); }
+        const AZ::VectorN& GetLabelByIndex(AZStd::size_t index) override { return m_labels[index]; }
+        const AZ::VectorN& GetDataByIndex(AZStd::size_t index) override { return m_data[index]; }
+
+    private:
+        AZStd::vector<AZ::VectorN> m_data;
+        AZStd::vector<AZ::VectorN> m_labels;
+    };
+
+    TEST_F(MachineLearning_QuantizedMLP, TestQuantizedForward)
+    {
+        MachineLearning::MultilayerPerceptron mlp(20);
+        mlp.AddLayer(32, MachineLearning::ActivationFunctions::ReLU);
+        mlp.AddLayer(8, MachineLearning::ActivationFunctions::Linear);
+
+        for (AZStd::size_t layerIndex = 0; layerIndex < mlp.GetLayerCount(); ++layerIndex)
+        {
+            MachineLearning::Layer* layer = mlp.GetLayer(layerIndex);
+            layer->m_weights = AZ::MatrixMxN::CreateRandom(layer->m_outputSize, layer->m_inputSize);
+            layer->m_weights -= 0.5f;
+            layer->m_biases = AZ::VectorN::CreateRandom(layer->m_outputSize);
+            layer->m_biases *= 0.1f;
+        }
+
+        TestCalibrationData calibrationData(128, 20, 8);
+        MachineLearning::QuantizedMultilayerPerceptron quantized;
+        ASSERT_TRUE(quantized.Quantize(mlp, calibrationData));
+        EXPECT_EQ(quantized.GetLayerCount(), mlp.GetLayerCount());
+        EXPECT_EQ(quantized.GetInputDimensionality(), mlp.GetInputDimensionality());
+        EXPECT_EQ(quantized.GetOutputDimensionality(), mlp.GetOutputDimensionality());
+        EXPECT_LT(quantized.GetParameterBytes(), mlp.GetParameterCount() * sizeof(float));
+
+        // Inputs within the calibrated range should closely match the float model
+        MachineLearning::MlpInferenceContext floatContext;
+        MachineLearning::QuantizedMlpInferenceContext quantizedContext;
+        for (AZStd::size_t sample = 0; sample < calibrationData.GetSampleCount(); ++sample)
+        {
+            const AZ::VectorN& activations = calibrationData.GetDataByIndex(sample);
+            const AZ::VectorN* floatOutput = mlp.Forward(&floatContext, activations);
+            const AZ::VectorN* quantizedOutput = quantized.Forward(&quantizedContext, activations);
+            ASSERT_EQ(floatOutput->GetDimensionality(), quantizedOutput->GetDimensionality());
+            for (AZStd::size_t iter = 0; iter < floatOutput->GetDimensionality(); ++iter)
+            {
+                EXPECT_NEAR(floatOutput->GetElement(iter), quantizedOutput->GetElement(iter), 0.05f);
+            }
+        }
+
+        const MachineLearning::QuantizationReport report = MachineLearning::CompareQuantizedModel(mlp, quantized, calibrationData);
+        EXPECT_EQ(report.m_sampleCount, calibrationData.GetSampleCount());
+        EXPECT_LT(report.m_maxAbsoluteError, 0.05f);
+        EXPECT_EQ(report.m_quantizedParameterBytes, quantized.GetParameterBytes());
+    }
+}
@@ -15,6 +15,10 @@ set(FILES
     Source/Algorithms/Activations.h
     Source/Algorithms/LossFunctions.cpp
     Source/Algorithms/LossFunctions.h
+    Source/Algorithms/Optimizers.cpp
+    Source/Algorithms/Optimizers.h
+    Source/Algorithms/Quantization.cpp
+    Source/Algorithms/Quantization.h
     Source/Algorithms/Training.cpp
     Source/Algorithms/Training.h
     Source/Assets/MnistDataLoader.cpp
@@ -29,6 +33,8 @@ set(FILES
     Source/Models/Layer.h
     Source/Models/MultilayerPerceptron.cpp
     Source/Models/MultilayerPerceptron.h
+    Source/Models/QuantizedMultilayerPerceptron.cpp
+    Source/Models/QuantizedMultilayerPerceptron.h
     Source/Nodes/ArgMax.ScriptCanvasNodeable.xml
     Source/Nodes/ArgMax.cpp
     Source/Nodes/ArgMax.h
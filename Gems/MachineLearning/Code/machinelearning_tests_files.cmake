@@ -9,7 +9,11 @@
 set(FILES
     Tests/Algorithms/ActivationTests.cpp
     Tests/Algorithms/LossFunctionTests.cpp
+    Tests/Algorithms/OptimizerTests.cpp
+    Tests/Algorithms/QuantizationTests.cpp
+    Tests/Assets/ModelAssetTests.cpp
     Tests/Models/LayerTests.cpp
     Tests/Models/MultilayerPerceptronTests.cpp
+    Tests/Models/QuantizedMultilayerPerceptronTests.cpp
     Tests/MachineLearningTests.cpp
 )
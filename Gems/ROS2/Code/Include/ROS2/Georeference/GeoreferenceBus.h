@@ -12,6 +12,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/span.h>
 
 namespace ROS2
 {
@@ -34,6 +35,17 @@ namespace ROS2
         //! Function is useful to fin georeference rotation of the level.
         //! @return Quaternion in ENU coordinate system.
         virtual AZ::Quaternion GetRotationFromLevelToENU() = 0;
+
+        //! Function converts a batch of points from Level's coordinate system to WGS84.
+        //! The local tangent plane of the level is computed once, which makes it cheaper than converting points one by one.
+        //! @param xyz points in Level's coordinate system.
+        //! @param latLon output points in WGS84 coordinate system, must have the same size as xyz.
+        virtual void ConvertFromLevelToWGS84Batch(AZStd::span<const AZ::Vector3> xyz, AZStd::span<WGS::WGS84Coordinate> latLon) = 0;
+
+        //! Function converts a batch of points from WGS84 coordinate system to Level's.
+        //! @param latLon points in WGS84 coordinate system.
+        //! @param xyz output points in Level's coordinate system, must have the same size as latLon.
+        virtual void ConvertFromWGS84ToLevelBatch(AZStd::span<const WGS::WGS84Coordinate> latLon, AZStd::span<AZ::Vector3> xyz) = 0;
     };
 
     class GeoreferenceRequestsTraits : public AZ::EBusTraits
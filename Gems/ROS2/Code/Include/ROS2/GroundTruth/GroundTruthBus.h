@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2
+{
+    //! Interface to the ground truth publisher, which publishes the true state of all registered robots at once.
+    //! Poses and velocities of all robot base bodies are read in a single pass after a physics step and published
+    //! with the same timestamp, either as one aggregated message or as a message per robot, depending on the configuration.
+    //! Use this API through GroundTruthInterface, usually through ROS2GroundTruthComponent on the robot base.
+    class GroundTruthRequests
+    {
+    public:
+        AZ_RTTI(GroundTruthRequests, "{4E6A2C19-7B3F-4D85-A0E1-9C5D8B2F6A34}");
+        virtual ~GroundTruthRequests() = default;
+
+        //! Register the base body of a robot.
+        //! @param entityId entity with the rigid body of the robot base.
+        //! @param robotName name of the robot in the aggregated message, also the namespace of the per-robot topic.
+        //! @param frameId frame of the robot base, used as the child frame of per-robot messages.
+        virtual void RegisterRobot(const AZ::EntityId& entityId, const AZStd::string& robotName, const AZStd::string& frameId) = 0;
+
+        //! Unregister a previously registered robot. Unknown entities are ignored.
+        //! @param entityId entity passed to RegisterRobot.
+        virtual void UnregisterRobot(const AZ::EntityId& entityId) = 0;
+    };
+
+    using GroundTruthInterface = AZ::Interface<GroundTruthRequests>;
+} // namespace ROS2
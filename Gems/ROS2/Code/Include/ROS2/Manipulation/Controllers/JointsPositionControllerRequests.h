@@ -9,6 +9,8 @@
 
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <ROS2/Manipulation/JointInfo.h>
 
@@ -48,6 +50,33 @@ namespace ROS2
             JointPosition currentPosition,
             JointPosition targetPosition,
             float deltaTime) = 0;
+
+        //! Control all joints of a manipulator in one call, moving each joint towards its rest position.
+        //! All vectors are indexed by the JointIndex of the calling manipulation component.
+        //! The default implementation calls PositionControl for each joint.
+        //! @param jointNames names of the joints to move.
+        //! @param joints specification of the joints, m_restPosition is the target position of each joint.
+        //! @param currentPositions current positions of the joints.
+        //! @param deltaTime how much time elapsed in simulation the movement should represent.
+        //! @return nothing on success, the first error message if any of the joints could not be controlled.
+        virtual AZ::Outcome<void, AZStd::string> PositionControlAll(
+            const AZStd::vector<AZStd::string>& jointNames,
+            const AZStd::vector<JointInfo>& joints,
+            const AZStd::vector<JointPosition>& currentPositions,
+            float deltaTime)
+        {
+            AZ::Outcome<void, AZStd::string> result = AZ::Success();
+            for (JointIndex jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
+            {
+                auto outcome = PositionControl(
+                    jointNames[jointIndex], joints[jointIndex], currentPositions[jointIndex], joints[jointIndex].m_restPosition, deltaTime);
+                if (!outcome && result)
+                {
+                    result = outcome;
+                }
+            }
+            return result;
+        }
     };
     using JointsPositionControllerRequestBus = AZ::EBus<JointsPositionControllerRequests>;
 } // namespace ROS2
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <PhysX/ArticulationTypes.h>
 
@@ -19,6 +20,7 @@ namespace ROS2
     using JointPosition = float;
     using JointVelocity = float;
     using JointEffort = float;
+    using JointIndex = AZStd::size_t; //!< Position of a joint in the ordered joint list of a manipulation component.
     struct JointInfo
     {
         AZ_TYPE_INFO(JointInfo, "{2E33E4D0-78DD-436D-B3AB-F752E744F421}");
@@ -30,4 +32,12 @@ namespace ROS2
         JointPosition m_restPosition = 0.0f; //!< Keeps this position if no commands are given (for example, opposing gravity).
     };
     using ManipulationJoints = AZStd::unordered_map<AZStd::string, JointInfo>;
+
+    //! States of a set of joints, stored in contiguous arrays indexed by JointIndex.
+    struct JointsStates
+    {
+        AZStd::vector<JointPosition> m_positions;
+        AZStd::vector<JointVelocity> m_velocities;
+        AZStd::vector<JointEffort> m_efforts;
+    };
 } // namespace ROS2
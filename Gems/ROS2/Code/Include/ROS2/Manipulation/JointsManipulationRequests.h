@@ -32,6 +32,23 @@ namespace ROS2
         //! @note Only free joints are returned (no fixed ones).
         virtual ManipulationJoints GetJoints() = 0;
 
+        //! Get names of all free joints in a stable order.
+        //! @return a vector of joint names, where the position of each name is its JointIndex.
+        //! @note Indices stay valid until the joints change, see JointsManipulationNotifications::OnJointsChanged.
+        //! Resolve them once and use index-based queries afterwards.
+        virtual AZStd::vector<AZStd::string> GetJointNames() = 0;
+
+        //! Resolve a joint name to its index.
+        //! @param jointName name of the joint. Use names acquired from GetJoints() or GetJointNames() query.
+        //! @return outcome with the joint index if joint exists, error message otherwise.
+        virtual AZ::Outcome<JointIndex, AZStd::string> GetJointIndex(const AZStd::string& jointName) = 0;
+
+        //! Read the state of all single DOF joints in a single pass.
+        //! @param states output arrays, resized to the number of joints and filled in JointIndex order.
+        //! @param includeEfforts whether to compute efforts, which requires additional drive queries for each articulation link.
+        //! When false, the efforts array is left empty.
+        virtual void GetAllJointsStates(JointsStates& states, bool includeEfforts) = 0;
+
         //! Get position of a joint by name.
         //! Works with hinge joints and articulation links.
         //! @param jointName name of the joint. Use names acquired from GetJoints() query.
@@ -71,6 +88,14 @@ namespace ROS2
         //! @note the movement is realized by a specific controller and not instant. The joints will then keep these positions.
         virtual AZ::Outcome<void, AZStd::string> MoveJointsToPositions(const JointsPositionsMap& positions) = 0;
 
+        //! Move joints selected by index into positions.
+        //! @param jointIndices indices of joints to move. Use indices acquired from GetJointNames() or GetJointIndex() query.
+        //! @param positions relative positions to achieve, one for each entry in jointIndices.
+        //! @return nothing on success, error message on failure.
+        //! @note the movement is realized by a specific controller and not instant. The joints will then keep these positions.
+        virtual AZ::Outcome<void, AZStd::string> MoveJointsToPositionsByIndex(
+            const AZStd::vector<JointIndex>& jointIndices, const AZStd::vector<JointPosition>& positions) = 0;
+
         //! Move a single joint into desired relative position.
         //! @param jointName name of the joint. Use names acquired from GetJoints() query.
         //! @param position relative position in degree of motion range to achieve.
@@ -89,4 +114,17 @@ namespace ROS2
         virtual void Stop() = 0;
     };
     using JointsManipulationRequestBus = AZ::EBus<JointsManipulationRequests>;
+
+    //! Notifications of a joints manipulation component, addressed by its entity.
+    class JointsManipulationNotifications : public AZ::EBusTraits
+    {
+    public:
+        using BusIdType = AZ::EntityId;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+
+        //! The set of manipulated joints has been gathered or changed.
+        //! Joint indices resolved before are no longer valid and need to be resolved again.
+        virtual void OnJointsChanged() = 0;
+    };
+    using JointsManipulationNotificationBus = AZ::EBus<JointsManipulationNotifications>;
 } // namespace ROS2
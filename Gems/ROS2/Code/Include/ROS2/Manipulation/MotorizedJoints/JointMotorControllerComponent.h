@@ -9,17 +9,15 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ImGuiBus.h>
 #include <ROS2/Manipulation/MotorizedJoints/JointMotorControllerConfiguration.h>
-#include <builtin_interfaces/msg/time.hpp>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
 
 namespace ROS2
 {
     class JointMotorControllerComponent
         : public AZ::Component
-        , public AZ::TickBus::Handler
         , public ImGui::ImGuiUpdateListenerBus::Handler
         , public AZ::EntityBus::Handler
     {
@@ -57,9 +55,9 @@ namespace ROS2
 
         virtual void DisplayControllerParameters(){};
 
-        // AZ::TickBus overrides
-        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //! Run by the control loop at every physics substep.
+        void Control(float deltaTime);
 
-        builtin_interfaces::msg::Time m_lastTickTimestamp; //!< ROS 2 Timestamp during last OnTick call
+        ControlLoopRequests::ControllerHandle m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
     };
 } // namespace ROS2
@@ -64,6 +64,12 @@ namespace ROS2
         //! Obtains a simulation clock that is used across simulation.
         //! @returns constant reference to currently running clock.
         virtual const ROS2Clock& GetSimulationClock() const = 0;
+
+        //! Get the callback group for latency-sensitive control subscriptions, such as robot velocity commands.
+        //! Callbacks of this group are executed on a dedicated executor thread as soon as messages arrive, rather than once per frame.
+        //! Callbacks must therefore be thread-safe, for example by writing into a LatestValueSlot read by a physics-rate controller.
+        //! @return The control callback group, or nullptr if there is no node.
+        virtual rclcpp::CallbackGroup::SharedPtr GetControlCallbackGroup() const = 0;
     };
 
     class ROS2BusTraits : public AZ::EBusTraits
@@ -32,5 +32,7 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
         Steering m_steering = Steering::Twist;
+        //! Commands older than this (in seconds) are considered stale and the robot is stopped (deadman).
+        float m_commandTimeout = 0.2f;
     };
 } // namespace ROS2
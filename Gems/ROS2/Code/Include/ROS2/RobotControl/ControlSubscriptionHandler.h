@@ -7,9 +7,14 @@
  */
 #pragma once
 
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <ROS2/Communication/TopicConfiguration.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/ROS2Bus.h>
+#include <ROS2/Utilities/Controllers/LatestValueSlot.h>
 #include <ROS2/Utilities/ROS2Names.h>
 #include <rclcpp/rclcpp.hpp>
 
@@ -30,38 +35,67 @@ namespace ROS2
     };
 
     //! The generic class for handling subscriptions to ROS2 control messages of different types.
+    //! Messages are received on the control executor thread (@see ROS2Requests::GetControlCallbackGroup) and converted into commands,
+    //! which are stored in a LatestValueSlot for controllers running at physics rate.
+    //! Notifications with the latest command are additionally sent on the main thread, once per frame at most.
     //! @see ControlConfiguration::Steering.
-    template<typename T>
+    template<typename T, typename Command>
     class ControlSubscriptionHandler : public IControlSubscriptionHandler
     {
     public:
+        //! @param commandSlot slot to store received commands in. Must outlive the handler.
+        explicit ControlSubscriptionHandler(LatestValueSlot<Command>& commandSlot)
+            : m_commandSlot(commandSlot)
+            , m_callbackGuard(AZStd::make_shared<CallbackGuard>())
+        {
+        }
+
         void Activate(const AZ::Entity* entity, const TopicConfiguration& subscriberConfiguration) override final
         {
-            m_active = true;
             m_entityId = entity->GetId();
+            m_notificationQueued = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_callbackGuard->m_mutex);
+                m_callbackGuard->m_handler = this;
+            }
             if (!m_controlSubscription)
             {
                 auto ros2Frame = entity->FindComponent<ROS2FrameComponent>();
                 AZStd::string namespacedTopic = ROS2Names::GetNamespacedName(ros2Frame->GetNamespace(), subscriberConfiguration.m_topic);
 
-                auto ros2Node = ROS2Interface::Get()->GetNode();
-                m_controlSubscription = ros2Node->create_subscription<T>(
+                auto* ros2Interface = ROS2Interface::Get();
+                rclcpp::SubscriptionOptions subscriptionOptions;
+                subscriptionOptions.callback_group = ros2Interface->GetControlCallbackGroup();
+                // The callback runs on the control executor thread and may still be in flight when the subscription is reset,
+                // so it captures the guard rather than the handler.
+                m_controlSubscription = ros2Interface->GetNode()->create_subscription<T>(
                     namespacedTopic.data(),
                     subscriberConfiguration.GetQoS(),
-                    [this](const T& message)
+                    [guard = m_callbackGuard](const T& message)
                     {
-                        OnControlMessage(message);
-                    });
+                        AZStd::lock_guard<AZStd::mutex> lock(guard->m_mutex);
+                        if (guard->m_handler)
+                        {
+                            guard->m_handler->OnControlMessage(message);
+                        }
+                    },
+                    subscriptionOptions);
             }
         };
 
         void Deactivate() override final
         {
-            m_active = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_callbackGuard->m_mutex);
+                m_callbackGuard->m_handler = nullptr;
+            }
             m_controlSubscription.reset(); // Note: topic and qos can change, need to re-subscribe
         };
 
-        virtual ~ControlSubscriptionHandler() = default;
+        virtual ~ControlSubscriptionHandler()
+        {
+            Deactivate();
+        }
 
     protected:
         AZ::EntityId GetEntityId() const
@@ -70,20 +104,42 @@ namespace ROS2
         }
 
     private:
+        struct CallbackGuard
+        {
+            AZStd::mutex m_mutex; //!< Held while a message is processed, so the handler is not deactivated meanwhile
+            ControlSubscriptionHandler* m_handler = nullptr; //!< Null when deactivated
+        };
+
         void OnControlMessage(const T& message)
         {
-            if (!m_active)
+            m_commandSlot.Write(ConvertMessage(message));
+
+            // Coalesce notifications, handlers on the main thread only need the latest command.
+            if (!m_notificationQueued.exchange(true))
             {
-                return;
+                AZ::TickBus::QueueFunction(
+                    [guard = m_callbackGuard]()
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(guard->m_mutex);
+                        if (guard->m_handler)
+                        {
+                            guard->m_handler->m_notificationQueued = false;
+                            guard->m_handler->SendToBus(guard->m_handler->m_commandSlot.ReadOrDefault(AZStd::chrono::nanoseconds::max()));
+                        }
+                    });
             }
-
-            SendToBus(message);
         };
 
-        virtual void SendToBus(const T& message) = 0;
+        //! Convert a received message into a command. Called on the control executor thread.
+        virtual Command ConvertMessage(const T& message) const = 0;
+
+        //! Notify handlers of the latest command. Called on the main thread.
+        virtual void SendToBus(const Command& command) = 0;
 
         AZ::EntityId m_entityId;
-        bool m_active = false;
+        LatestValueSlot<Command>& m_commandSlot;
+        AZStd::shared_ptr<CallbackGuard> m_callbackGuard;
+        AZStd::atomic_bool m_notificationQueued{ false };
         typename rclcpp::Subscription<T>::SharedPtr m_controlSubscription;
     };
 } // namespace ROS2
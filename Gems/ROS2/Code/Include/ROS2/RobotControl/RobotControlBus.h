@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/EBus/EBus.h>
+#include <ROS2/RobotControl/Ackermann/AckermannCommandStruct.h>
+#include <ROS2/RobotControl/Twist/TwistCommandStruct.h>
+#include <ROS2/Utilities/Controllers/LatestValueSlot.h>
+
+namespace ROS2
+{
+    using TwistCommandSlot = LatestValueSlot<TwistCommandStruct>;
+    using AckermannCommandSlot = LatestValueSlot<AckermannCommandStruct>;
+
+    //! Interface to the latest commands received by ROS2RobotControlComponent.
+    //! Controllers running at physics rate read commands from the slots directly, without waiting for notifications.
+    //! Slots are valid as long as the robot control component is active.
+    class RobotControlRequests : public AZ::EBusTraits
+    {
+    public:
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = AZ::EntityId;
+
+        //! @return slot holding the latest Twist command, or nullptr if the robot is not controlled through Twist.
+        virtual const TwistCommandSlot* GetTwistCommandSlot() const = 0;
+
+        //! @return slot holding the latest Ackermann command, or nullptr if the robot is not controlled through Ackermann.
+        virtual const AckermannCommandSlot* GetAckermannCommandSlot() const = 0;
+
+        //! @return time in seconds after which commands are stale and controllers should stop the robot.
+        virtual float GetCommandTimeout() const = 0;
+
+        //! Age of the latest command, useful as a measure of control latency and for detecting a lost command source.
+        //! @return time in seconds since the latest command was received, or a negative value if none was received yet.
+        virtual float GetCommandAge() const = 0;
+    };
+
+    using RobotControlRequestBus = AZ::EBus<RobotControlRequests>;
+} // namespace ROS2
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/TypeInfo.h>
+
+namespace ROS2
+{
+    //! Abstracted from ROS message: https://docs.ros2.org/latest/api/geometry_msgs/msg/Twist.html
+    //! Components are stored as plain floats, so the structure can be kept in a LatestValueSlot.
+    struct TwistCommandStruct
+    {
+        AZ_TYPE_INFO(TwistCommandStruct, "{2B5E7C41-9D3A-4F86-A1C0-6E8B3D2F9A57}");
+        float m_linear[3] = { 0.0f, 0.0f, 0.0f }; //!< desired linear velocity in robot reference frame (m/s)
+        float m_angular[3] = { 0.0f, 0.0f, 0.0f }; //!< desired angular velocity in robot reference frame (rad/s)
+
+        AZ::Vector3 GetLinear() const
+        {
+            return AZ::Vector3::CreateFromFloat3(m_linear);
+        }
+
+        AZ::Vector3 GetAngular() const
+        {
+            return AZ::Vector3::CreateFromFloat3(m_angular);
+        }
+    };
+} // namespace ROS2
@@ -11,6 +11,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/vector.h>
 #include <ROS2/Spawner/SpawnerInfo.h>
 
 namespace ROS2
@@ -34,4 +35,37 @@ namespace ROS2
     };
 
     using SpawnerRequestsBus = AZ::EBus<SpawnerRequests>;
+
+    //! Interface for spawning robots from the spawner component during the simulation.
+    //! Spawning is asynchronous: requests are queued and completion is reported for every robot separately.
+    //! Despawned robots are kept spawned but deactivated, pooled per spawnable and activated again by the following spawns.
+    class SpawnerBatchRequests : public AZ::ComponentBus
+    {
+    public:
+        AZ_RTTI(SpawnerBatchRequests, "{0B7E3D52-6C1A-4F8E-A4D9-5E2B7C31F9A6}");
+
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+
+        virtual ~SpawnerBatchRequests() = default;
+
+        //! Spawn a number of robots in a single request.
+        //! @param robots robots to spawn, each with its spawnable, namespace and pose.
+        //! @param callback called once for every robot, when it is spawned or when its request is rejected.
+        //! Rejected requests are reported immediately, the others as soon as the spawning completes.
+        virtual void SpawnRobots(const AZStd::vector<SpawnRobotInfo>& robots, SpawnRobotCallback callback) = 0;
+
+        //! Despawn a robot by deactivating its entities and returning it to the pool.
+        //! @param instanceName name of the robot instance, as reported when it was spawned.
+        //! @return true if the robot was found and its despawning was queued.
+        virtual bool DespawnRobot(const AZStd::string& instanceName) = 0;
+
+        //! Spawn robots of a spawnable ahead of time and park them in the pool, so that the following spawns only activate them.
+        //! The prewarmed robots are briefly active when their spawning completes, before they are deactivated.
+        //! @param spawnableName name of the spawnable, as set in the spawner component.
+        //! @param count number of robots to keep in the pool.
+        //! @return true if the spawnable is known and loaded.
+        virtual bool PrewarmRobots(const AZStd::string& spawnableName, AZStd::size_t count) = 0;
+    };
+
+    using SpawnerBatchRequestsBus = AZ::EBus<SpawnerBatchRequests>;
 } // namespace ROS2
@@ -11,7 +11,9 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Outcome/Outcome.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
 
 namespace ROS2
@@ -23,4 +25,18 @@ namespace ROS2
     };
 
     using SpawnPointInfoMap = AZStd::unordered_map<AZStd::string, SpawnPointInfo>;
+
+    //! Description of a single robot to be spawned.
+    struct SpawnRobotInfo
+    {
+        AZStd::string m_spawnableName; //!< Name of the spawnable, as set in the spawner component.
+        AZStd::string m_namespace; //!< Namespace of the robot, the default namespace is used if empty.
+        AZ::Transform m_pose = AZ::Transform::CreateIdentity(); //!< Pose of the robot in the level.
+    };
+
+    //! Outcome of spawning a single robot: the name of the spawned instance (usable for despawning) or an error message.
+    using SpawnRobotOutcome = AZ::Outcome<AZStd::string, AZStd::string>;
+
+    //! Callback called once per spawned robot, with the index of the robot in the request.
+    using SpawnRobotCallback = AZStd::function<void(AZStd::size_t robotIndex, const SpawnRobotOutcome& outcome)>;
 } // namespace ROS2
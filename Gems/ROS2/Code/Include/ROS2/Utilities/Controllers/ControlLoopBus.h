@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/functional.h>
+
+namespace ROS2
+{
+    //! Interface to the control loop, which runs registered controllers on the physics simulation start event.
+    //! Controllers run once per physics substep with the fixed physics delta time, independent of the render frame rate.
+    //! Controllers of a single robot always run sequentially in the order of registration. Controllers registered for different
+    //! robots run sequentially too, unless the /O3DE/ROS2/ControlLoop/RunInParallel registry key enables running them in parallel
+    //! on the job system.
+    //! Use this API through ControlLoopInterface, for example:
+    //! @code
+    //! m_controllerHandle = ControlLoopInterface::Get()->RegisterController(GetEntityId(), [this](float deltaTime) { Control(deltaTime); });
+    //! @endcode
+    class ControlLoopRequests
+    {
+    public:
+        AZ_RTTI(ControlLoopRequests, "{6F0C4E1B-8A3D-4B27-9E5F-2D7A1C9B3E84}");
+        virtual ~ControlLoopRequests() = default;
+
+        using ControllerHandle = AZ::u64;
+        static constexpr ControllerHandle InvalidControllerHandle = 0;
+
+        //! Controller function, called with the simulated time step in seconds.
+        using ControllerFunction = AZStd::function<void(float deltaTime)>;
+
+        //! Register a controller to be run at every physics substep.
+        //! @param entityId entity of the controller. Controllers sharing the top-level ancestor of their entities belong to the same robot
+        //! and are run sequentially, so they can safely share state.
+        //! @param controller function to run.
+        //! @return handle of the registered controller, to be used for unregistering.
+        //! @note With the parallel control loop enabled, controllers of different robots run concurrently and must not write state
+        //! shared with other robots, including the physics scene.
+        virtual ControllerHandle RegisterController(const AZ::EntityId& entityId, ControllerFunction controller) = 0;
+
+        //! Unregister a previously registered controller. Unknown or invalid handles are ignored.
+        //! @param handle handle returned by RegisterController.
+        virtual void UnregisterController(ControllerHandle handle) = 0;
+    };
+
+    using ControlLoopInterface = AZ::Interface<ControlLoopRequests>;
+} // namespace ROS2
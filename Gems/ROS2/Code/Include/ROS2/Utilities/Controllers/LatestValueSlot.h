@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+#include <string.h>
+
+namespace ROS2
+{
+    //! Lock-free slot holding the most recently written value along with the time it was written.
+    //! Intended for passing commands from a subscription callback to a controller running at physics rate:
+    //! older values are overwritten, so the reader always gets the freshest one and never waits for the writer.
+    //! The slot is a sequence lock: a reader retries when it overlapped with a write.
+    //! @note Only a single thread may write at a time, any number of threads may read.
+    template<typename T>
+    class LatestValueSlot
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "LatestValueSlot only supports trivially copyable values");
+
+    public:
+        using Clock = AZStd::chrono::steady_clock;
+
+        //! Store a new value, stamped with the current time.
+        void Write(const T& value)
+        {
+            Payload payload;
+            payload.m_value = value;
+            payload.m_stampNs = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+
+            AZ::u64 words[WordCount] = {};
+            memcpy(words, &payload, sizeof(Payload));
+
+            // An odd sequence marks a write in progress.
+            const AZ::u64 sequence = m_sequence.load(AZStd::memory_order_relaxed);
+            m_sequence.store(sequence + 1, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            for (size_t i = 0; i < WordCount; ++i)
+            {
+                m_words[i].store(words[i], AZStd::memory_order_relaxed);
+            }
+            m_sequence.store(sequence + 2, AZStd::memory_order_release);
+        }
+
+        //! Read the latest value.
+        //! @param value is set to the latest value, if any was written.
+        //! @param age is set to the time elapsed since the latest value was written.
+        //! @return false if no value was written yet, in which case outputs are left untouched.
+        bool Read(T& value, AZStd::chrono::nanoseconds& age) const
+        {
+            AZ::u64 words[WordCount];
+            AZ::u64 sequence = 0;
+            do
+            {
+                sequence = m_sequence.load(AZStd::memory_order_acquire);
+                for (size_t i = 0; i < WordCount; ++i)
+                {
+                    words[i] = m_words[i].load(AZStd::memory_order_relaxed);
+                }
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            } while ((sequence & 1) != 0 || sequence != m_sequence.load(AZStd::memory_order_relaxed));
+
+            if (sequence == 0)
+            {
+                return false;
+            }
+
+            Payload payload;
+            memcpy(&payload, words, sizeof(Payload));
+            value = payload.m_value;
+            const AZ::s64 nowNs = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+            age = AZStd::chrono::nanoseconds(nowNs - payload.m_stampNs);
+            return true;
+        }
+
+        //! Read the latest value, unless it is older than the timeout (deadman).
+        //! @param timeout maximum age of the value.
+        //! @return the latest value, or a default constructed value if none was written or it timed out.
+        T ReadOrDefault(AZStd::chrono::nanoseconds timeout) const
+        {
+            T value;
+            AZStd::chrono::nanoseconds age;
+            if (!Read(value, age) || age > timeout)
+            {
+                return T{};
+            }
+            return value;
+        }
+
+        //! @return true if a value was written at least once.
+        bool HasValue() const
+        {
+            return m_sequence.load(AZStd::memory_order_acquire) != 0;
+        }
+
+    private:
+        struct Payload
+        {
+            T m_value;
+            AZ::s64 m_stampNs;
+        };
+        static constexpr size_t WordCount = (sizeof(Payload) + sizeof(AZ::u64) - 1) / sizeof(AZ::u64);
+
+        AZStd::atomic<AZ::u64> m_sequence{ 0 };
+        AZStd::atomic<AZ::u64> m_words[WordCount] = {};
+    };
+} // namespace ROS2
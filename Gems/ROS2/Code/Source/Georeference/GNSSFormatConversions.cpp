@@ -7,6 +7,7 @@
  */
 
 #include "Georeference/GNSSFormatConversions.h"
+#include <AzCore/Debug/Trace.h>
 
 constexpr double earthSemimajorAxis = 6378137.0;
 constexpr double reciprocalFlattening = 1.0 / 298.257223563;
@@ -110,4 +111,78 @@ namespace ROS2::Utils::GeodeticConversions
         return { RadToDeg(latitude), RadToDeg(longitude), altitude };
     }
 
+    ENUFrame::ENUFrame()
+        : ENUFrame(WGS::WGS84Coordinate(0.0, 0.0, 0.0))
+    {
+    }
+
+    ENUFrame::ENUFrame(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude)
+        : m_originECEF(WGS84ToECEF(referenceLatitudeLongitudeAltitude))
+    {
+        const double referenceLatitudeRad = DegToRad(referenceLatitudeLongitudeAltitude.m_latitude);
+        const double referenceLongitudeRad = DegToRad(referenceLatitudeLongitudeAltitude.m_longitude);
+        const double sinLatitude = std::sin(referenceLatitudeRad);
+        const double cosLatitude = std::cos(referenceLatitudeRad);
+        const double sinLongitude = std::sin(referenceLongitudeRad);
+        const double cosLongitude = std::cos(referenceLongitudeRad);
+
+        // East
+        m_rotation[0][0] = -sinLongitude;
+        m_rotation[0][1] = cosLongitude;
+        m_rotation[0][2] = 0.0;
+        // North
+        m_rotation[1][0] = -sinLatitude * cosLongitude;
+        m_rotation[1][1] = -sinLatitude * sinLongitude;
+        m_rotation[1][2] = cosLatitude;
+        // Up
+        m_rotation[2][0] = cosLatitude * cosLongitude;
+        m_rotation[2][1] = cosLatitude * sinLongitude;
+        m_rotation[2][2] = sinLatitude;
+    }
+
+    WGS::Vector3d ENUFrame::ECEFToENU(const WGS::Vector3d& ECEFPoint) const
+    {
+        const double x = ECEFPoint.m_x - m_originECEF.m_x;
+        const double y = ECEFPoint.m_y - m_originECEF.m_y;
+        const double z = ECEFPoint.m_z - m_originECEF.m_z;
+        return { m_rotation[0][0] * x + m_rotation[0][1] * y + m_rotation[0][2] * z,
+                 m_rotation[1][0] * x + m_rotation[1][1] * y + m_rotation[1][2] * z,
+                 m_rotation[2][0] * x + m_rotation[2][1] * y + m_rotation[2][2] * z };
+    }
+
+    WGS::Vector3d ENUFrame::ENUToECEF(const WGS::Vector3d& ENUPoint) const
+    {
+        const double e = ENUPoint.m_x;
+        const double n = ENUPoint.m_y;
+        const double u = ENUPoint.m_z;
+        return { m_rotation[0][0] * e + m_rotation[1][0] * n + m_rotation[2][0] * u + m_originECEF.m_x,
+                 m_rotation[0][1] * e + m_rotation[1][1] * n + m_rotation[2][1] * u + m_originECEF.m_y,
+                 m_rotation[0][2] * e + m_rotation[1][2] * n + m_rotation[2][2] * u + m_originECEF.m_z };
+    }
+
+    void ENUFrame::ECEFToENU(AZStd::span<const WGS::Vector3d> ECEFPoints, AZStd::span<WGS::Vector3d> ENUPoints) const
+    {
+        AZ_Assert(ECEFPoints.size() == ENUPoints.size(), "Input and output sizes differ: %zu != %zu", ECEFPoints.size(), ENUPoints.size());
+        const size_t count = AZStd::min(ECEFPoints.size(), ENUPoints.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            ENUPoints[i] = ECEFToENU(ECEFPoints[i]);
+        }
+    }
+
+    void ENUFrame::ENUToECEF(AZStd::span<const WGS::Vector3d> ENUPoints, AZStd::span<WGS::Vector3d> ECEFPoints) const
+    {
+        AZ_Assert(ENUPoints.size() == ECEFPoints.size(), "Input and output sizes differ: %zu != %zu", ENUPoints.size(), ECEFPoints.size());
+        const size_t count = AZStd::min(ENUPoints.size(), ECEFPoints.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            ECEFPoints[i] = ENUToECEF(ENUPoints[i]);
+        }
+    }
+
+    const WGS::Vector3d& ENUFrame::GetOriginECEF() const
+    {
+        return m_originECEF;
+    }
+
 } // namespace ROS2::GNSS
@@ -8,6 +8,7 @@
 
 #pragma once
 #include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/std/containers/span.h>
 #include <ROS2/Georeference/GeoreferenceStructures.h>
 
 namespace ROS2::Utils::GeodeticConversions
@@ -40,4 +41,41 @@ namespace ROS2::Utils::GeodeticConversions
     //!     latitude and longitude are in decimal degrees
     //!     altitude is in meters
     WGS::WGS84Coordinate ECEFToWGS84(const WGS::Vector3d& ECFEPoint);
+
+    //! Local east, north, up (ENU) tangent plane at a reference point.
+    //! The ECEF position of the reference point and the rotation between ECEF and ENU are computed once on construction,
+    //! so converting a point costs a subtraction and a 3x3 matrix multiplication, without trigonometric functions.
+    //! Results match ECEFToENU and ENUToECEF called with the same reference point.
+    class ENUFrame
+    {
+    public:
+        //! Creates the frame at latitude, longitude and altitude equal to zero.
+        ENUFrame();
+
+        //! @param referenceLatitudeLongitudeAltitude - reference point's latitude, longitude and altitude as WGS::WGS84Coordinate.
+        explicit ENUFrame(const WGS::WGS84Coordinate& referenceLatitudeLongitudeAltitude);
+
+        //! Converts Earth Centred Earth Fixed (ECEF) coordinates to local east, north, up (ENU).
+        WGS::Vector3d ECEFToENU(const WGS::Vector3d& ECEFPoint) const;
+
+        //! Converts local east, north, up (ENU) coordinates to Earth Centred Earth Fixed (ECEF).
+        WGS::Vector3d ENUToECEF(const WGS::Vector3d& ENUPoint) const;
+
+        //! Converts a batch of ECEF points to ENU.
+        //! @param ECEFPoints - points to be converted.
+        //! @param ENUPoints - converted points, must have the same size as ECEFPoints. Might be the same memory as ECEFPoints.
+        void ECEFToENU(AZStd::span<const WGS::Vector3d> ECEFPoints, AZStd::span<WGS::Vector3d> ENUPoints) const;
+
+        //! Converts a batch of ENU points to ECEF.
+        //! @param ENUPoints - points to be converted.
+        //! @param ECEFPoints - converted points, must have the same size as ENUPoints. Might be the same memory as ENUPoints.
+        void ENUToECEF(AZStd::span<const WGS::Vector3d> ENUPoints, AZStd::span<WGS::Vector3d> ECEFPoints) const;
+
+        //! @return ECEF coordinates of the reference point.
+        const WGS::Vector3d& GetOriginECEF() const;
+
+    private:
+        WGS::Vector3d m_originECEF; //!< Reference point in ECEF
+        double m_rotation[3][3]; //!< Rotation from ECEF to ENU, rows are the east, north and up axes expressed in ECEF
+    };
 } // namespace ROS2::Utils::GeodeticConversions
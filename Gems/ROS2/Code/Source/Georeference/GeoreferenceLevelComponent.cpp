@@ -74,6 +74,7 @@ namespace ROS2
 
     void GeoReferenceLevelController::Activate(AZ::EntityId entityId)
     {
+        m_enuFrame = Utils::GeodeticConversions::ENUFrame(m_config.m_originLocation);
         AZ::EntityBus::Handler::BusConnect(m_config.m_enuOriginLocationEntityId);
         GeoreferenceRequestsBus::Handler::BusConnect();
     }
@@ -88,6 +89,7 @@ namespace ROS2
     {
         m_enuOriginTransform = AZ::Transform::CreateIdentity();
         AZ::TransformBus::EventResult(m_enuOriginTransform, m_config.m_enuOriginLocationEntityId, &AZ::TransformBus::Events::GetWorldTM);
+        m_enuToLevelTransform = m_enuOriginTransform;
         m_enuOriginTransform.Invert();
         AZ::EntityBus::Handler::BusDisconnect();
     }
@@ -96,7 +98,7 @@ namespace ROS2
     {
         using namespace ROS2::Utils::GeodeticConversions;
         const auto enu = WGS::Vector3d(m_enuOriginTransform.TransformPoint(xyz));
-        const auto ecef = ENUToECEF(m_config.m_originLocation, enu);
+        const auto ecef = m_enuFrame.ENUToECEF(enu);
         return ECEFToWGS84(ecef);
     }
 
@@ -104,8 +106,8 @@ namespace ROS2
     {
         using namespace ROS2::Utils::GeodeticConversions;
         const auto ecef = WGS84ToECEF(latLon);
-        const auto enu = ECEFToENU(m_config.m_originLocation, ecef);
-        return m_enuOriginTransform.GetInverse().TransformPoint(enu.ToVector3f());
+        const auto enu = m_enuFrame.ECEFToENU(ecef);
+        return m_enuToLevelTransform.TransformPoint(enu.ToVector3f());
     };
 
     AZ::Quaternion GeoReferenceLevelController::GetRotationFromLevelToENU()
@@ -113,9 +115,36 @@ namespace ROS2
         return m_enuOriginTransform.GetRotation();
     };
 
+    void GeoReferenceLevelController::ConvertFromLevelToWGS84Batch(
+        AZStd::span<const AZ::Vector3> xyz, AZStd::span<WGS::WGS84Coordinate> latLon)
+    {
+        using namespace ROS2::Utils::GeodeticConversions;
+        AZ_Assert(xyz.size() == latLon.size(), "Input and output sizes differ: %zu != %zu", xyz.size(), latLon.size());
+        const size_t count = AZStd::min(xyz.size(), latLon.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto enu = WGS::Vector3d(m_enuOriginTransform.TransformPoint(xyz[i]));
+            latLon[i] = ECEFToWGS84(m_enuFrame.ENUToECEF(enu));
+        }
+    }
+
+    void GeoReferenceLevelController::ConvertFromWGS84ToLevelBatch(
+        AZStd::span<const WGS::WGS84Coordinate> latLon, AZStd::span<AZ::Vector3> xyz)
+    {
+        using namespace ROS2::Utils::GeodeticConversions;
+        AZ_Assert(latLon.size() == xyz.size(), "Input and output sizes differ: %zu != %zu", latLon.size(), xyz.size());
+        const size_t count = AZStd::min(latLon.size(), xyz.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto enu = m_enuFrame.ECEFToENU(WGS84ToECEF(latLon[i]));
+            xyz[i] = m_enuToLevelTransform.TransformPoint(enu.ToVector3f());
+        }
+    }
+
     void GeoReferenceLevelController::SetConfiguration(const GeoReferenceLevelConfig& config)
     {
         m_config = config;
+        m_enuFrame = Utils::GeodeticConversions::ENUFrame(m_config.m_originLocation);
     }
 
     const GeoReferenceLevelConfig& GeoReferenceLevelController::GetConfiguration() const
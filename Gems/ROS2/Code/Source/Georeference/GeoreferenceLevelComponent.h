@@ -6,6 +6,7 @@
  *
  */
 #pragma once
+#include "GNSSFormatConversions.h"
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Math/Transform.h>
@@ -52,9 +53,14 @@ namespace ROS2
         WGS::WGS84Coordinate ConvertFromLevelToWGS84(const AZ::Vector3& xyz) override;
         AZ::Vector3 ConvertFromWGS84ToLevel(const WGS::WGS84Coordinate& latLon) override;
         AZ::Quaternion GetRotationFromLevelToENU() override;
+        void ConvertFromLevelToWGS84Batch(AZStd::span<const AZ::Vector3> xyz, AZStd::span<WGS::WGS84Coordinate> latLon) override;
+        void ConvertFromWGS84ToLevelBatch(AZStd::span<const WGS::WGS84Coordinate> latLon, AZStd::span<AZ::Vector3> xyz) override;
 
         GeoReferenceLevelConfig m_config;
-        AZ::Transform m_enuOriginTransform; //!< Transform of the entity that lays in the origin of the ENU coordinate system
+        //! Inverse of the transform of the entity that lays in the origin of the ENU coordinate system (level to ENU)
+        AZ::Transform m_enuOriginTransform = AZ::Transform::CreateIdentity();
+        AZ::Transform m_enuToLevelTransform = AZ::Transform::CreateIdentity(); //!< Inverse of m_enuOriginTransform
+        Utils::GeodeticConversions::ENUFrame m_enuFrame; //!< Tangent plane at the configured origin location
     };
 
     using GeoReferenceLevelComponentBase = AzFramework::Components::ComponentAdapter<GeoReferenceLevelController, GeoReferenceLevelConfig>;
@@ -38,6 +38,7 @@ namespace ROS2
         m_ImGuiPosition = 0.0f;
         m_stallingFor = 0.0f;
         AZ::TickBus::Handler::BusConnect();
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
         ImGui::ImGuiUpdateListenerBus::Handler::BusConnect();
         GripperRequestBus::Handler::BusConnect(GetEntityId());
     }
@@ -45,8 +46,16 @@ namespace ROS2
     void FingerGripperComponent::Deactivate()
     {
         AZ::TickBus::Handler::BusDisconnect();
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
+        JointsManipulationNotificationBus::Handler::BusDisconnect();
         ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
         GripperRequestBus::Handler::BusDisconnect(GetEntityId());
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            controlLoop->UnregisterController(m_controllerHandle);
+        }
+        m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
+        InvalidateFingerJoints();
     }
 
     void FingerGripperComponent::Reflect(AZ::ReflectContext* context)
@@ -86,66 +95,119 @@ namespace ROS2
         }
     }
 
-    ManipulationJoints& FingerGripperComponent::GetFingerJoints()
+    AZ::Outcome<void, AZStd::string> FingerGripperComponent::CacheFingerJoints()
     {
-        m_fingerJoints.clear();
+        InvalidateFingerJoints();
+        JointsManipulationNotificationBus::Handler::BusDisconnect();
         m_rootOfArticulation = Utils::GetRootOfArticulation(GetEntityId());
         AZ_Warning(
             "FingerGripperComponent",
             m_rootOfArticulation.IsValid(),
             "Entity %s is not part of an articulation.",
             GetEntity()->GetName().c_str());
-        ManipulationJoints allJoints;
-        if (m_rootOfArticulation.IsValid())
+        if (!m_rootOfArticulation.IsValid())
         {
-            JointsManipulationRequestBus::EventResult(allJoints, m_rootOfArticulation, &JointsManipulationRequests::GetJoints);
+            return AZ::Success();
         }
+        JointsManipulationRequestBus::Bind(m_jointsManipulationBus, m_rootOfArticulation);
+        // Indices are resolved again whenever the joints manipulation component gathers or changes its joints.
+        JointsManipulationNotificationBus::Handler::BusConnect(m_rootOfArticulation);
+
         AZStd::vector<AZ::EntityId> descendantIds;
         AZ::TransformBus::EventResult(descendantIds, GetEntityId(), &AZ::TransformBus::Events::GetAllDescendants);
 
+        AZStd::string unresolvedJoints;
         for (AZ::EntityId descendant : descendantIds)
         {
             AZStd::string jointName = ROS2::Utils::GetJointName(descendant);
-            if (!jointName.empty())
+            if (jointName.empty())
+            {
+                continue;
+            }
+            AZ::Outcome<JointIndex, AZStd::string> jointIndex = AZ::Failure(AZStd::string("No joints manipulation component"));
+            JointsManipulationRequestBus::EventResult(
+                jointIndex, m_jointsManipulationBus, &JointsManipulationRequests::GetJointIndex, jointName);
+            if (jointIndex.IsSuccess())
+            {
+                m_fingerJointNames.push_back(jointName);
+                m_fingerJointIndices.push_back(jointIndex.GetValue());
+            }
+            else
             {
-                AZ_Printf("FingerGripperComponent", "Adding finger joint %s", jointName.c_str());
-                m_fingerJoints[jointName] = allJoints[jointName];
+                unresolvedJoints += AZStd::string::format(
+                    "%s%s (%s)", unresolvedJoints.empty() ? "" : ", ", jointName.c_str(), jointIndex.GetError().c_str());
             }
         }
 
-        return m_fingerJoints;
+        if (!unresolvedJoints.empty())
+        { // Keep the notification connection, but no partial set of fingers.
+            m_fingerJointNames.clear();
+            m_fingerJointIndices.clear();
+            return AZ::Failure(unresolvedJoints);
+        }
+        for (const auto& jointName : m_fingerJointNames)
+        {
+            AZ_Printf("FingerGripperComponent", "Adding finger joint %s", jointName.c_str());
+        }
+        return AZ::Success();
+    }
+
+    void FingerGripperComponent::InvalidateFingerJoints()
+    {
+        m_fingerJointNames.clear();
+        m_fingerJointIndices.clear();
+        m_jointsManipulationBus = nullptr;
+    }
+
+    void FingerGripperComponent::OnChildAdded([[maybe_unused]] AZ::EntityId child)
+    {
+        // Fingers are gathered again on the next tick, when the new hierarchy is complete.
+        m_initialised = false;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void FingerGripperComponent::OnChildRemoved(AZ::EntityId child)
+    {
+        OnChildAdded(child);
+    }
+
+    void FingerGripperComponent::OnJointsChanged()
+    {
+        // Cached indices are no longer valid, fingers are resolved again on the next tick.
+        InvalidateFingerJoints();
+        m_initialised = false;
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void FingerGripperComponent::ReadJointsStates(JointsStates& states, bool includeEfforts) const
+    {
+        JointsManipulationRequestBus::Event(
+            m_jointsManipulationBus, &JointsManipulationRequests::GetAllJointsStates, states, includeEfforts);
     }
 
     void FingerGripperComponent::SetPosition(float position, float maxEffort)
     {
-        if (m_fingerJoints.empty())
+        if (m_fingerJointIndices.empty())
         {
             return;
         }
 
-        float targetPosition = position;
-        for (auto& [jointName, jointInfo] : m_fingerJoints)
-        {
-            AZ::Outcome<void, AZStd::string> result;
-            JointsManipulationRequestBus::EventResult(
-                result, m_rootOfArticulation, &JointsManipulationRequests::MoveJointToPosition, jointName, targetPosition);
-            if (!result.IsSuccess())
-            {
-                AZ_Warning(
-                    "FingerGripperComponent",
-                    result,
-                    "Joint move cannot be realized: %s for %s ",
-                    result.GetError().c_str(),
-                    jointName.c_str());
-            }
-        }
-
-        float oneMaxEffort = maxEffort / m_fingerJoints.size();
-        for (auto& [jointName, jointInfo] : m_fingerJoints)
+        const AZStd::vector<JointPosition> targetPositions(m_fingerJointIndices.size(), position);
+        AZ::Outcome<void, AZStd::string> result;
+        JointsManipulationRequestBus::EventResult(
+            result,
+            m_jointsManipulationBus,
+            &JointsManipulationRequests::MoveJointsToPositionsByIndex,
+            m_fingerJointIndices,
+            targetPositions);
+        AZ_Warning("FingerGripperComponent", result, "Joints move cannot be realized: %s", result.GetError().c_str());
+
+        float oneMaxEffort = maxEffort / m_fingerJointNames.size();
+        for (const auto& jointName : m_fingerJointNames)
         {
-            AZ::Outcome<void, AZStd::string> result;
+            result = AZ::Success();
             JointsManipulationRequestBus::EventResult(
-                result, m_rootOfArticulation, &JointsManipulationRequests::SetMaxJointEffort, jointName, oneMaxEffort);
+                result, m_jointsManipulationBus, &JointsManipulationRequests::SetMaxJointEffort, jointName, oneMaxEffort);
             if (!result.IsSuccess())
             {
                 AZ_Warning(
@@ -191,32 +253,39 @@ namespace ROS2
     float FingerGripperComponent::GetGripperPosition() const
     {
         float gripperPosition = 0.0f;
-        if (m_fingerJoints.empty())
+        if (m_fingerJointIndices.empty())
         {
             return gripperPosition;
         }
 
-        for (const auto& [jointName, _] : m_fingerJoints)
+        JointsStates states;
+        ReadJointsStates(states, false);
+        for (const JointIndex jointIndex : m_fingerJointIndices)
         {
-            AZ::Outcome<JointPosition, AZStd::string> result;
-            JointsManipulationRequestBus::EventResult(
-                result, m_rootOfArticulation, &JointsManipulationRequests::GetJointPosition, jointName);
-            gripperPosition += result.GetValueOr(0.f);
+            if (jointIndex < states.m_positions.size())
+            {
+                gripperPosition += states.m_positions[jointIndex];
+            }
         }
 
-        return gripperPosition / m_fingerJoints.size();
+        return gripperPosition / m_fingerJointIndices.size();
     }
 
     float FingerGripperComponent::GetGripperEffort() const
     {
         float gripperEffort = 0.0f;
-        for (const auto& [jointName, _] : m_fingerJoints)
+        if (m_fingerJointIndices.empty())
+        {
+            return gripperEffort;
+        }
+
+        JointsStates states;
+        ReadJointsStates(states, true);
+        for (const JointIndex jointIndex : m_fingerJointIndices)
         {
-            AZ::Outcome<JointEffort, AZStd::string> result;
-            JointsManipulationRequestBus::EventResult(result, m_rootOfArticulation, &JointsManipulationRequests::GetJointEffort, jointName);
-            if (result)
+            if (jointIndex < states.m_efforts.size())
             {
-                gripperEffort += result.GetValue();
+                gripperEffort += states.m_efforts[jointIndex];
             }
         }
         return gripperEffort;
@@ -224,12 +293,17 @@ namespace ROS2
 
     bool FingerGripperComponent::IsGripperVelocity0() const
     {
-        for (const auto& [jointName, _] : m_fingerJoints)
+        if (m_fingerJointIndices.empty())
         {
-            AZ::Outcome<JointEffort, AZStd::string> velocityResult;
-            JointsManipulationRequestBus::EventResult(
-                velocityResult, m_rootOfArticulation, &JointsManipulationRequests::GetJointVelocity, jointName);
-            if (velocityResult && AZStd::abs(velocityResult.GetValue()) > m_velocityEpsilon)
+            return true;
+        }
+
+        // Called at every physics substep, the states buffer is reused to avoid allocations.
+        ReadJointsStates(m_jointsStates, false);
+        for (const JointIndex jointIndex : m_fingerJointIndices)
+        {
+            if (jointIndex < m_jointsStates.m_velocities.size() &&
+                AZStd::abs(m_jointsStates.m_velocities[jointIndex]) > m_velocityEpsilon)
             {
                 return false;
             }
@@ -263,17 +337,50 @@ namespace ROS2
     }
 
     void FingerGripperComponent::OnTick([[maybe_unused]] float delta, [[maybe_unused]] AZ::ScriptTimePoint timePoint)
-    {
+    { // Fingers are gathered on the first tick, when the whole entity hierarchy is active.
         if (!m_initialised)
         {
+            const auto fingersOutcome = CacheFingerJoints();
+            if (!fingersOutcome.IsSuccess())
+            { // The joints manipulation component gathers its joints on its own first tick, which may come after this one.
+                // Retry when it notifies that its joints changed, rather than on every tick.
+                // Only warn when waiting will not help: there is no joints manipulation component, or it has gathered its joints already.
+                AZStd::vector<AZStd::string> manipulatedJoints;
+                JointsManipulationRequestBus::EventResult(
+                    manipulatedJoints, m_jointsManipulationBus, &JointsManipulationRequests::GetJointNames);
+                AZ_Warning(
+                    "FingerGripperComponent",
+                    JointsManipulationRequestBus::HasHandlers(m_rootOfArticulation) && manipulatedJoints.empty(),
+                    "Finger joints are not manipulated: %s",
+                    fingersOutcome.GetError().c_str());
+                AZ::TickBus::Handler::BusDisconnect();
+                return;
+            }
             m_initialised = true;
-            GetFingerJoints();
-            SetPosition(0.0f, AZStd::numeric_limits<float>::infinity());
+            if (m_controllerHandle == ControlLoopRequests::InvalidControllerHandle)
+            { // Only open the gripper on the first initialisation, not when the hierarchy changes.
+                SetPosition(0.0f, AZStd::numeric_limits<float>::infinity());
+            }
+        }
+
+        auto* controlLoop = ControlLoopInterface::Get();
+        if (controlLoop && m_controllerHandle == ControlLoopRequests::InvalidControllerHandle)
+        {
+            m_controllerHandle = controlLoop->RegisterController(
+                GetEntityId(),
+                [this](float deltaTime)
+                {
+                    UpdateStallTime(deltaTime);
+                });
         }
+        AZ::TickBus::Handler::BusDisconnect();
+    }
 
+    void FingerGripperComponent::UpdateStallTime(float deltaTime)
+    {
         if (IsGripperVelocity0())
         {
-            m_stallingFor += delta;
+            m_stallingFor += deltaTime;
         }
         else
         {
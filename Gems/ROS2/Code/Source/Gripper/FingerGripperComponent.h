@@ -10,10 +10,12 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <ImGuiBus.h>
 #include <ROS2/Gripper/GripperRequestBus.h>
 #include <ROS2/Manipulation/JointsManipulationRequests.h>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
 #include <Utilities/ArticulationsUtilities.h>
 
 namespace ROS2
@@ -24,6 +26,8 @@ namespace ROS2
         , public GripperRequestBus::Handler
         , public ImGui::ImGuiUpdateListenerBus::Handler
         , public AZ::TickBus::Handler
+        , public AZ::TransformNotificationBus::Handler
+        , public JointsManipulationNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(FingerGripperComponent, "{ae5f8ec2-26ee-11ee-be56-0242ac120002}", AZ::Component);
@@ -60,22 +64,44 @@ namespace ROS2
         // AZ::TickBus::Handler overrides...
         void OnTick(float delta, AZ::ScriptTimePoint timePoint) override;
 
-        ManipulationJoints& GetFingerJoints();
+        // AZ::TransformNotificationBus::Handler overrides...
+        void OnChildAdded(AZ::EntityId child) override;
+        void OnChildRemoved(AZ::EntityId child) override;
+
+        // JointsManipulationNotificationBus::Handler overrides...
+        void OnJointsChanged() override;
+
+        //! Run by the control loop at every physics substep to detect stalling.
+        void UpdateStallTime(float deltaTime);
+
+        //! Finds finger joints among the descendants and resolves their indices in the joints manipulation component.
+        //! @return failure listing the finger joints which are not manipulated (yet), in which case no fingers are cached.
+        AZ::Outcome<void, AZStd::string> CacheFingerJoints();
+
+        //! Drops the cached finger joints, they are found again on the next tick.
+        void InvalidateFingerJoints();
+
+        //! Reads the states of all joints of the articulation.
+        void ReadJointsStates(JointsStates& states, bool includeEfforts) const;
 
         AZ::EntityId m_rootOfArticulation; //!< The root of the articulation chain
+        JointsManipulationRequestBus::BusPtr m_jointsManipulationBus; //!< Bus address of the root of the articulation chain
 
         float GetDefaultPosition();
         void SetPosition(float position, float maxEffort);
         bool IsGripperVelocity0() const;
         void PublishFeedback() const;
 
-        ManipulationJoints m_fingerJoints;
+        AZStd::vector<AZStd::string> m_fingerJointNames; //!< Names of the finger joints
+        AZStd::vector<JointIndex> m_fingerJointIndices; //!< Indices of the finger joints, in the order of m_fingerJointNames
+        mutable JointsStates m_jointsStates; //!< Buffer for states of all joints of the articulation, used by stall detection
         bool m_grippingInProgress{ false };
         bool m_cancelled{ false };
         bool m_initialised{ false };
         float m_desiredPosition{ false };
         float m_stallingFor{ 0.f };
         float m_ImGuiPosition{ 0.1f };
+        ControlLoopRequests::ControllerHandle m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
 
         float m_velocityEpsilon{ 0.01f }; //!< The epsilon value used to determine whether the gripper is moving
         float m_goalTolerance{ 0.001f }; //!< The epsilon value used to determine whether the gripper reached it's goal
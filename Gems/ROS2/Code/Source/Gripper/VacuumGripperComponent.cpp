@@ -50,7 +50,10 @@ namespace ROS2
         m_grippedObjectInEffector = AZ::EntityId(AZ::EntityId::InvalidEntityId);
         m_tryingToGrip = false;
         m_cancelGripperCommand = false;
+        m_topologyCached = false;
+        m_sceneHandle = AzPhysics::InvalidSceneHandle;
         AZ::TickBus::Handler::BusConnect();
+        AZ::TransformNotificationBus::Handler::BusConnect(m_gripperEffectorArticulationLink);
         ImGui::ImGuiUpdateListenerBus::Handler::BusConnect();
         GripperRequestBus::Handler::BusConnect(GetEntityId());
     }
@@ -60,6 +63,7 @@ namespace ROS2
         m_onTriggerEnterHandler.Disconnect();
         m_onTriggerExitHandler.Disconnect();
         GripperRequestBus::Handler::BusDisconnect();
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
     }
@@ -105,14 +109,27 @@ namespace ROS2
     }
 
     void VacuumGripperComponent::OnTick(float delta, AZ::ScriptTimePoint timePoint)
+    {
+        // Topology is cached on the first tick, when the whole articulation is active.
+        if (!m_topologyCached)
+        {
+            m_topologyCached = CacheTopology();
+        }
+        if (m_tryingToGrip)
+        {
+            TryToGripObject();
+        }
+    }
+
+    bool VacuumGripperComponent::CacheTopology()
     {
         AZ_Assert(AZ::Interface<AzPhysics::SystemInterface>::Get(), "No physics system.");
 
         AzPhysics::SceneInterface* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
         AZ_Assert(sceneInterface, "No scene intreface.");
 
-        AzPhysics::SceneHandle defaultSceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AZ_Assert(defaultSceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle.");
+        m_sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        AZ_Assert(m_sceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle.");
 
         // Connect the trigger handlers if not already connected, it is circumventing the issue GH-16188, the
         // RigidbodyNotificationBus should be used instead.
@@ -124,38 +141,56 @@ namespace ROS2
                     physicsSystem->FindAttachedBodyHandleFromEntityId(m_gripperEffectorCollider);
                 AZ_Warning(
                     "VacuumGripper", foundBody.first != AzPhysics::InvalidSceneHandle, "No body found for m_gripperEffectorCollider.");
-                if (foundBody.first != AzPhysics::InvalidSceneHandle)
+                if (foundBody.first == AzPhysics::InvalidSceneHandle)
                 {
-                    AzPhysics::SimulatedBodyEvents::RegisterOnTriggerEnterHandler(
-                        foundBody.first, foundBody.second, m_onTriggerEnterHandler);
-                    AzPhysics::SimulatedBodyEvents::RegisterOnTriggerExitHandler(foundBody.first, foundBody.second, m_onTriggerExitHandler);
+                    return false;
                 }
+                AzPhysics::SimulatedBodyEvents::RegisterOnTriggerEnterHandler(foundBody.first, foundBody.second, m_onTriggerEnterHandler);
+                AzPhysics::SimulatedBodyEvents::RegisterOnTriggerExitHandler(foundBody.first, foundBody.second, m_onTriggerExitHandler);
             }
+        }
 
-            AZ::EntityId rootArticulationEntity = Utils::GetRootOfArticulation(m_gripperEffectorArticulationLink);
-            AZ::Entity* rootEntity = nullptr;
-            AZ::ComponentApplicationBus::BroadcastResult(rootEntity, &AZ::ComponentApplicationRequests::FindEntity, rootArticulationEntity);
+        AZ::EntityId rootArticulationEntity = Utils::GetRootOfArticulation(m_gripperEffectorArticulationLink);
+        AZ::Entity* rootEntity = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(rootEntity, &AZ::ComponentApplicationRequests::FindEntity, rootArticulationEntity);
+        AZ_Warning("VacuumGripper", rootEntity, "No root articulation entity found for m_gripperEffectorArticulationLink.");
+        if (!rootEntity)
+        {
+            return false;
+        }
 
-            AZ_Trace("VacuumGripper", "Root articulation entity name: %s\n", rootEntity->GetName().c_str());
+        AZ_Trace("VacuumGripper", "Root articulation entity name: %s\n", rootEntity->GetName().c_str());
 
-            PhysX::ArticulationLinkComponent* component = rootEntity->FindComponent<PhysX::ArticulationLinkComponent>();
-            AZStd::vector<AzPhysics::SimulatedBodyHandle> articulationHandles = component->GetSimulatedBodyHandles();
+        PhysX::ArticulationLinkComponent* component = rootEntity->FindComponent<PhysX::ArticulationLinkComponent>();
+        AZ_Assert(component, "No PhysX::ArticulationLinkComponent found on the root of the articulation");
+        const AZStd::vector<AzPhysics::SimulatedBodyHandle> articulationHandles = component->GetSimulatedBodyHandles();
 
-            AZ_Assert(articulationHandles.size() > 1, "Expected more than one body handles in articulations");
-            for (AzPhysics::SimulatedBodyHandle handle : articulationHandles)
+        AZ_Assert(articulationHandles.size() > 1, "Expected more than one body handles in articulations");
+        for (AzPhysics::SimulatedBodyHandle handle : articulationHandles)
+        {
+            AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, handle);
+            AZ_Assert(body, "Expected valid body pointer");
+            if (body->GetEntityId() == m_gripperEffectorArticulationLink)
             {
-                AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(defaultSceneHandle, handle);
-                AZ_Assert(body, "Expected valid body pointer");
-                if (body->GetEntityId() == m_gripperEffectorArticulationLink)
-                {
-                    m_gripperEffectorBodyHandle = handle;
-                }
+                m_gripperEffectorBodyHandle = handle;
+                break;
             }
         }
-        if (m_tryingToGrip)
-        {
-            TryToGripObject();
-        }
+        return true;
+    }
+
+    void VacuumGripperComponent::InvalidateTopology()
+    {
+        m_onTriggerEnterHandler.Disconnect();
+        m_onTriggerExitHandler.Disconnect();
+        m_gripperEffectorBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        m_topologyCached = false;
+    }
+
+    void VacuumGripperComponent::OnParentChanged([[maybe_unused]] AZ::EntityId oldParent, [[maybe_unused]] AZ::EntityId newParent)
+    {
+        // The effector link was moved to a different articulation, its body has to be found again.
+        InvalidateTopology();
     }
 
     bool VacuumGripperComponent::isObjectGrippable(const AZ::EntityId entityId)
@@ -190,8 +225,6 @@ namespace ROS2
         AZ_Assert(m_entity->FindComponent<PhysX::ArticulationLinkComponent>(), "No PhysX::ArticulationLinkComponent found on entity ");
 
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-        AzPhysics::SceneHandle defaultSceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AZ_Assert(defaultSceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle");
 
         // Get gripped rigid body
         AzPhysics::RigidBody* grippedRigidBody = nullptr;
@@ -200,7 +233,7 @@ namespace ROS2
 
         // Gripper is the end of the articulation chain
         AzPhysics::SimulatedBody* gripperBody = nullptr;
-        gripperBody = sceneInterface->GetSimulatedBodyFromHandle(defaultSceneHandle, m_gripperEffectorBodyHandle);
+        gripperBody = sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, m_gripperEffectorBodyHandle);
         AZ_Assert(gripperBody, "No gripper body found");
 
         AttachToGripper(gripperBody, grippedRigidBody, sceneInterface);
@@ -211,9 +244,6 @@ namespace ROS2
     void VacuumGripperComponent::AttachToGripper(
         AzPhysics::SimulatedBody* gripperBody, AzPhysics::RigidBody* grippedRigidBody, AzPhysics::SceneInterface* sceneInterface)
     {
-        AzPhysics::SceneHandle defaultSceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AZ_Assert(defaultSceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle");
-
         // Find Transform of the child in parent's frame
         AZ::Transform childTransformWorld = grippedRigidBody->GetTransform();
         AZ::Transform parentsTranformWorld = gripperBody->GetTransform();
@@ -231,7 +261,7 @@ namespace ROS2
 
         // Create new joint
         m_vacuumJoint =
-            sceneInterface->AddJoint(defaultSceneHandle, &jointConfig, m_gripperEffectorBodyHandle, grippedRigidBody->m_bodyHandle);
+            sceneInterface->AddJoint(m_sceneHandle, &jointConfig, m_gripperEffectorBodyHandle, grippedRigidBody->m_bodyHandle);
     }
 
     void VacuumGripperComponent::ReleaseGrippedObject()
@@ -242,8 +272,6 @@ namespace ROS2
             return;
         }
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-        AzPhysics::SceneHandle defaultSceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AZ_Assert(defaultSceneHandle != AzPhysics::InvalidSceneHandle, "Invalid default physics scene handle");
         // Wake up the body to prevent it from not moving after release
         AzPhysics::RigidBody* grippedRigidBody = nullptr;
         Physics::RigidBodyRequestBus::EventResult(grippedRigidBody, m_grippedObjectInEffector, &Physics::RigidBodyRequests::GetRigidBody);
@@ -251,7 +279,7 @@ namespace ROS2
         {
             grippedRigidBody->ForceAwake();
         }
-        sceneInterface->RemoveJoint(defaultSceneHandle, m_vacuumJoint);
+        sceneInterface->RemoveJoint(m_sceneHandle, m_vacuumJoint);
         m_vacuumJoint = AzPhysics::InvalidJointHandle;
     }
 
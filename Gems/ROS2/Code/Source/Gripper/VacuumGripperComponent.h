@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
@@ -31,6 +32,7 @@ namespace ROS2
         , public GripperRequestBus::Handler
         , public ImGui::ImGuiUpdateListenerBus::Handler
         , public AZ::TickBus::Handler
+        , public AZ::TransformNotificationBus::Handler
     {
     public:
         static constexpr AZ::Crc32 GrippableTag = AZ_CRC_CE("Grippable");
@@ -61,6 +63,16 @@ namespace ROS2
         // ImGui::ImGuiUpdateListenerBus::Handler overrides...
         void OnImGuiUpdate() override;
 
+        // AZ::TransformNotificationBus::Handler overrides...
+        void OnParentChanged(AZ::EntityId oldParent, AZ::EntityId newParent) override;
+
+        //! Finds the physics body of the effector articulation link and connects the trigger handlers of the effector collider.
+        //! @return true if both the body and the collider were found.
+        bool CacheTopology();
+
+        //! Drops the cached body handle and trigger handlers, they are found again on the next tick.
+        void InvalidateTopology();
+
         //! Entity that contains the collider that will be used as the gripper
         //! effector/ The collider must be a trigger collider.
         AZ::EntityId m_gripperEffectorCollider;
@@ -71,6 +83,12 @@ namespace ROS2
         //! The physics body handle to m_gripperEffectorArticulationLink.
         AzPhysics::SimulatedBodyHandle m_gripperEffectorBodyHandle;
 
+        //! The physics scene of the gripper.
+        AzPhysics::SceneHandle m_sceneHandle{ AzPhysics::InvalidSceneHandle };
+
+        //! Whether the effector body handle and trigger handlers are cached.
+        bool m_topologyCached{ false };
+
         //! EntityId of the object that is currently gripped by the gripper effector.
         AZ::EntityId m_grippedObjectInEffector;
 
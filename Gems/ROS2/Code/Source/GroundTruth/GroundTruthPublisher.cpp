@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "GroundTruthPublisher.h"
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/RigidBodyBus.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
+#include <ROS2/ROS2Bus.h>
+#include <ROS2/Utilities/ROS2Conversions.h>
+#include <ROS2/Utilities/ROS2Names.h>
+
+namespace ROS2
+{
+    GroundTruthPublisher::GroundTruthPublisher(const GroundTruthConfiguration& configuration)
+        : m_configuration(configuration)
+    {
+    }
+
+    GroundTruthPublisher::~GroundTruthPublisher()
+    {
+        Deactivate();
+    }
+
+    void GroundTruthPublisher::Activate(const std::shared_ptr<rclcpp::Node>& node)
+    {
+        m_node = node;
+        if (m_configuration.m_aggregated)
+        {
+            m_modelStatesPublisher = m_node->create_publisher<gazebo_msgs::msg::ModelStates>(m_configuration.m_topic.c_str(), rclcpp::QoS(1));
+        }
+        m_onSceneSimulationFinish = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler(
+            [this](AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                OnSimulationFinish(sceneHandle, fixedDeltaTime);
+            },
+            aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Components));
+    }
+
+    void GroundTruthPublisher::Deactivate()
+    {
+        m_onSceneSimulationFinish.Disconnect();
+        WaitForPublishing();
+        m_entityIds.clear();
+        m_bodyHandles.clear();
+        m_poses.clear();
+        m_linearVelocities.clear();
+        m_angularVelocities.clear();
+        m_odometryMessages.clear();
+        m_odometryPublishers.clear();
+        m_modelStatesMessage = gazebo_msgs::msg::ModelStates();
+        m_modelStatesPublisher.reset();
+        m_node.reset();
+    }
+
+    void GroundTruthPublisher::RegisterRobot(const AZ::EntityId& entityId, const AZStd::string& robotName, const AZStd::string& frameId)
+    {
+        if (!m_node)
+        {
+            return;
+        }
+
+        AzPhysics::RigidBody* rigidBody = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(rigidBody, entityId, &Physics::RigidBodyRequests::GetRigidBody);
+        if (!rigidBody)
+        {
+            AZ_Warning("GroundTruthPublisher", false, "Robot %s has no rigid body, its ground truth is not published", robotName.c_str());
+            return;
+        }
+
+        WaitForPublishing();
+        m_entityIds.push_back(entityId);
+        m_bodyHandles.push_back(rigidBody->m_bodyHandle);
+        m_poses.push_back(AZ::Transform::CreateIdentity());
+        m_linearVelocities.push_back(AZ::Vector3::CreateZero());
+        m_angularVelocities.push_back(AZ::Vector3::CreateZero());
+        if (m_configuration.m_aggregated)
+        {
+            m_modelStatesMessage.name.emplace_back(robotName.c_str());
+            m_modelStatesMessage.pose.emplace_back();
+            m_modelStatesMessage.twist.emplace_back();
+        }
+        else
+        {
+            nav_msgs::msg::Odometry& odometryMessage = m_odometryMessages.emplace_back();
+            odometryMessage.header.frame_id = m_configuration.m_frameId.c_str();
+            odometryMessage.child_frame_id = frameId.c_str();
+            const AZStd::string topic = ROS2Names::GetNamespacedName(robotName, m_configuration.m_topic);
+            m_odometryPublishers.push_back(m_node->create_publisher<nav_msgs::msg::Odometry>(topic.c_str(), rclcpp::QoS(1)));
+        }
+
+        if (m_onSceneSimulationFinish.IsConnected())
+        {
+            return;
+        }
+        // Robots are only registered in game, when the default physics scene exists.
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZ_Assert(sceneInterface, "No scene interface");
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (sceneHandle != AzPhysics::InvalidSceneHandle)
+        {
+            m_timeSinceLastPublish = 0.0f;
+            sceneInterface->RegisterSceneSimulationFinishHandler(sceneHandle, m_onSceneSimulationFinish);
+        }
+    }
+
+    void GroundTruthPublisher::UnregisterRobot(const AZ::EntityId& entityId)
+    {
+        auto it = AZStd::find(m_entityIds.begin(), m_entityIds.end(), entityId);
+        if (it == m_entityIds.end())
+        {
+            return;
+        }
+
+        WaitForPublishing();
+        const size_t index = AZStd::distance(m_entityIds.begin(), it);
+        m_entityIds.erase(it);
+        m_bodyHandles.erase(m_bodyHandles.begin() + index);
+        m_poses.erase(m_poses.begin() + index);
+        m_linearVelocities.erase(m_linearVelocities.begin() + index);
+        m_angularVelocities.erase(m_angularVelocities.begin() + index);
+        if (m_configuration.m_aggregated)
+        {
+            m_modelStatesMessage.name.erase(m_modelStatesMessage.name.begin() + index);
+            m_modelStatesMessage.pose.erase(m_modelStatesMessage.pose.begin() + index);
+            m_modelStatesMessage.twist.erase(m_modelStatesMessage.twist.begin() + index);
+        }
+        else
+        {
+            m_odometryMessages.erase(m_odometryMessages.begin() + index);
+            m_odometryPublishers.erase(m_odometryPublishers.begin() + index);
+        }
+
+        if (m_entityIds.empty())
+        {
+            m_onSceneSimulationFinish.Disconnect();
+        }
+    }
+
+    void GroundTruthPublisher::OnSimulationFinish(AzPhysics::SceneHandle sceneHandle, float deltaTime)
+    {
+        m_timeSinceLastPublish += deltaTime;
+        if (m_configuration.m_frequency > 0.0f && m_timeSinceLastPublish < 1.0f / m_configuration.m_frequency)
+        {
+            return;
+        }
+        m_timeSinceLastPublish = 0.0f;
+
+        WaitForPublishing();
+        ReadRobots(sceneHandle);
+
+        m_publishCompletion = AZStd::make_unique<AZ::JobCompletion>();
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this]()
+            {
+                Publish();
+            },
+            true);
+        job->SetDependent(m_publishCompletion.get());
+        job->Start();
+    }
+
+    void GroundTruthPublisher::ReadRobots(AzPhysics::SceneHandle sceneHandle)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SimulatedBodyList bodies = sceneInterface->GetSimulatedBodiesFromHandle(sceneHandle, m_bodyHandles);
+        for (size_t i = 0; i < bodies.size(); ++i)
+        {
+            // The body of a robot might be removed before the robot is unregistered, its last state is kept then.
+            if (const auto* rigidBody = azrtti_cast<AzPhysics::RigidBody*>(bodies[i]))
+            {
+                m_poses[i] = rigidBody->GetTransform();
+                m_linearVelocities[i] = rigidBody->GetLinearVelocity();
+                m_angularVelocities[i] = rigidBody->GetAngularVelocity();
+            }
+        }
+        m_stamp = ROS2Interface::Get()->GetROSTimestamp();
+    }
+
+    void GroundTruthPublisher::Publish()
+    {
+        if (m_configuration.m_aggregated)
+        {
+            // ModelStates carries no header, velocities are expressed in the world frame as in the Gazebo message.
+            for (size_t i = 0; i < m_poses.size(); ++i)
+            {
+                m_modelStatesMessage.pose[i] = ROS2Conversions::ToROS2Pose(m_poses[i]);
+                m_modelStatesMessage.twist[i].linear = ROS2Conversions::ToROS2Vector3(m_linearVelocities[i]);
+                m_modelStatesMessage.twist[i].angular = ROS2Conversions::ToROS2Vector3(m_angularVelocities[i]);
+            }
+            m_modelStatesPublisher->publish(m_modelStatesMessage);
+            return;
+        }
+
+        // Odometry velocities are expressed in the child frame, which is the frame of the robot base.
+        for (size_t i = 0; i < m_poses.size(); ++i)
+        {
+            const AZ::Quaternion worldToBase = m_poses[i].GetRotation().GetConjugate();
+            nav_msgs::msg::Odometry& odometryMessage = m_odometryMessages[i];
+            odometryMessage.header.stamp = m_stamp;
+            odometryMessage.pose.pose = ROS2Conversions::ToROS2Pose(m_poses[i]);
+            odometryMessage.twist.twist.linear = ROS2Conversions::ToROS2Vector3(worldToBase.TransformVector(m_linearVelocities[i]));
+            odometryMessage.twist.twist.angular = ROS2Conversions::ToROS2Vector3(worldToBase.TransformVector(m_angularVelocities[i]));
+            m_odometryPublishers[i]->publish(odometryMessage);
+        }
+    }
+
+    void GroundTruthPublisher::WaitForPublishing()
+    {
+        if (m_publishCompletion)
+        {
+            m_publishCompletion->StartAndWaitForCompletion();
+            m_publishCompletion.reset();
+        }
+    }
+} // namespace ROS2
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <ROS2/GroundTruth/GroundTruthBus.h>
+#include <gazebo_msgs/msg/model_states.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+namespace ROS2
+{
+    //! Configuration of the ground truth publisher, read from the settings registry.
+    struct GroundTruthConfiguration
+    {
+        float m_frequency = 30.0f; //!< Publishing frequency in Hz, zero to publish after every physics substep.
+        bool m_aggregated = true; //!< Publish one ModelStates message for all robots, rather than an Odometry message per robot.
+        AZStd::string m_topic = "ground_truth"; //!< Topic of the aggregated message, or the topic in the namespace of each robot.
+        AZStd::string m_frameId = "world"; //!< Fixed frame of the published poses.
+    };
+
+    //! Publishes the ground truth state of all registered robots after physics steps of the default scene.
+    //! Registered robots are kept in parallel arrays, which are filled in a single pass over the bodies and then published
+    //! from a job, so the physics thread only pays for reading the bodies.
+    //! @see GroundTruthRequests
+    class GroundTruthPublisher : public GroundTruthInterface::Registrar
+    {
+    public:
+        explicit GroundTruthPublisher(const GroundTruthConfiguration& configuration);
+        ~GroundTruthPublisher() override;
+
+        //! @param node node to create publishers with.
+        void Activate(const std::shared_ptr<rclcpp::Node>& node);
+        void Deactivate();
+
+        // GroundTruthRequests overrides ...
+        void RegisterRobot(const AZ::EntityId& entityId, const AZStd::string& robotName, const AZStd::string& frameId) override;
+        void UnregisterRobot(const AZ::EntityId& entityId) override;
+
+    private:
+        void OnSimulationFinish(AzPhysics::SceneHandle sceneHandle, float deltaTime);
+        //! Read poses and velocities of all robots. Must not run while publishing.
+        void ReadRobots(AzPhysics::SceneHandle sceneHandle);
+        //! Publish the state read by the last ReadRobots call. Runs in a job.
+        void Publish();
+        //! Wait for the publishing job to finish, after which the robot arrays can be modified.
+        void WaitForPublishing();
+
+        GroundTruthConfiguration m_configuration;
+        std::shared_ptr<rclcpp::Node> m_node;
+        float m_timeSinceLastPublish = 0.0f;
+        builtin_interfaces::msg::Time m_stamp; //!< Timestamp of the last read, shared by all robots
+
+        // Registered robots, as parallel arrays indexed by robot.
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AzPhysics::SimulatedBodyHandleList m_bodyHandles;
+        AZStd::vector<AZ::Transform> m_poses; //!< Poses in the world frame
+        AZStd::vector<AZ::Vector3> m_linearVelocities; //!< Linear velocities in the world frame
+        AZStd::vector<AZ::Vector3> m_angularVelocities; //!< Angular velocities in the world frame
+        AZStd::vector<nav_msgs::msg::Odometry> m_odometryMessages; //!< Per-robot messages, with frames set on registration
+        AZStd::vector<rclcpp::Publisher<nav_msgs::msg::Odometry>::SharedPtr> m_odometryPublishers;
+
+        gazebo_msgs::msg::ModelStates m_modelStatesMessage; //!< Aggregated message, with robot names set on registration
+        rclcpp::Publisher<gazebo_msgs::msg::ModelStates>::SharedPtr m_modelStatesPublisher;
+
+        AZStd::unique_ptr<AZ::JobCompletion> m_publishCompletion; //!< Completion of the running publishing job, if any
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_onSceneSimulationFinish;
+    };
+} // namespace ROS2
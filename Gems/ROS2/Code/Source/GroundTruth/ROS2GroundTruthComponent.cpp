@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ROS2GroundTruthComponent.h"
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <ROS2/Frame/ROS2FrameComponent.h>
+#include <ROS2/GroundTruth/GroundTruthBus.h>
+#include <ROS2/Utilities/ROS2Names.h>
+
+namespace ROS2
+{
+    void ROS2GroundTruthComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<ROS2GroundTruthComponent, AZ::Component>()->Version(1);
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<ROS2GroundTruthComponent>("ROS2 Ground Truth", "Publishes the true state of the robot along with all other robots")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->Attribute(AZ::Edit::Attributes::Category, "ROS2")
+                    ->Attribute(AZ::Edit::Attributes::Icon, "Editor/Icons/Components/ROS2OdometrySensor.svg")
+                    ->Attribute(AZ::Edit::Attributes::ViewportIcon, "Editor/Icons/Components/Viewport/ROS2OdometrySensor.svg");
+            }
+        }
+    }
+
+    void ROS2GroundTruthComponent::Activate()
+    {
+        auto* groundTruth = GroundTruthInterface::Get();
+        if (!groundTruth)
+        {
+            return;
+        }
+        const auto* ros2Frame = GetEntity()->FindComponent<ROS2FrameComponent>();
+        AZ_Assert(ros2Frame, "ROS2GroundTruthComponent requires ROS2FrameComponent");
+        const AZStd::string robotName = GetRobotName(ros2Frame->GetNamespace(), GetEntity()->GetName());
+        if (robotName.empty())
+        {
+            AZ_Warning(
+                "ROS2GroundTruthComponent",
+                false,
+                "Robot entity '%s' has no valid name to publish ground truth with, set the namespace of its ROS2 frame.",
+                GetEntity()->GetName().c_str());
+            return;
+        }
+        groundTruth->RegisterRobot(GetEntityId(), robotName, ros2Frame->GetFrameID());
+    }
+
+    AZStd::string ROS2GroundTruthComponent::GetRobotName(const AZStd::string& frameNamespace, const AZStd::string& entityName)
+    {
+        // Entity names can contain spaces and other characters which are not allowed in ROS 2 names.
+        const AZStd::string robotName = frameNamespace.empty() ? ROS2Names::RosifyName(entityName) : frameNamespace;
+        if (robotName.empty())
+        {
+            return {};
+        }
+        if (const auto validationOutcome = ROS2Names::ValidateNamespace(robotName); !validationOutcome.IsSuccess())
+        {
+            AZ_Warning(
+                "ROS2GroundTruthComponent",
+                false,
+                "Robot name '%s' is not a valid ROS 2 namespace: %s",
+                robotName.c_str(),
+                validationOutcome.GetError().c_str());
+            return {};
+        }
+        return robotName;
+    }
+
+    void ROS2GroundTruthComponent::Deactivate()
+    {
+        if (auto* groundTruth = GroundTruthInterface::Get())
+        {
+            groundTruth->UnregisterRobot(GetEntityId());
+        }
+    }
+
+    void ROS2GroundTruthComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC_CE("PhysicsDynamicRigidBodyService"));
+        required.push_back(AZ_CRC_CE("ROS2Frame"));
+    }
+} // namespace ROS2
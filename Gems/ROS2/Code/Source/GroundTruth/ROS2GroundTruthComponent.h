@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2
+{
+    //! Registers the robot base body with the ground truth publisher, which publishes the state of all robots at once.
+    //! Unlike odometry sensors, the component runs no callbacks and owns no publishers of its own.
+    //! @see GroundTruthRequests
+    class ROS2GroundTruthComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ROS2GroundTruthComponent, "{8C1F5E3A-2D6B-4A97-B0E4-7F3C9A1D5B62}", AZ::Component);
+        ROS2GroundTruthComponent() = default;
+
+        //////////////////////////////////////////////////////////////////////////
+        // Component overrides
+        void Activate() override;
+        void Deactivate() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Get the name to register a robot with the ground truth publisher.
+        //! @param frameNamespace namespace of the robot frame, used when set.
+        //! @param entityName name of the robot entity, made ROS 2 compliant when the frame has no namespace.
+        //! @return the robot name, or an empty string if it is not a valid ROS 2 namespace.
+        static AZStd::string GetRobotName(const AZStd::string& frameNamespace, const AZStd::string& entityName);
+    };
+} // namespace ROS2
@@ -40,6 +40,36 @@ namespace ROS2
         return AZ::Success();
     }
 
+    AZ::Outcome<void, AZStd::string> JointsArticulationControllerComponent::PositionControlAll(
+        const AZStd::vector<AZStd::string>& jointNames,
+        const AZStd::vector<JointInfo>& joints,
+        [[maybe_unused]] const AZStd::vector<JointPosition>& currentPositions,
+        [[maybe_unused]] float deltaTime)
+    {
+        // A joint of the wrong type does not stop the control of the remaining joints, the first error is reported after the loop.
+        AZ::Outcome<void, AZStd::string> result = AZ::Success();
+        for (JointIndex jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
+        {
+            const JointInfo& joint = joints[jointIndex];
+            if (!joint.m_isArticulation)
+            {
+                if (result.IsSuccess())
+                {
+                    result = AZ::Failure(AZStd::string::format(
+                        "Joint %s is not an articulation link, use JointsPIDControllerComponent instead", jointNames[jointIndex].c_str()));
+                }
+                continue;
+            }
+
+            PhysX::ArticulationJointRequestBus::Event(
+                joint.m_entityComponentIdPair.GetEntityId(),
+                &PhysX::ArticulationJointRequests::SetDriveTarget,
+                joint.m_axis,
+                joint.m_restPosition);
+        }
+        return result;
+    }
+
     void JointsArticulationControllerComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
     {
         required.push_back(AZ_CRC_CE("ArticulationLinkService"));
@@ -49,6 +49,13 @@ namespace ROS2
             JointPosition targetPosition,
             float deltaTime) override;
 
+        //! @see ROS2::JointsPositionControllerRequestBus::PositionControlAll
+        AZ::Outcome<void, AZStd::string> PositionControlAll(
+            const AZStd::vector<AZStd::string>& jointNames,
+            const AZStd::vector<JointInfo>& joints,
+            const AZStd::vector<JointPosition>& currentPositions,
+            float deltaTime) override;
+
     private:
         // Component overrides ...
         void Activate() override;
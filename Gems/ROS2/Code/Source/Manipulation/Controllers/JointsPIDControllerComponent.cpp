@@ -21,6 +21,8 @@ namespace ROS2
     void JointsPIDControllerComponent::Deactivate()
     {
         JointsPositionControllerRequestBus::Handler::BusDisconnect();
+        m_jointPids.clear();
+        m_defaultPids.clear();
     }
 
     void JointsPIDControllerComponent::InitializePIDs()
@@ -44,24 +46,74 @@ namespace ROS2
                                "JointsArticulationControllerComponent instead", jointName.c_str()));
         }
 
-        bool jointPIDdefined = m_pidConfiguration.find(jointName) != m_pidConfiguration.end();
-        AZ_Warning(
-            "JointsPIDControllerComponent",
-            jointPIDdefined,
-            "PID not defined for joint %s, using a default, the behavior is likely to be wrong for this joint",
-            jointName.c_str());
-
-        Controllers::PidConfiguration defaultConfiguration;
-        defaultConfiguration.InitializePid();
-        auto applicablePidConfiguration = jointPIDdefined ? m_pidConfiguration.at(jointName) : defaultConfiguration;
-
         uint64_t deltaTimeNs = deltaTime * 1'000'000'000;
         auto positionError = targetPosition - currentPosition;
-        float desiredVelocity = applicablePidConfiguration.ComputeCommand(positionError, deltaTimeNs);
+        float desiredVelocity = GetJointPid(jointName).ComputeCommand(positionError, deltaTimeNs);
         PhysX::JointRequestBus::Event(joint.m_entityComponentIdPair, &PhysX::JointRequests::SetVelocity, desiredVelocity);
         return AZ::Success();
     }
 
+    AZ::Outcome<void, AZStd::string> JointsPIDControllerComponent::PositionControlAll(
+        const AZStd::vector<AZStd::string>& jointNames,
+        const AZStd::vector<JointInfo>& joints,
+        const AZStd::vector<JointPosition>& currentPositions,
+        float deltaTime)
+    {
+        if (m_jointPids.size() != joints.size())
+        { // Resolve PIDs by joint name only once, the joint order does not change for the lifetime of the manipulator.
+            m_jointPids.clear();
+            m_jointPids.reserve(joints.size());
+            for (const auto& jointName : jointNames)
+            {
+                m_jointPids.push_back(&GetJointPid(jointName));
+            }
+        }
+
+        // A joint of the wrong type does not stop the control of the remaining joints, the first error is reported after the loop.
+        AZ::Outcome<void, AZStd::string> result = AZ::Success();
+        const uint64_t deltaTimeNs = deltaTime * 1'000'000'000;
+        for (JointIndex jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
+        {
+            const JointInfo& joint = joints[jointIndex];
+            if (joint.m_isArticulation)
+            {
+                if (result.IsSuccess())
+                {
+                    result = AZ::Failure(AZStd::string::format("Joint %s is articulation link, JointsPIDControllerComponent only handles classic Hinge joints. Use "
+                                         "JointsArticulationControllerComponent instead", jointNames[jointIndex].c_str()));
+                }
+                continue;
+            }
+
+            const auto positionError = joint.m_restPosition - currentPositions[jointIndex];
+            const float desiredVelocity = m_jointPids[jointIndex]->ComputeCommand(positionError, deltaTimeNs);
+            PhysX::JointRequestBus::Event(joint.m_entityComponentIdPair, &PhysX::JointRequests::SetVelocity, desiredVelocity);
+        }
+        return result;
+    }
+
+    Controllers::PidConfiguration& JointsPIDControllerComponent::GetJointPid(const AZStd::string& jointName)
+    {
+        auto it = m_pidConfiguration.find(jointName);
+        if (it != m_pidConfiguration.end())
+        {
+            return it->second;
+        }
+
+        auto defaultIt = m_defaultPids.find(jointName);
+        if (defaultIt == m_defaultPids.end())
+        {
+            AZ_Warning(
+                "JointsPIDControllerComponent",
+                false,
+                "PID not defined for joint %s, using a default, the behavior is likely to be wrong for this joint",
+                jointName.c_str());
+            defaultIt = m_defaultPids.emplace(jointName, Controllers::PidConfiguration()).first;
+            defaultIt->second.InitializePid();
+        }
+        return defaultIt->second;
+    }
+
     void JointsPIDControllerComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
     {
         provided.push_back(AZ_CRC_CE("JointsControllerService"));
@@ -49,12 +49,24 @@ namespace ROS2
             JointPosition targetPosition,
             float deltaTime) override;
 
+        //! @see ROS2::JointsPositionControllerRequestBus::PositionControlAll
+        AZ::Outcome<void, AZStd::string> PositionControlAll(
+            const AZStd::vector<AZStd::string>& jointNames,
+            const AZStd::vector<JointInfo>& joints,
+            const AZStd::vector<JointPosition>& currentPositions,
+            float deltaTime) override;
+
     private:
         // Component overrides ...
         void Activate() override;
         void Deactivate() override;
         void InitializePIDs();
 
+        //! Get the PID of a joint, falling back to a default PID (kept per joint) if none is configured.
+        Controllers::PidConfiguration& GetJointPid(const AZStd::string& jointName);
+
         AZStd::unordered_map<AZStd::string, Controllers::PidConfiguration> m_pidConfiguration;
+        AZStd::unordered_map<AZStd::string, Controllers::PidConfiguration> m_defaultPids; //!< Runtime PIDs of joints without configuration
+        AZStd::vector<Controllers::PidConfiguration*> m_jointPids; //!< PIDs resolved once, in JointIndex order
     };
 } // namespace ROS2
@@ -11,7 +11,6 @@
 #include <ROS2/Utilities/ROS2Names.h>
 
 #include "JointStatePublisher.h"
-#include "ManipulationUtils.h"
 
 namespace ROS2
 {
@@ -38,37 +37,36 @@ namespace ROS2
         rosHeader.stamp = ROS2::ROS2Interface::Get()->GetROSTimestamp();
         m_jointStateMsg.header = rosHeader;
 
-        AZ_Assert(m_jointNames.size() == m_jointStateMsg.name.size(), "The expected message size doesn't match with the joint list size");
+        JointsManipulationRequestBus::Event(
+            m_context.m_entityId, &JointsManipulationRequests::GetAllJointsStates, m_jointsStates, true);
+
+        AZ_Assert(
+            m_jointsStates.m_positions.size() == m_jointStateMsg.name.size(),
+            "The expected message size doesn't match with the joint list size");
 
         for (size_t i = 0; i < m_jointStateMsg.name.size(); i++)
         {
-            m_jointStateMsg.name[i] = m_jointNames[i].c_str();
-            JointInfo& jointInfo = m_jointInfos[i];
-
-            auto jointStateData = Utils::GetJointState(jointInfo);
-
-            m_jointStateMsg.position[i] = jointStateData.position;
-            m_jointStateMsg.velocity[i] = jointStateData.velocity;
-            m_jointStateMsg.effort[i] = jointStateData.effort;
+            m_jointStateMsg.position[i] = m_jointsStates.m_positions[i];
+            m_jointStateMsg.velocity[i] = m_jointsStates.m_velocities[i];
+            m_jointStateMsg.effort[i] = m_jointsStates.m_efforts[i];
         }
         m_jointStatePublisher->publish(m_jointStateMsg);
     }
 
     void JointStatePublisher::InitializePublisher()
     {
-        ManipulationJoints manipulatorJoints;
-        JointsManipulationRequestBus::EventResult(manipulatorJoints, m_context.m_entityId, &JointsManipulationRequests::GetJoints);
+        AZStd::vector<AZStd::string> jointNames;
+        JointsManipulationRequestBus::EventResult(jointNames, m_context.m_entityId, &JointsManipulationRequests::GetJointNames);
 
-        for (const auto& [jointName, jointInfo] : manipulatorJoints)
+        // Names are fixed for the lifetime of the manipulator, only the states are updated for each message.
+        m_jointStateMsg.name.resize(jointNames.size());
+        for (size_t i = 0; i < jointNames.size(); i++)
         {
-            m_jointNames.push_back(jointName);
-            m_jointInfos.push_back(jointInfo);
+            m_jointStateMsg.name[i] = jointNames[i].c_str();
         }
-
-        m_jointStateMsg.name.resize(manipulatorJoints.size());
-        m_jointStateMsg.position.resize(manipulatorJoints.size());
-        m_jointStateMsg.velocity.resize(manipulatorJoints.size());
-        m_jointStateMsg.effort.resize(manipulatorJoints.size());
+        m_jointStateMsg.position.resize(jointNames.size());
+        m_jointStateMsg.velocity.resize(jointNames.size());
+        m_jointStateMsg.effort.resize(jointNames.size());
 
         m_eventSourceAdapter.SetFrequency(m_configuration.m_frequency);
         m_adaptedEventHandler = decltype(m_adaptedEventHandler)(
@@ -48,7 +48,6 @@ namespace ROS2
         std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::JointState>> m_jointStatePublisher;
         sensor_msgs::msg::JointState m_jointStateMsg;
 
-        AZStd::vector<AZStd::string> m_jointNames;
-        AZStd::vector<JointInfo> m_jointInfos;
+        JointsStates m_jointsStates; //!< Reused for each message, filled in the JointIndex order of the manipulation component
     };
 } // namespace ROS2
@@ -15,6 +15,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/sort.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/Manipulation/Controllers/JointsPositionControllerRequests.h>
 #include <ROS2/Utilities/ROS2Names.h>
@@ -22,7 +23,6 @@
 #include <Source/HingeJointComponent.h>
 #include <Source/PrismaticJointComponent.h>
 #include <Utilities/ArticulationsUtilities.h>
-#include <ROS2/Utilities/ROS2Conversions.h>
 
 namespace ROS2
 {
@@ -183,7 +183,6 @@ namespace ROS2
         publisherContext.m_entityId = GetEntityId();
 
         m_jointStatePublisher = AZStd::make_unique<JointStatePublisher>(m_jointStatePublisherConfiguration, publisherContext);
-        m_lastTickTimestamp = ROS2Interface::Get()->GetROSTimestamp();
         AZ::TickBus::Handler::BusConnect();
         JointsManipulationRequestBus::Handler::BusConnect(GetEntityId());
     }
@@ -192,11 +191,61 @@ namespace ROS2
     {
         JointsManipulationRequestBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            controlLoop->UnregisterController(m_controllerHandle);
+        }
+        m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
     }
 
     ManipulationJoints JointsManipulationComponent::GetJoints()
     {
-        return m_manipulationJoints;
+        ManipulationJoints manipulationJoints;
+        for (JointIndex jointIndex = 0; jointIndex < m_jointNames.size(); ++jointIndex)
+        {
+            manipulationJoints[m_jointNames[jointIndex]] = m_jointInfos[jointIndex];
+        }
+        return manipulationJoints;
+    }
+
+    AZStd::vector<AZStd::string> JointsManipulationComponent::GetJointNames()
+    {
+        return m_jointNames;
+    }
+
+    AZ::Outcome<JointIndex, AZStd::string> JointsManipulationComponent::GetJointIndex(const AZStd::string& jointName)
+    {
+        auto it = m_jointIndices.find(jointName);
+        if (it == m_jointIndices.end())
+        {
+            return AZ::Failure(AZStd::string::format("Joint %s does not exist", jointName.c_str()));
+        }
+        return AZ::Success(it->second);
+    }
+
+    void JointsManipulationComponent::GetAllJointsStates(JointsStates& states, bool includeEfforts)
+    {
+        Utils::GetJointsStates(m_jointInfos, states, includeEfforts);
+    }
+
+    void JointsManipulationComponent::SetJoints(const ManipulationJoints& manipulationJoints)
+    {
+        m_jointNames.clear();
+        m_jointInfos.clear();
+        m_jointIndices.clear();
+        m_jointNames.reserve(manipulationJoints.size());
+        m_jointInfos.reserve(manipulationJoints.size());
+        for (const auto& [jointName, jointInfo] : manipulationJoints)
+        {
+            m_jointNames.push_back(jointName);
+        }
+        AZStd::sort(m_jointNames.begin(), m_jointNames.end());
+        for (const auto& jointName : m_jointNames)
+        {
+            m_jointIndices[jointName] = m_jointInfos.size();
+            m_jointInfos.push_back(manipulationJoints.at(jointName));
+        }
+        JointsManipulationNotificationBus::Event(GetEntityId(), &JointsManipulationNotifications::OnJointsChanged);
     }
 
     AZ::Outcome<JointPosition, AZStd::string> JointsManipulationComponent::GetJointPosition(const JointInfo& jointInfo)
@@ -219,12 +268,13 @@ namespace ROS2
 
     AZ::Outcome<JointPosition, AZStd::string> JointsManipulationComponent::GetJointPosition(const AZStd::string& jointName)
     {
-        if (!m_manipulationJoints.contains(jointName))
+        auto jointIndex = GetJointIndex(jointName);
+        if (!jointIndex)
         {
-            return AZ::Failure(AZStd::string::format("Joint %s does not exist", jointName.c_str()));
+            return AZ::Failure(jointIndex.GetError());
         }
 
-        auto jointInfo = m_manipulationJoints.at(jointName);
+        const auto& jointInfo = m_jointInfos[jointIndex.GetValue()];
 
         return GetJointPosition(jointInfo);
     }
@@ -249,31 +299,34 @@ namespace ROS2
 
     AZ::Outcome<JointVelocity, AZStd::string> JointsManipulationComponent::GetJointVelocity(const AZStd::string& jointName)
     {
-        if (!m_manipulationJoints.contains(jointName))
+        auto jointIndex = GetJointIndex(jointName);
+        if (!jointIndex)
         {
-            return AZ::Failure(AZStd::string::format("Joint %s does not exist", jointName.c_str()));
+            return AZ::Failure(jointIndex.GetError());
         }
 
-        auto jointInfo = m_manipulationJoints.at(jointName);
+        const auto& jointInfo = m_jointInfos[jointIndex.GetValue()];
         return GetJointVelocity(jointInfo);
     }
 
     JointsManipulationRequests::JointsPositionsMap JointsManipulationComponent::GetAllJointsPositions()
     {
+        Utils::GetJointsStates(m_jointInfos, m_jointsStates, false);
         JointsManipulationRequests::JointsPositionsMap positions;
-        for (const auto& [jointName, jointInfo] : m_manipulationJoints)
+        for (JointIndex jointIndex = 0; jointIndex < m_jointNames.size(); ++jointIndex)
         {
-            positions[jointName] = GetJointPosition(jointInfo).GetValue();
+            positions[m_jointNames[jointIndex]] = m_jointsStates.m_positions[jointIndex];
         }
         return positions;
     }
 
     JointsManipulationRequests::JointsVelocitiesMap JointsManipulationComponent::GetAllJointsVelocities()
     {
+        Utils::GetJointsStates(m_jointInfos, m_jointsStates, false);
         JointsManipulationRequests::JointsVelocitiesMap velocities;
-        for (const auto& [jointName, jointInfo] : m_manipulationJoints)
+        for (JointIndex jointIndex = 0; jointIndex < m_jointNames.size(); ++jointIndex)
         {
-            velocities[jointName] = GetJointVelocity(jointInfo).GetValue();
+            velocities[m_jointNames[jointIndex]] = m_jointsStates.m_velocities[jointIndex];
         }
         return velocities;
     }
@@ -287,33 +340,36 @@ namespace ROS2
 
     AZ::Outcome<JointEffort, AZStd::string> JointsManipulationComponent::GetJointEffort(const AZStd::string& jointName)
     {
-        if (!m_manipulationJoints.contains(jointName))
+        auto jointIndex = GetJointIndex(jointName);
+        if (!jointIndex)
         {
-            return AZ::Failure(AZStd::string::format("Joint %s does not exist", jointName.c_str()));
+            return AZ::Failure(jointIndex.GetError());
         }
 
-        auto jointInfo = m_manipulationJoints.at(jointName);
+        const auto& jointInfo = m_jointInfos[jointIndex.GetValue()];
         return GetJointEffort(jointInfo);
     }
 
     JointsManipulationRequests::JointsEffortsMap JointsManipulationComponent::GetAllJointsEfforts()
     {
+        Utils::GetJointsStates(m_jointInfos, m_jointsStates, true);
         JointsManipulationRequests::JointsEffortsMap efforts;
-        for (const auto& [jointName, jointInfo] : m_manipulationJoints)
+        for (JointIndex jointIndex = 0; jointIndex < m_jointNames.size(); ++jointIndex)
         {
-            efforts[jointName] = GetJointEffort(jointInfo).GetValue();
+            efforts[m_jointNames[jointIndex]] = m_jointsStates.m_efforts[jointIndex];
         }
         return efforts;
     }
 
     AZ::Outcome<void, AZStd::string> JointsManipulationComponent::SetMaxJointEffort(const AZStd::string& jointName, JointEffort maxEffort)
     {
-        if (!m_manipulationJoints.contains(jointName))
+        auto jointIndex = GetJointIndex(jointName);
+        if (!jointIndex)
         {
-            return AZ::Failure(AZStd::string::format("Joint %s does not exist", jointName.c_str()));
+            return AZ::Failure(jointIndex.GetError());
         }
 
-        auto jointInfo = m_manipulationJoints.at(jointName);
+        const auto& jointInfo = m_jointInfos[jointIndex.GetValue()];
 
         if (jointInfo.m_isArticulation)
         {
@@ -330,11 +386,34 @@ namespace ROS2
     AZ::Outcome<void, AZStd::string> JointsManipulationComponent::MoveJointToPosition(
         const AZStd::string& jointName, JointPosition position)
     {
-        if (!m_manipulationJoints.contains(jointName))
+        auto jointIndex = GetJointIndex(jointName);
+        if (!jointIndex)
         {
-            return AZ::Failure(AZStd::string::format("Joint %s does not exist", jointName.c_str()));
+            return AZ::Failure(jointIndex.GetError());
+        }
+        m_jointInfos[jointIndex.GetValue()].m_restPosition = position;
+        return AZ::Success();
+    }
+
+    AZ::Outcome<void, AZStd::string> JointsManipulationComponent::MoveJointsToPositionsByIndex(
+        const AZStd::vector<JointIndex>& jointIndices, const AZStd::vector<JointPosition>& positions)
+    {
+        if (jointIndices.size() != positions.size())
+        {
+            return AZ::Failure(AZStd::string::format(
+                "Number of joint indices (%zu) does not match the number of positions (%zu)", jointIndices.size(), positions.size()));
+        }
+        for (const JointIndex jointIndex : jointIndices)
+        {
+            if (jointIndex >= m_jointInfos.size())
+            {
+                return AZ::Failure(AZStd::string::format("Joint index %zu does not exist", jointIndex));
+            }
+        }
+        for (size_t i = 0; i < jointIndices.size(); ++i)
+        {
+            m_jointInfos[jointIndices[i]].m_restPosition = positions[i];
         }
-        m_manipulationJoints[jointName].m_restPosition = position;
         return AZ::Success();
     }
 
@@ -381,38 +460,33 @@ namespace ROS2
 
     void JointsManipulationComponent::MoveToSetPositions(float deltaTime)
     {
-        for (const auto& [jointName, jointInfo] : m_manipulationJoints)
-        {
-            float currentPosition = GetJointPosition(jointName).GetValue();
-            float desiredPosition = jointInfo.m_restPosition;
-
-            AZ::Outcome<void, AZStd::string> positionControlOutcome;
-            JointsPositionControllerRequestBus::EventResult(
-                positionControlOutcome,
-                GetEntityId(),
-                &JointsPositionControllerRequests::PositionControl,
-                jointName,
-                jointInfo,
-                currentPosition,
-                desiredPosition,
-                deltaTime);
-
-            AZ_Warning(
-                "JointsManipulationComponent",
-                positionControlOutcome,
-                "Position control failed for joint %s (%s): %s",
-                jointName.c_str(),
-                jointInfo.m_entityComponentIdPair.GetEntityId().ToString().c_str(),
-                positionControlOutcome.GetError().c_str());
-        }
+        Utils::GetJointsStates(m_jointInfos, m_jointsStates, false);
+
+        AZ::Outcome<void, AZStd::string> positionControlOutcome;
+        JointsPositionControllerRequestBus::EventResult(
+            positionControlOutcome,
+            GetEntityId(),
+            &JointsPositionControllerRequests::PositionControlAll,
+            m_jointNames,
+            m_jointInfos,
+            m_jointsStates.m_positions,
+            deltaTime);
+
+        AZ_Warning(
+            "JointsManipulationComponent",
+            positionControlOutcome,
+            "Position control failed for entity %s: %s",
+            GetEntityId().ToString().c_str(),
+            positionControlOutcome.GetError().c_str());
     }
 
     void JointsManipulationComponent::Stop()
     {
-        for (auto& [jointName, jointInfo] : m_manipulationJoints)
-        { // Set all target joint positions to their current positions. There is no need to check if the outcome is successful, because
-          // jointName is always valid.
-            jointInfo.m_restPosition = GetJointPosition(jointName).GetValue();
+        // Set all target joint positions to their current positions.
+        Utils::GetJointsStates(m_jointInfos, m_jointsStates, false);
+        for (JointIndex jointIndex = 0; jointIndex < m_jointInfos.size(); ++jointIndex)
+        {
+            m_jointInfos[jointIndex].m_restPosition = m_jointsStates.m_positions[jointIndex];
         }
     }
 
@@ -424,8 +498,8 @@ namespace ROS2
     }
 
     void JointsManipulationComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
-    {
-        if (m_manipulationJoints.empty())
+    { // Joints are gathered on the first tick, when the whole entity hierarchy is active. Control itself runs at every physics substep.
+        if (m_jointInfos.empty())
         {
             const AZStd::string manipulatorNamespace = GetManipulatorNamespace();
             AZStd::unordered_map<AZStd::string, JointPosition> initialPositionNamespaced;
@@ -438,10 +512,11 @@ namespace ROS2
                     return AZStd::make_pair(ROS2::ROS2Names::GetNamespacedName(manipulatorNamespace, pair.first), pair.second);
                 });
 
-            m_manipulationJoints = Internal::GetAllEntityHierarchyJoints(GetEntityId());
+            ManipulationJoints manipulationJoints = Internal::GetAllEntityHierarchyJoints(GetEntityId());
 
-            Internal::SetInitialPositions(m_manipulationJoints, initialPositionNamespaced);
-            if (m_manipulationJoints.empty())
+            Internal::SetInitialPositions(manipulationJoints, initialPositionNamespaced);
+            SetJoints(manipulationJoints);
+            if (m_jointInfos.empty())
             {
                 AZ_Warning("JointsManipulationComponent", false, "No manipulation joints to handle!");
                 AZ::TickBus::Handler::BusDisconnect();
@@ -449,9 +524,18 @@ namespace ROS2
             }
             m_jointStatePublisher->InitializePublisher();
         }
-        auto simTimestamp = ROS2Interface::Get()->GetROSTimestamp();
-        float deltaSimTime = ROS2Conversions::GetTimeDifference(m_lastTickTimestamp, simTimestamp);
-        MoveToSetPositions(deltaSimTime);
-        m_lastTickTimestamp = simTimestamp;
+
+        auto* controlLoop = ControlLoopInterface::Get();
+        AZ_Assert(controlLoop, "Control loop is not available, joints will not be controlled");
+        if (controlLoop)
+        {
+            m_controllerHandle = controlLoop->RegisterController(
+                GetEntityId(),
+                [this](float controlDeltaTime)
+                {
+                    MoveToSetPositions(controlDeltaTime);
+                });
+        }
+        AZ::TickBus::Handler::BusDisconnect();
     }
 } // namespace ROS2
@@ -18,6 +18,7 @@
 
 #include "JointStatePublisher.h"
 #include <ROS2/Manipulation/JointsManipulationRequests.h>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
 
 namespace ROS2
 {
@@ -44,6 +45,12 @@ namespace ROS2
         // JointsManipulationRequestBus::Handler overrides ...
         //! @see ROS2::JointsManipulationRequestBus::GetJoints
         ManipulationJoints GetJoints() override;
+        //! @see ROS2::JointsManipulationRequestBus::GetJointNames
+        AZStd::vector<AZStd::string> GetJointNames() override;
+        //! @see ROS2::JointsManipulationRequestBus::GetJointIndex
+        AZ::Outcome<JointIndex, AZStd::string> GetJointIndex(const AZStd::string& jointName) override;
+        //! @see ROS2::JointsManipulationRequestBus::GetAllJointsStates
+        void GetAllJointsStates(JointsStates& states, bool includeEfforts) override;
         //! @see ROS2::JointsManipulationRequestBus::GetJointPosition
         AZ::Outcome<JointPosition, AZStd::string> GetJointPosition(const AZStd::string& jointName) override;
         //! @see ROS2::JointsManipulationRequestBus::GetJointVelocity
@@ -60,6 +67,9 @@ namespace ROS2
         AZ::Outcome<void, AZStd::string> SetMaxJointEffort(const AZStd::string& jointName, JointEffort maxEffort);
         //! @see ROS2::JointsManipulationRequestBus::MoveJointsToPositions
         AZ::Outcome<void, AZStd::string> MoveJointsToPositions(const JointsPositionsMap& positions) override;
+        //! @see ROS2::JointsManipulationRequestBus::MoveJointsToPositionsByIndex
+        AZ::Outcome<void, AZStd::string> MoveJointsToPositionsByIndex(
+            const AZStd::vector<JointIndex>& jointIndices, const AZStd::vector<JointPosition>& positions) override;
         //! @see ROS2::JointsManipulationRequestBus::MoveJointToPosition
         AZ::Outcome<void, AZStd::string> MoveJointToPosition(const AZStd::string& jointName, JointPosition position) override;
         //! @see ROS2::JointsManipulationRequestBus::Stop
@@ -77,15 +87,22 @@ namespace ROS2
 
         AZStd::string GetManipulatorNamespace() const;
 
+        //! Store joints in a stable order sorted by name and build the name to index lookup.
+        //! Notifies JointsManipulationNotificationBus, as indices resolved before are no longer valid.
+        void SetJoints(const ManipulationJoints& manipulationJoints);
+
         AZ::Outcome<JointPosition, AZStd::string> GetJointPosition(const JointInfo& jointInfo);
         AZ::Outcome<JointVelocity, AZStd::string> GetJointVelocity(const JointInfo& jointInfo);
         AZ::Outcome<JointEffort, AZStd::string> GetJointEffort(const JointInfo& jointInfo);
 
         AZStd::unique_ptr<JointStatePublisher> m_jointStatePublisher;
         PublisherConfiguration m_jointStatePublisherConfiguration;
-        ManipulationJoints m_manipulationJoints; //!< Map of JointInfo where the key is a joint name (with namespace included)
+        AZStd::vector<AZStd::string> m_jointNames; //!< Joint names (with namespace included) in JointIndex order
+        AZStd::vector<JointInfo> m_jointInfos; //!< Joint infos in JointIndex order, rest positions are the current targets
+        AZStd::unordered_map<AZStd::string, JointIndex> m_jointIndices; //!< Resolves a joint name to its JointIndex
+        JointsStates m_jointsStates; //!< Reused each tick to read the current joint positions
         AZStd::vector<AZStd::pair<AZStd::string, float>> 
             m_initialPositions; //!< Initial positions per joint name (without namespace included)
-        builtin_interfaces::msg::Time m_lastTickTimestamp; //!< ROS 2 Timestamp during last OnTick call
+        ControlLoopRequests::ControllerHandle m_controllerHandle = ControlLoopRequests::InvalidControllerHandle; //!< Runs MoveToSetPositions
     };
 } // namespace ROS2
@@ -8,7 +8,6 @@
 
 #include "JointsTrajectoryComponent.h"
 #include <AzCore/Serialization/EditContext.h>
-#include <PhysX/ArticulationJointBus.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/Manipulation/JointsManipulationRequests.h>
 #include <ROS2/ROS2Bus.h>
@@ -33,13 +32,13 @@ namespace ROS2
         m_lastTickTimestamp = ROS2Interface::Get()->GetROSTimestamp();
     }
 
-    ManipulationJoints& JointsTrajectoryComponent::GetManipulationJoints()
+    const AZStd::vector<AZStd::string>& JointsTrajectoryComponent::GetJointNames()
     {
-        if (m_manipulationJoints.empty())
+        if (m_jointNames.empty())
         {
-            JointsManipulationRequestBus::EventResult(m_manipulationJoints, GetEntityId(), &JointsManipulationRequests::GetJoints);
+            JointsManipulationRequestBus::EventResult(m_jointNames, GetEntityId(), &JointsManipulationRequests::GetJointNames);
         }
-        return m_manipulationJoints;
+        return m_jointNames;
     }
 
     void JointsTrajectoryComponent::Deactivate()
@@ -113,11 +112,15 @@ namespace ROS2
 
     AZ::Outcome<void, JointsTrajectoryComponent::TrajectoryResult> JointsTrajectoryComponent::ValidateGoal(TrajectoryGoalPtr trajectoryGoal)
     {
-        // Check joint names validity
+        // Check joint names validity and resolve them to indices once for the whole goal
+        AZStd::vector<JointIndex> goalJointIndices;
+        goalJointIndices.reserve(trajectoryGoal->trajectory.joint_names.size());
         for (const auto& jointName : trajectoryGoal->trajectory.joint_names)
         {
             AZStd::string azJointName(jointName.c_str());
-            if (m_manipulationJoints.find(azJointName) == m_manipulationJoints.end())
+            AZ::Outcome<JointIndex, AZStd::string> jointIndex = AZ::Failure(AZStd::string());
+            JointsManipulationRequestBus::EventResult(jointIndex, GetEntityId(), &JointsManipulationRequests::GetJointIndex, azJointName);
+            if (!jointIndex)
             {
                 AZ_Printf("JointsTrajectoryComponent", "Trajectory goal is invalid: no joint %s in manipulator", azJointName.c_str());
 
@@ -128,7 +131,9 @@ namespace ROS2
 
                 return AZ::Failure(result);
             }
+            goalJointIndices.push_back(jointIndex.GetValue());
         }
+        m_goalJointIndices = AZStd::move(goalJointIndices);
         return AZ::Success();
     }
 
@@ -146,26 +151,17 @@ namespace ROS2
 
         trajectory_msgs::msg::JointTrajectoryPoint actualPoint;
 
+        JointsManipulationRequestBus::Event(GetEntityId(), &JointsManipulationRequests::GetAllJointsStates, m_jointsStates, false);
+
         size_t jointCount = m_trajectoryGoal.trajectory.joint_names.size();
+        AZ_Assert(m_goalJointIndices.size() == jointCount, "Joint indices were not resolved for the trajectory goal");
         for (size_t jointIndex = 0; jointIndex < jointCount; jointIndex++)
         {
-            AZStd::string jointName(m_trajectoryGoal.trajectory.joint_names[jointIndex].c_str());
-            std::string jointNameStdString(jointName.c_str());
-            feedback->joint_names.push_back(jointNameStdString);
-
-            float currentJointPosition;
-            float currentJointVelocity;
-            auto& jointInfo = m_manipulationJoints[jointName];
-            PhysX::ArticulationJointRequestBus::Event(
-                jointInfo.m_entityComponentIdPair.GetEntityId(),
-                [&](PhysX::ArticulationJointRequests* articulationJointRequests)
-                {
-                    currentJointPosition = articulationJointRequests->GetJointPosition(jointInfo.m_axis);
-                    currentJointVelocity = articulationJointRequests->GetJointVelocity(jointInfo.m_axis);
-                });
-
-            actualPoint.positions.push_back(static_cast<double>(currentJointPosition));
-            actualPoint.velocities.push_back(static_cast<double>(currentJointVelocity));
+            feedback->joint_names.push_back(m_trajectoryGoal.trajectory.joint_names[jointIndex]);
+
+            const JointIndex manipulatorJointIndex = m_goalJointIndices[jointIndex];
+            actualPoint.positions.push_back(static_cast<double>(m_jointsStates.m_positions[manipulatorJointIndex]));
+            actualPoint.velocities.push_back(static_cast<double>(m_jointsStates.m_velocities[manipulatorJointIndex]));
             // Acceleration should also be filled in somehow, or removed from the trajectory altogether.
         }
 
@@ -240,24 +236,26 @@ namespace ROS2
 
     void JointsTrajectoryComponent::MoveToNextPoint(const trajectory_msgs::msg::JointTrajectoryPoint currentTrajectoryPoint)
     {
-        for (int jointIndex = 0; jointIndex < m_trajectoryGoal.trajectory.joint_names.size(); jointIndex++)
-        { // Order each joint to be moved
-            AZStd::string jointName(m_trajectoryGoal.trajectory.joint_names[jointIndex].c_str());
-            AZ_Assert(m_manipulationJoints.find(jointName) != m_manipulationJoints.end(), "Invalid trajectory executing");
-
-            float targetPos = currentTrajectoryPoint.positions[jointIndex];
-            AZ::Outcome<void, AZStd::string> result;
-            JointsManipulationRequestBus::EventResult(
-                result, GetEntityId(), &JointsManipulationRequests::MoveJointToPosition, jointName, targetPos);
-            AZ_Warning("JointTrajectoryComponent", result, "Joint move cannot be realized: %s", result.GetError().c_str());
+        AZ_Assert(m_goalJointIndices.size() == m_trajectoryGoal.trajectory.joint_names.size(), "Invalid trajectory executing");
+
+        m_goalPositions.resize(m_goalJointIndices.size());
+        for (size_t jointIndex = 0; jointIndex < m_goalJointIndices.size(); jointIndex++)
+        {
+            m_goalPositions[jointIndex] = currentTrajectoryPoint.positions[jointIndex];
         }
+
+        // Order all joints to be moved at once
+        AZ::Outcome<void, AZStd::string> result;
+        JointsManipulationRequestBus::EventResult(
+            result, GetEntityId(), &JointsManipulationRequests::MoveJointsToPositionsByIndex, m_goalJointIndices, m_goalPositions);
+        AZ_Warning("JointTrajectoryComponent", result, "Joint move cannot be realized: %s", result.GetError().c_str());
     }
 
     void JointsTrajectoryComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        if (m_manipulationJoints.empty())
+        if (m_jointNames.empty())
         {
-            GetManipulationJoints();
+            GetJointNames();
             return;
         }
         const auto simTimestamp = ROS2Interface::Get()->GetROSTimestamp();
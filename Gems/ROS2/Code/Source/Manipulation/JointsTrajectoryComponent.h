@@ -59,13 +59,16 @@ namespace ROS2
         void UpdateFeedback();
 
         //! Lazy initialize Manipulation joints on the start of simulation.
-        ManipulationJoints& GetManipulationJoints();
+        const AZStd::vector<AZStd::string>& GetJointNames();
 
         AZStd::string m_followTrajectoryActionName{ "arm_controller/follow_joint_trajectory" };
         AZStd::unique_ptr<FollowJointTrajectoryActionServer> m_followTrajectoryServer;
         TrajectoryGoal m_trajectoryGoal;
         rclcpp::Time m_trajectoryExecutionStartTime;
-        ManipulationJoints m_manipulationJoints;
+        AZStd::vector<AZStd::string> m_jointNames; //!< Joint names of the manipulator in JointIndex order
+        AZStd::vector<JointIndex> m_goalJointIndices; //!< Indices of the joints named in the current trajectory goal, resolved once per goal
+        AZStd::vector<JointPosition> m_goalPositions; //!< Reused to send target positions of the goal joints
+        JointsStates m_jointsStates; //!< Reused to read the current state of all joints for feedback
         bool m_trajectoryInProgress{ false };
         builtin_interfaces::msg::Time m_lastTickTimestamp; //!< ROS 2 Timestamp during last OnTick call
     };
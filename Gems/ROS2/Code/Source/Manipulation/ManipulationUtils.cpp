@@ -12,41 +12,72 @@
 
 namespace ROS2::Utils
 {
-    JointStateData GetJointState(const JointInfo& jointInfo)
+    namespace Internal
     {
-        JointStateData result;
-
-        if (jointInfo.m_isArticulation)
+        JointStateData GetJointState(const JointInfo& jointInfo, bool includeEffort)
         {
-            PhysX::ArticulationJointRequestBus::Event(
-                jointInfo.m_entityComponentIdPair.GetEntityId(),
-                [&](PhysX::ArticulationJointRequests* articulationJointRequests)
-                {
-                    result.position = articulationJointRequests->GetJointPosition(jointInfo.m_axis);
-                    result.velocity = articulationJointRequests->GetJointVelocity(jointInfo.m_axis);
-                    const bool is_acceleration_driven = articulationJointRequests->IsAccelerationDrive(jointInfo.m_axis);
-                    if (!is_acceleration_driven)
+            JointStateData result;
+
+            if (jointInfo.m_isArticulation)
+            {
+                PhysX::ArticulationJointRequestBus::Event(
+                    jointInfo.m_entityComponentIdPair.GetEntityId(),
+                    [&](PhysX::ArticulationJointRequests* articulationJointRequests)
                     {
-                        const float stiffness = articulationJointRequests->GetDriveStiffness(jointInfo.m_axis);
-                        const float damping = articulationJointRequests->GetDriveDamping(jointInfo.m_axis);
-                        const float targetPosition = articulationJointRequests->GetDriveTarget(jointInfo.m_axis);
-                        const float targetVelocity = articulationJointRequests->GetDriveTargetVelocity(jointInfo.m_axis);
-                        const float maxEffort = articulationJointRequests->GetMaxForce(jointInfo.m_axis);
-                        result.effort = stiffness * -(result.position - targetPosition) + damping * (targetVelocity - result.velocity);
-                        result.effort = AZ::GetClamp(result.effort, -maxEffort, maxEffort);
-                    }
-                });
+                        result.position = articulationJointRequests->GetJointPosition(jointInfo.m_axis);
+                        result.velocity = articulationJointRequests->GetJointVelocity(jointInfo.m_axis);
+                        if (!includeEffort)
+                        {
+                            return;
+                        }
+                        const bool is_acceleration_driven = articulationJointRequests->IsAccelerationDrive(jointInfo.m_axis);
+                        if (!is_acceleration_driven)
+                        {
+                            const float stiffness = articulationJointRequests->GetDriveStiffness(jointInfo.m_axis);
+                            const float damping = articulationJointRequests->GetDriveDamping(jointInfo.m_axis);
+                            const float targetPosition = articulationJointRequests->GetDriveTarget(jointInfo.m_axis);
+                            const float targetVelocity = articulationJointRequests->GetDriveTargetVelocity(jointInfo.m_axis);
+                            const float maxEffort = articulationJointRequests->GetMaxForce(jointInfo.m_axis);
+                            result.effort = stiffness * -(result.position - targetPosition) + damping * (targetVelocity - result.velocity);
+                            result.effort = AZ::GetClamp(result.effort, -maxEffort, maxEffort);
+                        }
+                    });
+            }
+            else
+            {
+                PhysX::JointRequestBus::Event(
+                    jointInfo.m_entityComponentIdPair,
+                    [&](PhysX::JointRequests* jointRequests)
+                    {
+                        result.position = jointRequests->GetPosition();
+                        result.velocity = jointRequests->GetVelocity();
+                    });
+            }
+            return result;
         }
-        else
+    } // namespace Internal
+
+    JointStateData GetJointState(const JointInfo& jointInfo)
+    {
+        return Internal::GetJointState(jointInfo, true);
+    }
+
+    void GetJointsStates(const AZStd::vector<JointInfo>& joints, JointsStates& states, bool includeEfforts)
+    {
+        const size_t jointCount = joints.size();
+        states.m_positions.resize(jointCount);
+        states.m_velocities.resize(jointCount);
+        states.m_efforts.resize(includeEfforts ? jointCount : 0);
+
+        for (size_t jointIndex = 0; jointIndex < jointCount; ++jointIndex)
         {
-            PhysX::JointRequestBus::Event(
-                jointInfo.m_entityComponentIdPair,
-                [&](PhysX::JointRequests* jointRequests)
-                {
-                    result.position = jointRequests->GetPosition();
-                    result.velocity = jointRequests->GetVelocity();
-                });
+            const JointStateData jointStateData = Internal::GetJointState(joints[jointIndex], includeEfforts);
+            states.m_positions[jointIndex] = jointStateData.position;
+            states.m_velocities[jointIndex] = jointStateData.velocity;
+            if (includeEfforts)
+            {
+                states.m_efforts[jointIndex] = jointStateData.effort;
+            }
         }
-        return result;
     }
 } // namespace ROS2::Utils
@@ -22,4 +22,10 @@ namespace ROS2::Utils
     //! @param jointInfo Info of the joint we want to get data of.
     //! @return Data with the current joint state.
     JointStateData GetJointState(const JointInfo& jointInfo);
+
+    //! Get the current state of a set of joints in a single pass, with one bus event per joint.
+    //! @param joints Infos of the joints we want to get data of.
+    //! @param states Output arrays, resized to the number of joints and filled in the same order as joints.
+    //! @param includeEfforts Whether to compute efforts. When false, the efforts array is left empty.
+    void GetJointsStates(const AZStd::vector<JointInfo>& joints, JointsStates& states, bool includeEfforts);
 } // namespace ROS2::Utils
@@ -12,16 +12,21 @@
 #include <PhysX/Joint/PhysXJointRequestsBus.h>
 #include <PrismaticJointComponent.h>
 #include <ROS2/Manipulation/MotorizedJoints/JointMotorControllerComponent.h>
-#include <ROS2/ROS2Bus.h>
-#include <ROS2/Utilities/ROS2Conversions.h>
 #include <imgui/imgui.h>
 
 namespace ROS2
 {
     void JointMotorControllerComponent::Activate()
     {
-        m_lastTickTimestamp = ROS2::ROS2Interface::Get()->GetROSTimestamp();
-        AZ::TickBus::Handler::BusConnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            m_controllerHandle = controlLoop->RegisterController(
+                GetEntityId(),
+                [this](float deltaTime)
+                {
+                    Control(deltaTime);
+                });
+        }
         ImGui::ImGuiUpdateListenerBus::Handler::BusConnect();
         AZ::EntityBus::Handler::BusConnect(GetEntityId());
     }
@@ -29,7 +34,11 @@ namespace ROS2
     void JointMotorControllerComponent::Deactivate()
     {
         ImGui::ImGuiUpdateListenerBus::Handler::BusDisconnect();
-        AZ::TickBus::Handler::BusDisconnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            controlLoop->UnregisterController(m_controllerHandle);
+        }
+        m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
     }
 
     void JointMotorControllerComponent::Reflect(AZ::ReflectContext* context)
@@ -79,7 +88,7 @@ namespace ROS2
         ImGui::End();
     }
 
-    void JointMotorControllerComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void JointMotorControllerComponent::Control(float deltaTime)
     {
         if (!m_jointComponentIdPair.GetEntityId().IsValid())
         {
@@ -88,11 +97,8 @@ namespace ROS2
 
         PhysX::JointRequestBus::EventResult(m_currentPosition, m_jointComponentIdPair, &PhysX::JointRequests::GetPosition);
 
-        const auto timestamp = ROS2::ROS2Interface::Get()->GetROSTimestamp();
-        const float deltaSimTime = ROS2Conversions::GetTimeDifference(m_lastTickTimestamp, timestamp);
-        const float setSpeed = CalculateMotorSpeed(deltaSimTime);
+        const float setSpeed = CalculateMotorSpeed(deltaTime);
         PhysX::JointRequestBus::Event(m_jointComponentIdPair, &PhysX::JointRequests::SetVelocity, setSpeed);
-        m_lastTickTimestamp = timestamp;
     }
 
     void JointMotorControllerComponent::OnEntityActivated(const AZ::EntityId& entityId)
@@ -18,6 +18,7 @@
 #include <Gripper/FingerGripperComponent.h>
 #include <Gripper/GripperActionServerComponent.h>
 #include <Gripper/VacuumGripperComponent.h>
+#include <GroundTruth/ROS2GroundTruthComponent.h>
 #include <Imu/ROS2ImuSensorComponent.h>
 #include <Lidar/LidarRegistrarSystemComponent.h>
 #include <Lidar/ROS2Lidar2DSensorComponent.h>
@@ -72,6 +73,7 @@ namespace ROS2
                     ROS2Lidar2DSensorComponent::CreateDescriptor(),
                     ROS2OdometrySensorComponent::CreateDescriptor(),
                     ROS2WheelOdometryComponent::CreateDescriptor(),
+                    ROS2GroundTruthComponent::CreateDescriptor(),
                     ROS2FrameComponent::CreateDescriptor(),
                     ROS2RobotControlComponent::CreateDescriptor(),
                     ROS2CameraSensorComponent::CreateDescriptor(),
@@ -8,11 +8,10 @@
 
 #include "AckermannSubscriptionHandler.h"
 #include <ROS2/RobotControl/Ackermann/AckermannBus.h>
-#include <ROS2/RobotControl/Ackermann/AckermannCommandStruct.h>
 
 namespace ROS2
 {
-    void AckermannSubscriptionHandler::SendToBus(const ackermann_msgs::msg::AckermannDrive& message)
+    AckermannCommandStruct AckermannSubscriptionHandler::ConvertMessage(const ackermann_msgs::msg::AckermannDrive& message) const
     {
         AckermannCommandStruct acs;
         acs.m_acceleration = message.acceleration;
@@ -20,6 +19,11 @@ namespace ROS2
         acs.m_speed = message.speed;
         acs.m_steeringAngle = message.steering_angle;
         acs.m_steeringAngleVelocity = message.steering_angle_velocity;
-        AckermannNotificationBus::Event(GetEntityId(), &AckermannNotifications::AckermannReceived, acs);
+        return acs;
+    }
+
+    void AckermannSubscriptionHandler::SendToBus(const AckermannCommandStruct& command)
+    {
+        AckermannNotificationBus::Event(GetEntityId(), &AckermannNotifications::AckermannReceived, command);
     }
 } // namespace ROS2
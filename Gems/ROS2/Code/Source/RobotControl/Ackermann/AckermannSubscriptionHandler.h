@@ -7,14 +7,19 @@
  */
 #pragma once
 
+#include <ROS2/RobotControl/Ackermann/AckermannCommandStruct.h>
 #include <ROS2/RobotControl/ControlSubscriptionHandler.h>
 #include <ackermann_msgs/msg/ackermann_drive.hpp>
 
 namespace ROS2
 {
-    class AckermannSubscriptionHandler : public ControlSubscriptionHandler<ackermann_msgs::msg::AckermannDrive>
+    class AckermannSubscriptionHandler : public ControlSubscriptionHandler<ackermann_msgs::msg::AckermannDrive, AckermannCommandStruct>
     {
+    public:
+        using ControlSubscriptionHandler::ControlSubscriptionHandler;
+
     private:
-        void SendToBus(const ackermann_msgs::msg::AckermannDrive& message) override;
+        AckermannCommandStruct ConvertMessage(const ackermann_msgs::msg::AckermannDrive& message) const override;
+        void SendToBus(const AckermannCommandStruct& command) override;
     };
 } // namespace ROS2
@@ -15,7 +15,10 @@ namespace ROS2
     {
         if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
-            serializeContext->Class<ControlConfiguration>()->Version(1)->Field("Steering", &ControlConfiguration::m_steering);
+            serializeContext->Class<ControlConfiguration>()
+                ->Version(2)
+                ->Field("Steering", &ControlConfiguration::m_steering)
+                ->Field("CommandTimeout", &ControlConfiguration::m_commandTimeout);
 
             if (AZ::EditContext* ec = serializeContext->GetEditContext())
             {
@@ -27,7 +30,13 @@ namespace ROS2
                         "Determines how the robot is controlled.")
                     ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
                     ->EnumAttribute(ControlConfiguration::Steering::Twist, "Twist")
-                    ->EnumAttribute(ControlConfiguration::Steering::Ackermann, "Ackermann");
+                    ->EnumAttribute(ControlConfiguration::Steering::Ackermann, "Ackermann")
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ControlConfiguration::m_commandTimeout,
+                        "Command timeout",
+                        "Time after which the robot stops if no new command was received (seconds)")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f);
             }
         }
     }
@@ -10,7 +10,6 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzFramework/Physics/RigidBodyBus.h>
-#include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 
 namespace ROS2
 {
@@ -33,11 +32,34 @@ namespace ROS2
 
     void AckermannControlComponent::Activate()
     {
-        AckermannNotificationBus::Handler::BusConnect(GetEntityId());
+        float commandTimeout = 0.0f;
+        RobotControlRequestBus::EventResult(m_commandSlot, GetEntityId(), &RobotControlRequests::GetAckermannCommandSlot);
+        RobotControlRequestBus::EventResult(commandTimeout, GetEntityId(), &RobotControlRequests::GetCommandTimeout);
+        AZ_Warning("AckermannControlComponent", m_commandSlot, "Robot control of entity %s is not set to Ackermann", GetEntity()->GetName().c_str());
+        m_commandTimeout = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::duration<float>(commandTimeout));
+        m_commandActive = false;
+        VehicleDynamics::VehicleInputControlRequestBus::Bind(m_vehicleInputBus, GetEntityId());
+
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            m_controllerHandle = controlLoop->RegisterController(
+                GetEntityId(),
+                [this](float deltaTime)
+                {
+                    Control(deltaTime);
+                });
+        }
     }
+
     void AckermannControlComponent::Deactivate()
     {
-        AckermannNotificationBus::Handler::BusDisconnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            controlLoop->UnregisterController(m_controllerHandle);
+        }
+        m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
+        m_vehicleInputBus = nullptr;
+        m_commandSlot = nullptr;
     }
 
     void AckermannControlComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -46,12 +68,31 @@ namespace ROS2
         required.push_back(AZ_CRC_CE("AckermannModelService"));
     }
 
-    void AckermannControlComponent::AckermannReceived(const AckermannCommandStruct& acs)
+    void AckermannControlComponent::Control([[maybe_unused]] float deltaTime)
     {
+        if (!m_commandSlot)
+        {
+            return;
+        }
+
+        AckermannCommandStruct acs;
+        AZStd::chrono::nanoseconds commandAge;
+        const bool commandFresh = m_commandSlot->Read(acs, commandAge) && commandAge <= m_commandTimeout;
+        if (!commandFresh && !m_commandActive)
+        {
+            // Inputs are left untouched while there are no commands, so other sources such as manual control still work.
+            return;
+        }
+        m_commandActive = commandFresh;
+        if (!commandFresh)
+        {
+            acs = AckermannCommandStruct{};
+        }
+
         // Notify input system for vehicle dynamics. Only speed and steering is currently supported.
         VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetLinearSpeed, acs.m_speed);
+            m_vehicleInputBus, &VehicleDynamics::VehicleInputControlRequests::SetTargetLinearSpeed, acs.m_speed);
         VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetSteering, acs.m_steeringAngle);
+            m_vehicleInputBus, &VehicleDynamics::VehicleInputControlRequests::SetTargetSteering, acs.m_steeringAngle);
     }
 } // namespace ROS2
@@ -8,14 +8,16 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <ROS2/RobotControl/Ackermann/AckermannBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <ROS2/RobotControl/RobotControlBus.h>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
+#include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 
 namespace ROS2
 {
     //! A simple component which translates ackermann commands to vehicle dynamics inputs
-    class AckermannControlComponent
-        : public AZ::Component
-        , private AckermannNotificationBus::Handler
+    //! The latest command is relayed at every physics substep, the vehicle is stopped when commands time out.
+    class AckermannControlComponent : public AZ::Component
     {
     public:
         AZ_COMPONENT(AckermannControlComponent, "{16EC2F18-F579-414C-8B3B-DB47078729BC}", AZ::Component);
@@ -30,9 +32,13 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
     private:
-        //////////////////////////////////////////////////////////////////////////
-        // AckermannNotificationBus::Handler overrides
-        void AckermannReceived(const AckermannCommandStruct& angular) override;
-        //////////////////////////////////////////////////////////////////////////
+        //! Run by the control loop at every physics substep.
+        void Control(float deltaTime);
+
+        const AckermannCommandSlot* m_commandSlot = nullptr; //!< Owned by the robot control component
+        AZStd::chrono::nanoseconds m_commandTimeout{ 0 };
+        bool m_commandActive = false; //!< Whether the latest command was fresh, to stop the vehicle once it times out
+        VehicleDynamics::VehicleInputControlRequestBus::BusPtr m_vehicleInputBus;
+        ControlLoopRequests::ControllerHandle m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
     };
 } // namespace ROS2
@@ -35,13 +35,16 @@ namespace ROS2
 
     void RigidBodyTwistControlComponent::Activate()
     {
+        float commandTimeout = 0.0f;
+        RobotControlRequestBus::EventResult(m_commandSlot, GetEntityId(), &RobotControlRequests::GetTwistCommandSlot);
+        RobotControlRequestBus::EventResult(commandTimeout, GetEntityId(), &RobotControlRequests::GetCommandTimeout);
+        AZ_Warning("RigidBodyTwistControlComponent", m_commandSlot, "Robot control of entity %s is not set to Twist", GetEntity()->GetName().c_str());
+        m_commandTimeout = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::duration<float>(commandTimeout));
         AZ::TickBus::Handler::BusConnect();
-        TwistNotificationBus::Handler::BusConnect(GetEntityId());
     }
 
     void RigidBodyTwistControlComponent::Deactivate()
     {
-        TwistNotificationBus::Handler::BusDisconnect();
         if (m_sceneFinishSimHandler.IsConnected())
         {
             m_sceneFinishSimHandler.Disconnect();
@@ -50,6 +53,7 @@ namespace ROS2
         {
             AZ::TickBus::Handler::BusDisconnect();
         }
+        m_commandSlot = nullptr;
     }
     
     void RigidBodyTwistControlComponent::OnTick([[maybe_unused]]float deltaTime, [[maybe_unused]]AZ::ScriptTimePoint time)
@@ -77,10 +81,13 @@ namespace ROS2
                     auto* rigidBody = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, m_bodyHandle);
                     AZ_Assert(sceneInterface, "No body found for previously given handle");
 
+                    // Stale commands are zeroed, so the body stops when the command source is lost
+                    const TwistCommandStruct command = m_commandSlot ? m_commandSlot->ReadOrDefault(m_commandTimeout) : TwistCommandStruct{};
+
                     // Convert local steering to world frame
                     const AZ::Transform robotTransform = rigidBody->GetTransform();
-                    const auto linearVelocityGlobal = robotTransform.TransformVector(m_linearVelocityLocal);
-                    const auto angularVelocityGlobal = robotTransform.TransformVector(m_angularVelocityLocal);
+                    const auto linearVelocityGlobal = robotTransform.TransformVector(command.GetLinear());
+                    const auto angularVelocityGlobal = robotTransform.TransformVector(command.GetAngular());
                     Physics::RigidBodyRequestBus::Event(GetEntityId(), &Physics::RigidBodyRequests::SetLinearVelocity, linearVelocityGlobal);
                     Physics::RigidBodyRequestBus::Event(GetEntityId(), &Physics::RigidBodyRequests::SetAngularVelocity, angularVelocityGlobal);
                 },
@@ -94,10 +101,4 @@ namespace ROS2
         required.push_back(AZ_CRC_CE("ROS2RobotControl"));
         required.push_back(AZ_CRC_CE("PhysicsRigidBodyService"));
     }
-
-    void RigidBodyTwistControlComponent::TwistReceived(const AZ::Vector3& linear, const AZ::Vector3& angular)
-    {
-        m_linearVelocityLocal = linear;
-        m_angularVelocityLocal = angular;
-    }
 } // namespace ROS2
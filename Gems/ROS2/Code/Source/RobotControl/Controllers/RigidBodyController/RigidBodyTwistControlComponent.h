@@ -8,16 +8,16 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <ROS2/RobotControl/Twist/TwistBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <ROS2/RobotControl/RobotControlBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzCore/Component/TickBus.h>
 namespace ROS2
 {
     //! A component with a simple handler for Twist type of control (linear and angular velocities).
-    //! Velocities are directly applied to a selected body.
+    //! Velocities are directly applied to a selected body at every physics substep, and zeroed when commands time out.
     class RigidBodyTwistControlComponent
         : public AZ::Component
-        , private TwistNotificationBus::Handler
         , private AZ::TickBus::Handler
     {
     public:
@@ -34,18 +34,13 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
     private:
-        //////////////////////////////////////////////////////////////////////////
-        // TwistNotificationBus::Handler overrides
-        void TwistReceived(const AZ::Vector3& linear, const AZ::Vector3& angular) override;
-        //////////////////////////////////////////////////////////////////////////
-
         //////////////////////////////////////////////////////////////////////////
         // AZ::TickBus::Handler overrides
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         //////////////////////////////////////////////////////////////////////////
 
-        AZ::Vector3 m_linearVelocityLocal {AZ::Vector3::CreateZero()}; //!< Linear velocity in local frame
-        AZ::Vector3 m_angularVelocityLocal {AZ::Vector3::CreateZero()}; //!< Angular velocity in local frame
+        const TwistCommandSlot* m_commandSlot = nullptr; //!< Latest command with velocities in local frame, owned by the robot control component
+        AZStd::chrono::nanoseconds m_commandTimeout{ 0 };
         AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler; //!< Handler called after every physics sub-step
         AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle; //!< Handle to the body to apply velocities to
     };
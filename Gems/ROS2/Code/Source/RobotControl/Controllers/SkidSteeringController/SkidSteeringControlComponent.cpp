@@ -37,12 +37,34 @@ namespace ROS2
 
     void SkidSteeringControlComponent::Activate()
     {
-        TwistNotificationBus::Handler::BusConnect(GetEntityId());
+        float commandTimeout = 0.0f;
+        RobotControlRequestBus::EventResult(m_commandSlot, GetEntityId(), &RobotControlRequests::GetTwistCommandSlot);
+        RobotControlRequestBus::EventResult(commandTimeout, GetEntityId(), &RobotControlRequests::GetCommandTimeout);
+        AZ_Warning("SkidSteeringControlComponent", m_commandSlot, "Robot control of entity %s is not set to Twist", GetEntity()->GetName().c_str());
+        m_commandTimeout = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::duration<float>(commandTimeout));
+        m_commandActive = false;
+        VehicleDynamics::VehicleInputControlRequestBus::Bind(m_vehicleInputBus, GetEntityId());
+
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            m_controllerHandle = controlLoop->RegisterController(
+                GetEntityId(),
+                [this](float deltaTime)
+                {
+                    Control(deltaTime);
+                });
+        }
     }
 
     void SkidSteeringControlComponent::Deactivate()
     {
-        TwistNotificationBus::Handler::BusDisconnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            controlLoop->UnregisterController(m_controllerHandle);
+        }
+        m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
+        m_vehicleInputBus = nullptr;
+        m_commandSlot = nullptr;
     }
 
     void SkidSteeringControlComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
@@ -51,12 +73,31 @@ namespace ROS2
         required.push_back(AZ_CRC_CE("SkidSteeringModelService"));
     }
 
-    void SkidSteeringControlComponent::TwistReceived(const AZ::Vector3& linear, const AZ::Vector3& angular)
+    void SkidSteeringControlComponent::Control([[maybe_unused]] float deltaTime)
     {
+        if (!m_commandSlot)
+        {
+            return;
+        }
+
+        TwistCommandStruct command;
+        AZStd::chrono::nanoseconds commandAge;
+        const bool commandFresh = m_commandSlot->Read(command, commandAge) && commandAge <= m_commandTimeout;
+        if (!commandFresh && !m_commandActive)
+        {
+            // Inputs are left untouched while there are no commands, so other sources such as manual control still work.
+            return;
+        }
+        m_commandActive = commandFresh;
+        if (!commandFresh)
+        {
+            command = TwistCommandStruct{};
+        }
+
         // Notify input system for vehicle dynamics. Only speed and steering is currently supported.
         VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetLinearSpeedV3, linear);
+            m_vehicleInputBus, &VehicleDynamics::VehicleInputControlRequests::SetTargetLinearSpeedV3, command.GetLinear());
         VehicleDynamics::VehicleInputControlRequestBus::Event(
-            GetEntityId(), &VehicleDynamics::VehicleInputControlRequests::SetTargetAngularSpeedV3, angular);
+            m_vehicleInputBus, &VehicleDynamics::VehicleInputControlRequests::SetTargetAngularSpeedV3, command.GetAngular());
     }
 } // namespace ROS2
@@ -9,7 +9,10 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
-#include <ROS2/RobotControl/Twist/TwistBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <ROS2/RobotControl/RobotControlBus.h>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
+#include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 #include <VehicleDynamics/AxleConfiguration.h>
 #include <VehicleDynamics/Utilities.h>
 
@@ -17,9 +20,8 @@ namespace ROS2
 {
 
     //! Component that contains skid steering model.
-    class SkidSteeringControlComponent
-        : public AZ::Component
-        , private TwistNotificationBus::Handler
+    //! Relays the latest Twist command to vehicle inputs at every physics substep, stopping the vehicle when commands time out.
+    class SkidSteeringControlComponent : public AZ::Component
     {
     public:
         AZ_COMPONENT(SkidSteeringControlComponent, "{7FEE7851-1284-4AE5-9C2C-763916BFE641}", AZ::Component);
@@ -33,7 +35,13 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
     private:
-        // TwistNotificationBus::Handler overrides
-        void TwistReceived(const AZ::Vector3& linear, const AZ::Vector3& angular) override;
+        //! Run by the control loop at every physics substep.
+        void Control(float deltaTime);
+
+        const TwistCommandSlot* m_commandSlot = nullptr; //!< Owned by the robot control component
+        AZStd::chrono::nanoseconds m_commandTimeout{ 0 };
+        bool m_commandActive = false; //!< Whether the latest command was fresh, to stop the vehicle once it times out
+        VehicleDynamics::VehicleInputControlRequestBus::BusPtr m_vehicleInputBus;
+        ControlLoopRequests::ControllerHandle m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
     };
 } // namespace ROS2
@@ -23,10 +23,10 @@ namespace ROS2
         switch (m_controlConfiguration.m_steering)
         {
         case ControlConfiguration::Steering::Twist:
-            m_subscriptionHandler = AZStd::make_unique<TwistSubscriptionHandler>();
+            m_subscriptionHandler = AZStd::make_unique<TwistSubscriptionHandler>(m_twistCommandSlot);
             break;
         case ControlConfiguration::Steering::Ackermann:
-            m_subscriptionHandler = AZStd::make_unique<AckermannSubscriptionHandler>();
+            m_subscriptionHandler = AZStd::make_unique<AckermannSubscriptionHandler>(m_ackermannCommandSlot);
             break;
         default:
             AZ_Error("ROS2RobotControlComponent", false, "Control type %d not implemented", m_controlConfiguration.m_steering);
@@ -37,10 +37,12 @@ namespace ROS2
         {
             m_subscriptionHandler->Activate(GetEntity(), m_subscriberConfiguration);
         }
+        RobotControlRequestBus::Handler::BusConnect(GetEntityId());
     }
 
     void ROS2RobotControlComponent::Deactivate()
     {
+        RobotControlRequestBus::Handler::BusDisconnect();
         if (m_subscriptionHandler)
         {
             m_subscriptionHandler->Deactivate();
@@ -106,6 +108,38 @@ namespace ROS2
         m_controlConfiguration = controlConfiguration;
     }
 
+    const TwistCommandSlot* ROS2RobotControlComponent::GetTwistCommandSlot() const
+    {
+        return m_controlConfiguration.m_steering == ControlConfiguration::Steering::Twist ? &m_twistCommandSlot : nullptr;
+    }
+
+    const AckermannCommandSlot* ROS2RobotControlComponent::GetAckermannCommandSlot() const
+    {
+        return m_controlConfiguration.m_steering == ControlConfiguration::Steering::Ackermann ? &m_ackermannCommandSlot : nullptr;
+    }
+
+    float ROS2RobotControlComponent::GetCommandTimeout() const
+    {
+        return m_controlConfiguration.m_commandTimeout;
+    }
+
+    float ROS2RobotControlComponent::GetCommandAge() const
+    {
+        AZStd::chrono::nanoseconds age{ 0 };
+        bool received = false;
+        if (m_controlConfiguration.m_steering == ControlConfiguration::Steering::Twist)
+        {
+            TwistCommandStruct command;
+            received = m_twistCommandSlot.Read(command, age);
+        }
+        else if (m_controlConfiguration.m_steering == ControlConfiguration::Steering::Ackermann)
+        {
+            AckermannCommandStruct command;
+            received = m_ackermannCommandSlot.Read(command, age);
+        }
+        return received ? AZStd::chrono::duration<float>(age).count() : -1.0f;
+    }
+
     void ROS2RobotControlComponent::SetSubscriberConfiguration(const TopicConfiguration& subscriberConfiguration)
     {
         m_subscriberConfiguration = subscriberConfiguration;
@@ -12,13 +12,16 @@
 #include <ROS2/Communication/TopicConfiguration.h>
 #include <ROS2/RobotControl/ControlConfiguration.h>
 #include <ROS2/RobotControl/ControlSubscriptionHandler.h>
+#include <ROS2/RobotControl/RobotControlBus.h>
 
 namespace ROS2
 {
     //! A Component responsible for controlling a robot movement.
     //! Uses IRobotControl implementation depending on type of ROS2 control message.
     //! Depends on ROS2FrameComponent. Can be configured through ControlConfiguration.
-    class ROS2RobotControlComponent : public AZ::Component
+    class ROS2RobotControlComponent
+        : public AZ::Component
+        , private RobotControlRequestBus::Handler
     {
     public:
         AZ_COMPONENT(ROS2RobotControlComponent, "{CBFB0764-99F9-40EE-9FEE-F5F5A66E59D2}", AZ::Component);
@@ -48,6 +51,16 @@ namespace ROS2
         static void Reflect(AZ::ReflectContext* context);
 
     private:
+        //////////////////////////////////////////////////////////////////////////
+        // RobotControlRequestBus::Handler overrides
+        const TwistCommandSlot* GetTwistCommandSlot() const override;
+        const AckermannCommandSlot* GetAckermannCommandSlot() const override;
+        float GetCommandTimeout() const override;
+        float GetCommandAge() const override;
+        //////////////////////////////////////////////////////////////////////////
+
+        TwistCommandSlot m_twistCommandSlot;
+        AckermannCommandSlot m_ackermannCommandSlot;
         AZStd::unique_ptr<IControlSubscriptionHandler> m_subscriptionHandler;
         ControlConfiguration m_controlConfiguration;
         TopicConfiguration m_subscriberConfiguration;
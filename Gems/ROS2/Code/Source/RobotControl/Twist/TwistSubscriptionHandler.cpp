@@ -12,10 +12,16 @@
 
 namespace ROS2
 {
-    void TwistSubscriptionHandler::SendToBus(const geometry_msgs::msg::Twist& message)
+    TwistCommandStruct TwistSubscriptionHandler::ConvertMessage(const geometry_msgs::msg::Twist& message) const
     {
-        const AZ::Vector3 linearVelocity = ROS2Conversions::FromROS2Vector3(message.linear);
-        const AZ::Vector3 angularVelocity = ROS2Conversions::FromROS2Vector3(message.angular);
-        TwistNotificationBus::Event(GetEntityId(), &TwistNotifications::TwistReceived, linearVelocity, angularVelocity);
+        TwistCommandStruct command;
+        ROS2Conversions::FromROS2Vector3(message.linear).StoreToFloat3(command.m_linear);
+        ROS2Conversions::FromROS2Vector3(message.angular).StoreToFloat3(command.m_angular);
+        return command;
+    }
+
+    void TwistSubscriptionHandler::SendToBus(const TwistCommandStruct& command)
+    {
+        TwistNotificationBus::Event(GetEntityId(), &TwistNotifications::TwistReceived, command.GetLinear(), command.GetAngular());
     }
 } // namespace ROS2
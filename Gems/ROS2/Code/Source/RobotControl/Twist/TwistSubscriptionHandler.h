@@ -8,13 +8,18 @@
 #pragma once
 
 #include <ROS2/RobotControl/ControlSubscriptionHandler.h>
+#include <ROS2/RobotControl/Twist/TwistCommandStruct.h>
 #include <geometry_msgs/msg/twist.hpp>
 
 namespace ROS2
 {
-    class TwistSubscriptionHandler : public ControlSubscriptionHandler<geometry_msgs::msg::Twist>
+    class TwistSubscriptionHandler : public ControlSubscriptionHandler<geometry_msgs::msg::Twist, TwistCommandStruct>
     {
+    public:
+        using ControlSubscriptionHandler::ControlSubscriptionHandler;
+
     private:
-        void SendToBus(const geometry_msgs::msg::Twist& message) override;
+        TwistCommandStruct ConvertMessage(const geometry_msgs::msg::Twist& message) const override;
+        void SendToBus(const TwistCommandStruct& command) override;
     };
 } // namespace ROS2
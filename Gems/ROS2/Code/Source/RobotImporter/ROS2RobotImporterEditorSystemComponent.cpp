@@ -90,10 +90,15 @@ namespace ROS2
                 return CopyHooksCallback<SDFormat::ModelPluginImporterHooksStorage>(
                     m_modelPluginHooks, classData, "ModelPluginImporterHooks");
             });
+
+        // Refresh the checksums of source assets in the background, so that they are ready when a robot is imported.
+        m_sourceAssetCrcIndex = AZStd::make_unique<Utils::SourceAssetCrcIndex>(Utils::SourceAssetCrcIndex::GetDefaultIndexFilePath());
+        m_sourceAssetCrcIndex->RequestRefresh();
     }
 
     void ROS2RobotImporterEditorSystemComponent::Deactivate()
     {
+        m_sourceAssetCrcIndex.reset();
         RobotImporterRequestBus::Handler::BusDisconnect();
         AzToolsFramework::EditorEvents::Bus::Handler::BusDisconnect();
         ROS2RobotImporterSystemComponent::Deactivate();
@@ -9,11 +9,13 @@
 #pragma once
 
 #include "ROS2RobotImporterSystemComponent.h"
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <ROS2/RobotImporter/RobotImporterBus.h>
 #include <ROS2/RobotImporter/SDFormatModelPluginImporterHook.h>
 #include <ROS2/RobotImporter/SDFormatSensorImporterHook.h>
+#include <RobotImporter/Utils/SourceAssetCrcIndex.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 namespace ROS2
 {
@@ -80,5 +82,8 @@ namespace ROS2
 
         // Cache for storing model plugin importer hooks (read only once)
         SDFormat::ModelPluginImporterHooksStorage m_modelPluginHooks;
+
+        // Checksums of source assets, matched with meshes and textures of imported robots
+        AZStd::unique_ptr<Utils::SourceAssetCrcIndex> m_sourceAssetCrcIndex;
     };
 } // namespace ROS2
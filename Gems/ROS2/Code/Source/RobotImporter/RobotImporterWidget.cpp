@@ -347,6 +347,8 @@ namespace ROS2
             {
                 m_urdfAssetsMapping = AZStd::make_shared<Utils::UrdfAssetMap>(
                     Utils::FindReferencedAssets(m_assetNames, m_urdfPath.String(), sdfBuilderSettings));
+                // Collect the products of every mesh first, so that each scene is loaded once and released after its manifest.
+                AZStd::unordered_map<AZ::IO::Path, AZStd::pair<bool, bool>> meshProducts;
                 for (const auto& [assetPath, assetReferenceType] : m_assetNames)
                 {
                     if (m_urdfAssetsMapping->contains(assetPath))
@@ -356,12 +358,23 @@ namespace ROS2
                             (assetReferenceType & Utils::ReferencedAssetType::VisualMesh) == Utils::ReferencedAssetType::VisualMesh;
                         bool collider =
                             (assetReferenceType & Utils::ReferencedAssetType::ColliderMesh) == Utils::ReferencedAssetType::ColliderMesh;
-                        if (visual || collider)
+                        const auto& sourceAssetPath = asset.m_availableAssetInfo.m_sourceAssetGlobalPath;
+                        if ((visual || collider) && !sourceAssetPath.empty())
                         {
-                            Utils::CreateSceneManifest(asset.m_availableAssetInfo.m_sourceAssetGlobalPath, collider, visual);
+                            auto& [needsCollider, needsVisual] = meshProducts[sourceAssetPath];
+                            needsCollider = needsCollider || collider;
+                            needsVisual = needsVisual || visual;
                         }
                     }
                 }
+
+                Utils::MeshSceneCache meshSceneCache;
+                for (const auto& [sourceAssetPath, products] : meshProducts)
+                {
+                    meshSceneCache.CreateSceneManifest(
+                        sourceAssetPath, sourceAssetPath.Native() + ".assetinfo", products.first, products.second);
+                    meshSceneCache.ReleaseScene(sourceAssetPath);
+                }
             };
 
             for (auto& [unresolvedFileName, urdfAsset] : *m_urdfAssetsMapping)
@@ -407,6 +420,7 @@ namespace ROS2
                             return;
                         }
                         AZStd::unordered_map<AZ::IO::Path, unsigned int> duplicatedFilenames;
+                        Utils::MeshSceneCache meshSceneCache;
                         for (auto& [unresolvedFileName, urdfAsset] : *m_urdfAssetsMapping)
                         {
                             if (duplicatedFilenames.contains(unresolvedFileName))
@@ -423,7 +437,12 @@ namespace ROS2
                                     Utils::CopyStatus::Copying, AZStd::string(unresolvedFileName.c_str()), "");
                             }
                             auto copyStatus = Utils::CopyReferencedAsset(
-                                unresolvedFileName, destStatus.GetValue(), urdfAsset, duplicatedFilenames[unresolvedFileName]);
+                                unresolvedFileName,
+                                destStatus.GetValue(),
+                                urdfAsset,
+                                duplicatedFilenames[unresolvedFileName],
+                                AZ::IO::FileIOBase::GetInstance(),
+                                &meshSceneCache);
 
                             m_assetPage->OnAssetCopyStatusChanged(
                                 copyStatus,
@@ -114,7 +114,7 @@ namespace ROS2
     }
 
     ArticulationsMaker::ArticulationsMakerResult ArticulationsMaker::AddArticulationLink(
-        const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId) const
+        const Utils::SdfTopologyIndex& topologyIndex, const sdf::Link* link, AZ::EntityId entityId) const
     {
         AZ::Entity* entity = AzToolsFramework::GetEntityById(entityId);
         if (entity == nullptr)
@@ -128,11 +128,9 @@ namespace ROS2
 
         articulationLinkConfiguration = AddToArticulationConfig(articulationLinkConfiguration, link->Inertial());
 
-        constexpr bool getNestedModelJoints = true;
-        AZStd::string linkName(link->Name().c_str(), link->Name().size());
-        for (const sdf::Joint* joint : Utils::GetJointsForChildLink(model, linkName, getNestedModelJoints))
+        const bool isWheelEntity = Utils::IsWheelURDFHeuristics(topologyIndex, link);
+        for (const sdf::Joint* joint : topologyIndex.GetJointsForChildLink(*link))
         {
-            const bool isWheelEntity = Utils::IsWheelURDFHeuristics(model, link);
             articulationLinkConfiguration = AddToArticulationConfig(articulationLinkConfiguration, joint, isWheelEntity);
         }
 
@@ -12,6 +12,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <PhysX/ArticulationTypes.h>
+#include <RobotImporter/Utils/SdfTopologyIndex.h>
 
 namespace ROS2
 {
@@ -22,11 +23,12 @@ namespace ROS2
         using ArticulationsMakerResult = AZ::Outcome<AZ::ComponentId, AZStd::string>;
 
         //! Add zero or one inertial and joints elements to a given entity (depending on link content).
-        //! @param model SDF model object which can be queried to locate the joints needed to determine if the supplied
-        //!              link is a child link within a joint
+        //! @param topologyIndex index of the SDF document which is queried to locate the joints needed to determine if the supplied
+        //!                      link is a child link within a joint
         //! @param link A pointer to a parsed SDF link.
         //! @param entityId A non-active entity which will be populated according to inertial content.
         //! @returns created components Id or string with fail
-        ArticulationsMakerResult AddArticulationLink(const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId) const;
+        ArticulationsMakerResult AddArticulationLink(
+            const Utils::SdfTopologyIndex& topologyIndex, const sdf::Link* link, AZ::EntityId entityId) const;
     };
 } // namespace ROS2
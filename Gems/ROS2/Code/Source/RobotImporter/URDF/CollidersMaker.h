@@ -20,6 +20,7 @@
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialId.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialManager.h>
+#include <RobotImporter/Utils/SdfTopologyIndex.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 
 namespace ROS2
@@ -38,10 +39,10 @@ namespace ROS2
         CollidersMaker(const CollidersMaker& other) = delete;
 
         //! Add zero, one or many collider elements (depending on link content).
-        //! @param model An SDF model object provided by libsdformat from a parsed URDF/SDF
+        //! @param topologyIndex index of the SDF document provided by libsdformat from a parsed URDF/SDF
         //! @param link A parsed SDF tree link node which could hold information about colliders.
         //! @param entityId A non-active entity which will be affected.
-        void AddColliders(const sdf::Model& model, const sdf::Link* link, AZ::EntityId entityId);
+        void AddColliders(const Utils::SdfTopologyIndex& topologyIndex, const sdf::Link* link, AZ::EntityId entityId);
         //! Sends meshes required for colliders to asset processor.
         //! @param buildReadyCb Function to call when the processing finishes.
         void ProcessMeshes(BuildReadyCallback notifyBuildReadyCb);
@@ -56,127 +56,21 @@ namespace ROS2
         {
             AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
             m_status.clear();
-            m_articulationsCounter = 0u;
+            m_stageTimes.clear();
         }
+        m_pendingStatus.clear();
+        m_pendingStageTimes.clear();
+        m_articulationsCounter = 0u;
+        m_stageStartTime = AZStd::chrono::steady_clock::now();
 
-        if (!ContainsModel())
+        // Index all models, links and joints of the SDF once, including nested models and models of worlds.
+        // The index answers the link and joint queries below without visiting the document again.
+        const Utils::SdfTopologyIndex topologyIndex(*m_root);
+        if (topologyIndex.GetModels().empty())
         {
             return AZ::Failure(AZStd::string("URDF/SDF doesn't contain any models."));
         }
-
-        // Visit any nested models in the SDF as well
-        constexpr bool visitNestedModels = true;
-
-        // Maintains references to all joints and a mapping from the joints to their parent and child links
-        struct JointsMapper
-        {
-            struct JointToAttachedModel
-            {
-                AZStd::string m_fullyQualifiedName;
-                const sdf::Joint* m_joint{};
-                const sdf::Model* m_attachedModel{};
-            };
-            // this is a unique ordered vector
-            AZStd::vector<JointToAttachedModel> m_joints;
-            AZStd::unordered_map<const sdf::Joint*, const sdf::Link*> m_jointToParentLinks;
-            AZStd::unordered_map<const sdf::Joint*, const sdf::Link*> m_jointToChildLinks;
-        };
-        JointsMapper jointsMapper;
-        auto GetAllJointsFromModel = [&jointsMapper](const sdf::Model& model, const Utils::ModelStack&) -> Utils::VisitModelResponse
-        {
-            // As the VisitModels function visits nested models by default, gatherNestedModelJoints is set to false
-            constexpr bool gatherNestedModelJoints = false;
-            auto jointsForModel = Utils::GetAllJoints(model, gatherNestedModelJoints);
-            for (const auto& [fullyQualifiedName, joint] : jointsForModel)
-            {
-                JointsMapper::JointToAttachedModel jointToAttachedModel{
-                    AZStd::string(fullyQualifiedName.c_str(), fullyQualifiedName.size()), joint, &model
-                };
-                jointsMapper.m_joints.push_back(AZStd::move(jointToAttachedModel));
-
-                // add mapping from joint to child link
-                std::string childName = joint->ChildName();
-                if (const sdf::Link* link = model.LinkByName(childName); link != nullptr)
-                {
-                    // Add a mapping of joint to child link
-                    jointsMapper.m_jointToChildLinks[joint] = link;
-                }
-
-                // add mapping from joint to parent link
-                std::string parentName = joint->ParentName();
-                if (const sdf::Link* link = model.LinkByName(parentName); link != nullptr)
-                {
-                    jointsMapper.m_jointToParentLinks[joint] = link;
-                }
-            }
-
-            return Utils::VisitModelResponse::VisitNestedAndSiblings;
-        };
-        // Gather all Joints in SDF including in nested models
-        Utils::VisitModels(*m_root, GetAllJointsFromModel, visitNestedModels);
-
-        // Maintains references to all Links in the SDF and a mapping of links to the model it is attached to
-        struct LinksMapper
-        {
-            struct LinkToAttachedModel
-            {
-                AZStd::string m_fullyQualifiedName;
-                const sdf::Link* m_link{};
-                const sdf::Model* m_attachedModel{};
-            };
-            // this is a unique ordered vector
-            AZStd::vector<LinkToAttachedModel> m_links;
-        };
-        LinksMapper linksMapper;
-
-        struct ModelMapper
-        {
-            struct NestedModelToAttachedModel
-            {
-                AZStd::string m_fullyQualifiedName;
-                const sdf::Model* m_nestedModel{};
-                const sdf::Model* m_attachedModel{};
-            };
-            // this is a unique ordered vector
-            AZStd::vector<NestedModelToAttachedModel> m_models;
-        };
-        ModelMapper modelMapper;
-
-        auto GetAllLinksAndSetModelHierarchy =
-            [&linksMapper, &modelMapper](const sdf::Model& model, const Utils::ModelStack& modelStack) -> Utils::VisitModelResponse
-        {
-            // As the VisitModels function visits nested models by default, gatherNestedModelLinks is set to false
-            constexpr bool gatherNestedModelLinks = false;
-            auto linksForModel = Utils::GetAllLinks(model, gatherNestedModelLinks);
-            for (const auto& [fullyQualifiedName, link] : linksForModel)
-            {
-                // Push back the mapping of link to attached model into the ordered vector
-                AZStd::string fullLinkName(fullyQualifiedName.c_str(), fullyQualifiedName.size());
-                LinksMapper::LinkToAttachedModel linkToAttachedModel{ AZStd::move(fullLinkName), link, &model };
-                linksMapper.m_links.push_back(AZStd::move(linkToAttachedModel));
-            }
-
-            // Use the model stack to create a mapping from the current model
-            // to the parent model it is attached to.
-            // If the current model has no parent model the attached model is set to nullptr
-            std::string stdFullModelName;
-            for (const sdf::Model& ancestorModel : modelStack)
-            {
-                stdFullModelName = sdf::JoinName(stdFullModelName, ancestorModel.Name());
-            }
-            stdFullModelName = sdf::JoinName(stdFullModelName, model.Name());
-            AZStd::string fullModelName(stdFullModelName.c_str(), stdFullModelName.size());
-            ModelMapper::NestedModelToAttachedModel nestedModelToAttachedModel;
-            nestedModelToAttachedModel.m_fullyQualifiedName = AZStd::move(fullModelName);
-            nestedModelToAttachedModel.m_nestedModel = &model;
-            nestedModelToAttachedModel.m_attachedModel = !modelStack.empty() ? &modelStack.back().get() : nullptr;
-            modelMapper.m_models.push_back(AZStd::move(nestedModelToAttachedModel));
-
-            return Utils::VisitModelResponse::VisitNestedAndSiblings;
-        };
-
-        // Gather all links and add a mapping of nested model -> parent model for each model in the SDF
-        Utils::VisitModels(*m_root, GetAllLinksAndSetModelHierarchy, visitNestedModels);
+        FinishStage("Index SDF topology");
 
         // Build up a list of all entities created as a part of processing the file.
         AZStd::vector<AZ::EntityId> createdEntities;
@@ -186,7 +80,7 @@ namespace ROS2
         AZStd::unordered_map<AZStd::string, const sdf::Link*> links;
 
         // Create an entity for each model
-        for ([[maybe_unused]] const auto& [fullModelName, modelPtr, _] : modelMapper.m_models)
+        for ([[maybe_unused]] const auto& [fullModelName, modelPtr, _] : topologyIndex.GetModels())
         {
             // Create entities for each model in the SDF
             const std::string modelName = modelPtr->Name();
@@ -199,22 +93,20 @@ namespace ROS2
                 createdEntities.emplace_back(createdModelEntityId);
                 createdModels.emplace(modelPtr, createModelEntityResult);
 
-                AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-                m_status.emplace(
+                AddStatus(
                     StatusMessageType::Model,
                     AZStd::string::format("%s created as: %s", azModelName.c_str(), createdModelEntityId.ToString().c_str()));
             }
             else
             {
-                AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-                m_status.emplace(
+                AddStatus(
                     StatusMessageType::Model,
                     AZStd::string::format("%s failed: %s", azModelName.c_str(), createModelEntityResult.GetError().c_str()));
             }
         }
 
         //! Setup the parent hierarchy for the nested models
-        for ([[maybe_unused]] const auto& [_, modelPtr, parentModelPtr] : modelMapper.m_models)
+        for ([[maybe_unused]] const auto& [_, modelPtr, parentModelPtr] : topologyIndex.GetModels())
         {
             // If there is no parent model, then the model would be at the top level of the hierarchy
             if (parentModelPtr == nullptr || modelPtr == nullptr)
@@ -243,9 +135,10 @@ namespace ROS2
                 PrefabMakerUtils::SetEntityParentRelative(modelEntityId, parentModelEntityId);
             }
         }
+        FinishStage("Create model entities");
 
         // Create an entity for each link and set the parent to be the model entity where the link is attached
-        for ([[maybe_unused]] const auto& [_, linkPtr, attachedModel] : linksMapper.m_links)
+        for ([[maybe_unused]] const auto& [_, linkPtr, attachedModel] : topologyIndex.GetLinks())
         {
             AZ::EntityId modelEntityId;
             if (attachedModel != nullptr)
@@ -259,8 +152,9 @@ namespace ROS2
                 }
             }
             // Add all link as children of their attached model entity by default
-            createdLinks[linkPtr] = AddEntitiesForLink(*linkPtr, attachedModel, modelEntityId, createdEntities);
+            createdLinks[linkPtr] = AddEntitiesForLink(*linkPtr, attachedModel, topologyIndex, modelEntityId, createdEntities);
         }
+        FinishStage("Create link entities");
 
         for (const auto& [linkPtr, result] : createdLinks)
         {
@@ -271,22 +165,21 @@ namespace ROS2
                 "Link with name %s was created as: %s\n",
                 linkName.c_str(),
                 result.IsSuccess() ? (result.GetValue().ToString().c_str()) : ("[Failed]"));
-            AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
             if (result.IsSuccess())
             {
-                m_status.emplace(
+                AddStatus(
                     StatusMessageType::Link,
                     AZStd::string::format("%s created as: %s", azLinkName.c_str(), result.GetValue().ToString().c_str()));
             }
             else
             {
-                m_status.emplace(
+                AddStatus(
                     StatusMessageType::Link, AZStd::string::format("%s failed : %s", azLinkName.c_str(), result.GetError().c_str()));
             }
         }
 
         // Set the transforms of links
-        for ([[maybe_unused]] const auto& [fullLinkName, linkPtr, _] : linksMapper.m_links)
+        for ([[maybe_unused]] const auto& [fullLinkName, linkPtr, _] : topologyIndex.GetLinks())
         {
             if (const auto createLinkEntityResult = createdLinks.at(linkPtr); createLinkEntityResult.IsSuccess())
             {
@@ -325,12 +218,14 @@ namespace ROS2
             }
         }
 
-        // Set the hierarchy
+        FinishStage("Set link transforms");
+
+        // Set the hierarchy, visiting parent links before their children
         AZStd::vector<AZStd::pair<AZ::EntityId, const sdf::Model*>> linkEntityIdsWithoutParent;
-        for (const auto& [fullLinkName, linkPtr, attachedModel] : linksMapper.m_links)
+        for (const sdf::Link* linkPtr : topologyIndex.GetLinksInTopologicalOrder())
         {
+            [[maybe_unused]] const auto& [fullLinkName, _, attachedModel] = *topologyIndex.FindLink(*linkPtr);
             std::string linkName = linkPtr->Name();
-            AZStd::string azLinkName(linkName.c_str(), linkName.size());
             const auto linkPrefabResult = createdLinks.at(linkPtr);
             if (!linkPrefabResult.IsSuccess())
             {
@@ -338,9 +233,7 @@ namespace ROS2
                 continue;
             }
 
-            AZStd::vector<const sdf::Joint*> jointsWhereLinkIsChild;
-            bool gatherNestedModelJoints = true;
-            jointsWhereLinkIsChild = Utils::GetJointsForChildLink(*attachedModel, azLinkName, gatherNestedModelJoints);
+            const AZStd::vector<const sdf::Joint*>& jointsWhereLinkIsChild = topologyIndex.GetJointsForChildLink(*linkPtr);
 
             if (jointsWhereLinkIsChild.empty())
             {
@@ -377,11 +270,9 @@ namespace ROS2
             std::string parentLinkName = joint->ParentName();
             AZStd::string parentName(parentLinkName.c_str(), parentLinkName.size());
 
-            // Lookup the entity created from the parent link using the JointMapper to locate the parent SDF link.
+            // Lookup the entity created from the parent link using the topology index to locate the parent SDF link.
             // followed by using SDF link address to lookup the O3DE created entity ID
-            auto parentLinkIter = jointsMapper.m_jointToParentLinks.find(joint);
-            auto parentEntityIter =
-                parentLinkIter != jointsMapper.m_jointToParentLinks.end() ? createdLinks.find(parentLinkIter->second) : createdLinks.end();
+            auto parentEntityIter = createdLinks.find(topologyIndex.FindJoint(*joint)->m_parentLink);
             if (parentEntityIter == createdLinks.end())
             {
                 AZ_Trace("CreatePrefabFromUrdfOrSdf", "Link %s has invalid parent name %s\n", linkName.c_str(), parentName.c_str());
@@ -407,9 +298,10 @@ namespace ROS2
             // therefore SetEntityParent is used to maintain the world transform of the child link
             PrefabMakerUtils::SetEntityParent(linkPrefabResult.GetValue(), parentEntityIter->second.GetValue());
         }
+        FinishStage("Set link hierarchy");
 
         // Iterate over all the joints and locate the entity associated with the link
-        for ([[maybe_unused]] const auto& [fullJointName, jointPtr, _] : jointsMapper.m_joints)
+        for ([[maybe_unused]] const auto& [fullJointName, jointPtr, _, parentLinkPtr, childLinkPtr] : topologyIndex.GetJoints())
         {
             std::string jointName = jointPtr->Name();
             AZStd::string azJointName(jointName.c_str(), jointName.size());
@@ -418,9 +310,7 @@ namespace ROS2
 
             // Look up the O3DE created entity by first locating the parent SDF link associated with the current joint
             // and then using that SDF link to lookup the created entity
-            auto parentLinkIter = jointsMapper.m_jointToParentLinks.find(jointPtr);
-            auto parentEntityIter =
-                parentLinkIter != jointsMapper.m_jointToParentLinks.end() ? createdLinks.find(parentLinkIter->second) : createdLinks.end();
+            auto parentEntityIter = createdLinks.find(parentLinkPtr);
             if (parentEntityIter == createdLinks.end())
             {
                 AZ_Warning(
@@ -434,9 +324,7 @@ namespace ROS2
             auto leadEntity = parentEntityIter->second;
 
             // Use the joint to lookup the child SDF link which is used to look up the O3DE entity
-            auto childLinkIter = jointsMapper.m_jointToChildLinks.find(jointPtr);
-            auto childEntityIter =
-                childLinkIter != jointsMapper.m_jointToChildLinks.end() ? createdLinks.find(childLinkIter->second) : createdLinks.end();
+            auto childEntityIter = createdLinks.find(childLinkPtr);
             if (childEntityIter == createdLinks.end())
             {
                 AZ_Warning(
@@ -456,30 +344,21 @@ namespace ROS2
                 parentLinkName.c_str(),
                 childLinkName.c_str());
 
-            AZ::Entity* childEntityPtr = AzToolsFramework::GetEntityById(childEntity.GetValue());
-            if (childEntityPtr)
-            {
-                auto* component = childEntityPtr->FindComponent<ROS2FrameEditorComponent>();
-                if (component)
-                {
-                    component->SetJointName(azJointName);
-                }
-            }
+            // The joint name of the frame component of the child link was set when the link entity was created.
             // check if both has RigidBody and we are not creating articulation
             if (!m_useArticulations)
             {
                 if (leadEntity.IsSuccess() && childEntity.IsSuccess())
                 {
-                    AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
                     auto result = m_jointsMaker.AddJointComponent(jointPtr, childEntity.GetValue(), leadEntity.GetValue());
                     if (result.IsSuccess())
                     {
-                        m_status.emplace(
+                        AddStatus(
                             StatusMessageType::Joint, AZStd::string::format("%s created as: %llu", azJointName.c_str(), result.GetValue()));
                     }
                     else
                     {
-                        m_status.emplace(
+                        AddStatus(
                             StatusMessageType::Joint,
                             AZStd::string::format("%s failed : %s", azJointName.c_str(), result.GetError().c_str()));
                     }
@@ -491,6 +370,8 @@ namespace ROS2
             }
         }
 
+        FinishStage("Create joints");
+
         // Add control components to links that are not parented to any other link (first link of each model) based on SDFormat data.
         if (!linkEntityIdsWithoutParent.empty())
         {
@@ -503,20 +384,19 @@ namespace ROS2
             }
         }
 
+        FinishStage("Add model plugins");
+
         // Get the remaining log information (sensors, plugins)
+        const auto& modelPluginStatus = m_controlMaker.GetStatusMessages();
+        for (const auto& mps : modelPluginStatus)
         {
-            AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-            const auto& modelPluginStatus = m_controlMaker.GetStatusMessages();
-            for (const auto& mps : modelPluginStatus)
-            {
-                m_status.emplace(StatusMessageType::ModelPlugin, mps);
-            }
+            AddStatus(StatusMessageType::ModelPlugin, mps);
+        }
 
-            const auto& sensorStatus = m_sensorsMaker.GetStatusMessages();
-            for (const auto& ss : sensorStatus)
-            {
-                m_status.emplace(StatusMessageType::Sensor, ss);
-            }
+        const auto& sensorStatus = m_sensorsMaker.GetStatusMessages();
+        for (const auto& ss : sensorStatus)
+        {
+            AddStatus(StatusMessageType::Sensor, ss);
         }
 
         // Create prefab, save it to disk immediately
@@ -543,6 +423,9 @@ namespace ROS2
             createdEntities,
             relativePath.String());
 
+        FinishStage("Create prefab template");
+        PublishStatus();
+
         if (prefabTemplateId == AzToolsFramework::Prefab::InvalidTemplateId)
         {
             AZ_Error("CreatePrefabFromUrdfOrSdf", false, "Could not create a prefab template for entities.");
@@ -580,9 +463,11 @@ namespace ROS2
 
         auto prefabLoaderInterface = AZ::Interface<AzToolsFramework::Prefab::PrefabLoaderInterface>::Get();
 
+        // The prefab template holds all created entities, it is saved and instantiated into the level once.
         // Save Template to file
         auto relativePath = prefabLoaderInterface->GenerateRelativePath(m_prefabPath.c_str());
         bool saveResult = prefabLoaderInterface->SaveTemplateToFile(result.GetValue(), m_prefabPath.c_str());
+        FinishStage("Save prefab");
         if (saveResult)
         {
             // If the template saved successfully, also instantiate it into the level.
@@ -593,6 +478,7 @@ namespace ROS2
             {
                 MoveEntityToDefaultSpawnPoint(createPrefabOutcome.GetValue(), m_spawnPosition);
             }
+            FinishStage("Instantiate prefab");
         }
         else
         {
@@ -605,6 +491,7 @@ namespace ROS2
             AzToolsFramework::ToolsApplicationRequests::Bus::Broadcast(
                 &AzToolsFramework::ToolsApplicationRequests::Bus::Events::EndUndoBatch);
         }
+        PublishStatus();
 
         return result;
     }
@@ -638,7 +525,11 @@ namespace ROS2
     }
 
     AzToolsFramework::Prefab::PrefabEntityResult URDFPrefabMaker::AddEntitiesForLink(
-        const sdf::Link& link, const sdf::Model* attachedModel, AZ::EntityId parentEntityId, AZStd::vector<AZ::EntityId>& createdEntities)
+        const sdf::Link& link,
+        const sdf::Model* attachedModel,
+        const Utils::SdfTopologyIndex& topologyIndex,
+        AZ::EntityId parentEntityId,
+        AZStd::vector<AZ::EntityId>& createdEntities)
     {
         auto createEntityResult = PrefabMakerUtils::CreateEntity(parentEntityId, link.Name().c_str());
         if (!createEntityResult.IsSuccess())
@@ -650,13 +541,18 @@ namespace ROS2
 
         createdEntities.emplace_back(entityId);
 
-        const auto frameComponentId = Utils::CreateComponent(entityId, ROS2FrameEditorComponent::TYPEINFO_Uuid());
-        if (frameComponentId)
+        // The entity is not active yet, so the frame component is created on it directly, with its final configuration,
+        // instead of going through the entity composition requests of the editor for every link.
+        ROS2FrameConfiguration frameConfiguration;
+        frameConfiguration.m_frameName = AZStd::string(link.Name().c_str(), link.Name().size());
+        if (const auto& jointsWhereLinkIsChild = topologyIndex.GetJointsForChildLink(link); !jointsWhereLinkIsChild.empty())
         {
-            auto* component = entity->FindComponent<ROS2FrameEditorComponent>();
-            AZ_Assert(component, "ROS2 Frame Component does not exist for %s", entityId.ToString().c_str());
-            component->SetFrameID(AZStd::string(link.Name().c_str(), link.Name().size()));
+            // Same joint as the last one visited for this child link when joints are created
+            const std::string& jointName = jointsWhereLinkIsChild.back()->Name();
+            frameConfiguration.m_jointName = AZStd::string(jointName.c_str(), jointName.size());
         }
+        [[maybe_unused]] auto* frameComponent = entity->CreateComponent<ROS2FrameEditorComponent>(frameConfiguration);
+        AZ_Assert(frameComponent, "ROS2 Frame Component could not be created for %s", entityId.ToString().c_str());
         auto createdVisualEntities = m_visualsMaker.AddVisuals(&link, entityId);
         createdEntities.insert(createdEntities.end(), createdVisualEntities.begin(), createdVisualEntities.end());
 
@@ -668,21 +564,19 @@ namespace ROS2
         {
             if (attachedModel != nullptr)
             {
-                const auto linkResult = m_articulationsMaker.AddArticulationLink(*attachedModel, &link, entityId);
+                const auto linkResult = m_articulationsMaker.AddArticulationLink(topologyIndex, &link, entityId);
                 std::string linkName = link.Name();
                 AZStd::string azLinkName(linkName.c_str(), linkName.size());
                 if (linkResult.IsSuccess())
                 {
-                    AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-                    m_status.emplace(
+                    AddStatus(
                         StatusMessageType::Joint,
                         AZStd::string::format("%s created as articulation link: %llu", azLinkName.c_str(), linkResult.GetValue()));
                     m_articulationsCounter++;
                 }
                 else
                 {
-                    AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
-                    m_status.emplace(
+                    AddStatus(
                         StatusMessageType::Joint,
                         AZStd::string::format("%s as articulation link failed: %s", azLinkName.c_str(), linkResult.GetError().c_str()));
                 }
@@ -691,7 +585,7 @@ namespace ROS2
 
         if (attachedModel != nullptr)
         {
-            m_collidersMaker.AddColliders(*attachedModel, &link, entityId);
+            m_collidersMaker.AddColliders(topologyIndex, &link, entityId);
             auto createdSensorEntities = m_sensorsMaker.AddSensors(*attachedModel, &link, entityId);
             createdEntities.insert(createdEntities.end(), createdSensorEntities.begin(), createdSensorEntities.end());
         }
@@ -726,6 +620,40 @@ namespace ROS2
         }
     }
 
+    void URDFPrefabMaker::AddStatus(StatusMessageType type, AZStd::string message)
+    {
+        m_pendingStatus.emplace_back(type, AZStd::move(message));
+    }
+
+    void URDFPrefabMaker::FinishStage(const char* stageName)
+    {
+        const auto now = AZStd::chrono::steady_clock::now();
+        m_pendingStageTimes.emplace_back(stageName, AZStd::chrono::duration<double, AZStd::milli>(now - m_stageStartTime).count());
+        m_stageStartTime = now;
+    }
+
+    void URDFPrefabMaker::PublishStatus()
+    {
+        AZStd::string stageTimes;
+        for (const auto& [stageName, milliseconds] : m_pendingStageTimes)
+        {
+            stageTimes += AZStd::string::format(" %s: %.1f ms;", stageName.c_str(), milliseconds);
+        }
+        if (!stageTimes.empty())
+        {
+            AZ_Info("CreatePrefabFromUrdfOrSdf", "Import stages of %s:%s\n", m_prefabPath.c_str(), stageTimes.c_str());
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lck(m_statusLock);
+        for (auto& [type, message] : m_pendingStatus)
+        {
+            m_status.emplace(type, AZStd::move(message));
+        }
+        m_stageTimes.insert(m_stageTimes.end(), m_pendingStageTimes.begin(), m_pendingStageTimes.end());
+        m_pendingStatus.clear();
+        m_pendingStageTimes.clear();
+    }
+
     AZStd::string URDFPrefabMaker::GetStatus()
     {
         AZStd::string report;
@@ -733,9 +661,9 @@ namespace ROS2
 
         // Print warnings first
         constexpr unsigned int articulationsLimit = 64;
-        if (m_articulationsCounter >= articulationsLimit)
+        if (const unsigned int articulationsCounter = m_articulationsCounter; articulationsCounter >= articulationsLimit)
         {
-            report += "\n## 💡 Note: the number of articulations (" + AZStd::to_string(m_articulationsCounter) +
+            report += "\n## 💡 Note: the number of articulations (" + AZStd::to_string(articulationsCounter) +
                 ") might not be supported by the physics engine.\n";
         }
 
@@ -763,19 +691,15 @@ namespace ROS2
                 }
             } while (it->first == key);
         }
-        return report;
-    }
 
-    bool URDFPrefabMaker::ContainsModel() const
-    {
-        const sdf::Model* sdfModel{};
-        auto GetModelAndStopIteration = [&sdfModel](const sdf::Model& model, const Utils::ModelStack&) -> Utils::VisitModelResponse
-        {
-            sdfModel = &model;
-            // Return stop to prevent further visitation of additional models
-            return Utils::VisitModelResponse::Stop;
-        };
-        Utils::VisitModels(*m_root, GetModelAndStopIteration);
-        return sdfModel != nullptr;
+        if (!m_stageTimes.empty())
+        {
+            report += "\n## Import time:\n";
+            for (const auto& [stageName, milliseconds] : m_stageTimes)
+            {
+                report += AZStd::string::format("- %s: %.1f ms\n", stageName.c_str(), milliseconds);
+            }
+        }
+        return report;
     }
 } // namespace ROS2
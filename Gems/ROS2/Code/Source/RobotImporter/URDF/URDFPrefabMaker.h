@@ -18,12 +18,16 @@
 #include "VisualsMaker.h"
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 #include <AzToolsFramework/Prefab/PrefabPublicInterface.h>
+#include <RobotImporter/Utils/SdfTopologyIndex.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 #include <optional>
 
@@ -67,7 +71,7 @@ namespace ROS2
         const AZStd::string& GetPrefabPath() const;
 
         //! Get descriptive status of import.
-        //! A string with the status in Markdown format.
+        //! A string with the status in Markdown format, including the time taken by each stage of the import.
         AZStd::string GetStatus();
 
     private:
@@ -75,13 +79,11 @@ namespace ROS2
         AzToolsFramework::Prefab::PrefabEntityResult AddEntitiesForLink(
             const sdf::Link& link,
             const sdf::Model* attachedModel,
+            const Utils::SdfTopologyIndex& topologyIndex,
             AZ::EntityId parentEntityId,
             AZStd::vector<AZ::EntityId>& createdEntities);
         static void MoveEntityToDefaultSpawnPoint(const AZ::EntityId& rootEntityId, AZStd::optional<AZ::Transform> spawnPosition);
 
-        // Returns if SDF document contains any model objects, be that at the root or within an <world> tag
-        bool ContainsModel() const;
-
         const sdf::Root* m_root;
         AZStd::string m_prefabPath;
         VisualsMaker m_visualsMaker;
@@ -102,9 +104,25 @@ namespace ROS2
             SensorPlugin,
             ModelPlugin
         };
+
+        //! Add a status message of the import in progress.
+        //! Messages are only collected by the importing thread, and become visible in GetStatus once published.
+        void AddStatus(StatusMessageType type, AZStd::string message);
+
+        //! Record the time since the previous stage of the import finished.
+        void FinishStage(const char* stageName);
+
+        //! Make status messages and stage times collected so far visible in GetStatus.
+        void PublishStatus();
+
+        AZStd::vector<AZStd::pair<StatusMessageType, AZStd::string>> m_pendingStatus; //!< Only accessed by the importing thread
+        AZStd::vector<AZStd::pair<AZStd::string, double>> m_pendingStageTimes; //!< Only accessed by the importing thread
+        AZStd::chrono::steady_clock::time_point m_stageStartTime;
+
         AZStd::mutex m_statusLock;
-        AZStd::multimap<StatusMessageType, AZStd::string> m_status;
-        unsigned int m_articulationsCounter{ 0u };
+        AZStd::multimap<StatusMessageType, AZStd::string> m_status; //!< Guarded by m_statusLock
+        AZStd::vector<AZStd::pair<AZStd::string, double>> m_stageTimes; //!< Stage names with milliseconds, guarded by m_statusLock
+        AZStd::atomic_uint m_articulationsCounter{ 0u };
 
         AZStd::shared_ptr<Utils::UrdfAssetMap> m_urdfAssetsMapping;
         bool m_useArticulations{ false };
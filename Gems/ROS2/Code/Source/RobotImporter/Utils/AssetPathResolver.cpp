@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "AssetPathResolver.h"
+#include "RobotImporterUtils.h"
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace ROS2::Utils
+{
+    namespace
+    {
+        //! Key of everything besides the reference itself that affects its resolution.
+        AZStd::string GetContextKey(
+            const AZ::IO::PathView& baseFilePath, AZStd::string_view amentPrefixPath, const SdfAssetBuilderSettings& settings)
+        {
+            const auto& resolverSettings = settings.m_resolverSettings;
+            AZStd::string key = AZStd::string::format(
+                "%d%d|%.*s|%.*s",
+                resolverSettings.m_useAmentPrefixPath ? 1 : 0,
+                resolverSettings.m_useAncestorPaths ? 1 : 0,
+                AZ_STRING_ARG(amentPrefixPath),
+                AZ_PATH_ARG(baseFilePath.ParentPath()));
+
+            // The prefix map is unordered, sort the prefixes so that equal settings give equal keys.
+            AZStd::vector<AZStd::string_view> prefixes;
+            prefixes.reserve(resolverSettings.m_uriPrefixMap.size());
+            for (const auto& [prefix, replacements] : resolverSettings.m_uriPrefixMap)
+            {
+                prefixes.push_back(prefix);
+            }
+            AZStd::sort(prefixes.begin(), prefixes.end());
+            for (const auto& prefix : prefixes)
+            {
+                key.append("|").append(prefix);
+                for (const auto& replacement : resolverSettings.m_uriPrefixMap.at(AZStd::string(prefix)))
+                {
+                    key.append(">").append(replacement);
+                }
+            }
+            return key;
+        }
+    } // namespace
+
+    AssetPathResolver& AssetPathResolver::Get()
+    {
+        static AssetPathResolver resolver;
+        return resolver;
+    }
+
+    ResolvedAssetPaths AssetPathResolver::ResolveAssetPaths(
+        const AssetFilenameReferences& assetFilenames,
+        const AZ::IO::PathView& baseFilePath,
+        AZStd::string_view amentPrefixPath,
+        const SdfAssetBuilderSettings& settings)
+    {
+        const AZ::u64 generation = ++m_generation;
+        const AZStd::string contextKey = GetContextKey(baseFilePath, amentPrefixPath, settings);
+
+        // References are unique keys of assetFilenames, each one gets its own result slot, so jobs don't need to synchronize.
+        AZStd::vector<const AZStd::string*> uris;
+        uris.reserve(assetFilenames.size());
+        for (const auto& [uri, assetReferenceType] : assetFilenames)
+        {
+            uris.push_back(&uri);
+        }
+        AZStd::vector<ResolvedAssetPath> results(uris.size());
+
+        auto resolveReference = [&](size_t index)
+        {
+            ResolvedAssetPath& result = results[index];
+            result.m_resolvedPath = Resolve(*uris[index], baseFilePath, amentPrefixPath, settings, contextKey, generation);
+            if (!result.m_resolvedPath.empty())
+            {
+                result.m_fileCRC = GetFileCRC(result.m_resolvedPath);
+            }
+        };
+
+        if (AZ::JobContext::GetGlobalContext() && uris.size() > 1)
+        {
+            AZ::JobCompletion completion;
+            for (size_t i = 0; i < uris.size(); ++i)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&resolveReference, i]()
+                    {
+                        resolveReference(i);
+                    },
+                    true);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (size_t i = 0; i < uris.size(); ++i)
+            {
+                resolveReference(i);
+            }
+        }
+
+        ResolvedAssetPaths resolvedPaths;
+        resolvedPaths.reserve(uris.size());
+        for (size_t i = 0; i < uris.size(); ++i)
+        {
+            resolvedPaths.emplace(*uris[i], AZStd::move(results[i]));
+        }
+        return resolvedPaths;
+    }
+
+    void AssetPathResolver::Clear()
+    {
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_resolutionsMutex);
+            m_resolutions.clear();
+        }
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_directoriesMutex);
+        m_directories.clear();
+    }
+
+    AZ::IO::Path AssetPathResolver::Resolve(
+        const AZStd::string& uri,
+        const AZ::IO::PathView& baseFilePath,
+        AZStd::string_view amentPrefixPath,
+        const SdfAssetBuilderSettings& settings,
+        const AZStd::string& contextKey,
+        AZ::u64 generation)
+    {
+        const AZStd::string resolutionKey = contextKey + "|" + uri;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_resolutionsMutex);
+            if (auto it = m_resolutions.find(resolutionKey); it != m_resolutions.end())
+            {
+                const CachedResolution cachedResolution = it->second;
+                lock.unlock();
+
+                const bool unchanged = AZStd::all_of(
+                    cachedResolution.m_probedDirectories.begin(),
+                    cachedResolution.m_probedDirectories.end(),
+                    [this, generation](const ProbedDirectory& directory)
+                    {
+                        return GetDirectoryModificationTime(directory.m_path, generation) == directory.m_modificationTime;
+                    });
+                if (unchanged)
+                {
+                    return cachedResolution.m_resolvedPath;
+                }
+            }
+        }
+
+        CachedResolution resolution;
+        bool cacheable = true;
+        resolution.m_resolvedPath = ResolveAssetPath(
+            AZ::IO::Path(uri),
+            baseFilePath,
+            amentPrefixPath,
+            settings,
+            [this, generation, &resolution, &cacheable](const AZ::IO::PathView& filePath)
+            {
+                return FileExists(filePath, generation, resolution.m_probedDirectories, cacheable);
+            });
+
+        if (cacheable)
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_resolutionsMutex);
+            m_resolutions.insert_or_assign(resolutionKey, resolution);
+        }
+        return resolution.m_resolvedPath;
+    }
+
+    bool AssetPathResolver::FileExists(
+        const AZ::IO::PathView& filePath, AZ::u64 generation, AZStd::vector<ProbedDirectory>& probedDirectories, bool& cacheable)
+    {
+        const AZ::IO::PathView fileName = filePath.Filename();
+        if (!filePath.IsAbsolute() || fileName.empty() || fileName == "." || fileName == "..")
+        {
+            // Only absolute paths to directory entries can be answered from directory listings.
+            cacheable = false;
+            return Internal::FileExistsCall(filePath);
+        }
+
+        const AZ::IO::Path directory(filePath.ParentPath());
+        const AZ::u64 modificationTime = GetDirectoryModificationTime(directory, generation);
+        const bool probed = AZStd::any_of(
+            probedDirectories.begin(),
+            probedDirectories.end(),
+            [&directory](const ProbedDirectory& probedDirectory)
+            {
+                return probedDirectory.m_path == directory;
+            });
+        if (!probed)
+        {
+            probedDirectories.push_back({ directory, modificationTime });
+        }
+        return modificationTime != 0 && DirectoryContains(directory, fileName);
+    }
+
+    AZ::u64 AssetPathResolver::GetDirectoryModificationTime(const AZ::IO::Path& directory, AZ::u64 generation)
+    {
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_directoriesMutex);
+            if (auto it = m_directories.find(directory); it != m_directories.end() && it->second.m_validatedGeneration == generation)
+            {
+                return it->second.m_modificationTime;
+            }
+        }
+
+        // Checking and listing happen outside of the lock, concurrent jobs probing the same directory might both list it.
+        const AZ::u64 modificationTime = AZ::IO::SystemFile::ModificationTime(directory.c_str());
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_directoriesMutex);
+            if (auto it = m_directories.find(directory); it != m_directories.end() && it->second.m_modificationTime == modificationTime)
+            {
+                it->second.m_validatedGeneration = AZStd::max(it->second.m_validatedGeneration, generation);
+                return modificationTime;
+            }
+        }
+
+        DirectoryListing listing;
+        listing.m_modificationTime = modificationTime;
+        listing.m_validatedGeneration = generation;
+        if (modificationTime != 0)
+        {
+            const AZ::IO::Path filter = directory / "*";
+            AZ::IO::SystemFile::FindFiles(
+                filter.c_str(),
+                [&listing](const char* name, [[maybe_unused]] bool isFile)
+                {
+                    listing.m_entries.emplace(name);
+                    return true;
+                });
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_directoriesMutex);
+        m_directories.insert_or_assign(directory, AZStd::move(listing));
+        return modificationTime;
+    }
+
+    bool AssetPathResolver::DirectoryContains(const AZ::IO::Path& directory, const AZ::IO::PathView& name)
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_directoriesMutex);
+        auto it = m_directories.find(directory);
+        return it != m_directories.end() && it->second.m_entries.contains(AZ::IO::Path(name));
+    }
+} // namespace ROS2::Utils
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/string/string.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
+
+namespace ROS2::Utils
+{
+    //! Result of resolving a single asset reference of a URDF/SDF file.
+    struct ResolvedAssetPath
+    {
+        //! Path to the referenced file in the filesystem, empty if the reference could not be resolved.
+        AZ::IO::Path m_resolvedPath;
+
+        //! Checksum of the referenced file, @see GetFileCRC.
+        AZ::Crc32 m_fileCRC;
+    };
+
+    //! Maps unresolved asset references to their resolved paths.
+    using ResolvedAssetPaths = AZStd::unordered_map<AZStd::string, ResolvedAssetPath>;
+
+    //! Resolves asset references of URDF/SDF files the same way as ResolveAssetPath, with memoization shared by the whole process.
+    //! File existence checks are answered from cached directory listings, and resolved paths are cached together with the
+    //! modification times of all directories that were probed to resolve them, so a cached result is reused until one of
+    //! these directories changes. Modification times are checked at most once per directory and ResolveAssetPaths call.
+    //! Note that modification times have the granularity of the filesystem, so files added to a directory in the same tick
+    //! as it was listed might be missed until the directory changes again.
+    class AssetPathResolver
+    {
+    public:
+        //! @return the resolver shared by the process.
+        static AssetPathResolver& Get();
+
+        //! Resolve all asset references of a URDF/SDF file. References are resolved in parallel on the job system when
+        //! the global job context exists, and serially otherwise.
+        //! @param assetFilenames unresolved asset references, as returned by GetReferencedAssetFilenames.
+        //! @param baseFilePath the absolute path of URDF/SDF file which contains the references.
+        //! @param amentPrefixPath the string that contains available packages' path, separated by ':' signs.
+        //! @param settings the asset path resolution settings to use for attempting to locate the correct files.
+        //! @returns resolved paths and checksums of all references.
+        ResolvedAssetPaths ResolveAssetPaths(
+            const AssetFilenameReferences& assetFilenames,
+            const AZ::IO::PathView& baseFilePath,
+            AZStd::string_view amentPrefixPath,
+            const SdfAssetBuilderSettings& settings);
+
+        //! Drop all cached directory listings and resolved paths.
+        void Clear();
+
+    private:
+        //! Directory probed while resolving a path, with its modification time at that moment.
+        struct ProbedDirectory
+        {
+            AZ::IO::Path m_path;
+            AZ::u64 m_modificationTime = 0;
+        };
+
+        struct DirectoryListing
+        {
+            AZ::u64 m_modificationTime = 0; //!< Zero if the directory does not exist
+            AZ::u64 m_validatedGeneration = 0; //!< Generation in which the modification time was last checked
+            AZStd::unordered_set<AZ::IO::Path> m_entries; //!< Names of files and directories
+        };
+
+        struct CachedResolution
+        {
+            AZ::IO::Path m_resolvedPath;
+            AZStd::vector<ProbedDirectory> m_probedDirectories;
+        };
+
+        //! Resolve a single reference, or reuse a cached resolution if none of its probed directories changed.
+        AZ::IO::Path Resolve(
+            const AZStd::string& uri,
+            const AZ::IO::PathView& baseFilePath,
+            AZStd::string_view amentPrefixPath,
+            const SdfAssetBuilderSettings& settings,
+            const AZStd::string& contextKey,
+            AZ::u64 generation);
+
+        //! Check if a file exists using the cached listing of its directory.
+        //! @param probedDirectories receives the directory of the file with its modification time.
+        //! @param cacheable set to false if the check bypassed the cache, e.g. for relative paths.
+        bool FileExists(
+            const AZ::IO::PathView& filePath, AZ::u64 generation, AZStd::vector<ProbedDirectory>& probedDirectories, bool& cacheable);
+
+        //! @return current modification time of the directory, listing it again if it changed since the last check.
+        AZ::u64 GetDirectoryModificationTime(const AZ::IO::Path& directory, AZ::u64 generation);
+        bool DirectoryContains(const AZ::IO::Path& directory, const AZ::IO::PathView& name);
+
+        AZStd::shared_mutex m_directoriesMutex;
+        AZStd::unordered_map<AZ::IO::Path, DirectoryListing> m_directories;
+
+        AZStd::shared_mutex m_resolutionsMutex;
+        AZStd::unordered_map<AZStd::string, CachedResolution> m_resolutions;
+
+        AZStd::atomic<AZ::u64> m_generation{ 0 };
+    };
+} // namespace ROS2::Utils
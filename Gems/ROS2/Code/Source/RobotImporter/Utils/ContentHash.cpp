@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ContentHash.h"
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace ROS2::Utils
+{
+    AZ::u64 HashBytes(const void* data, size_t size, AZ::u64 hash)
+    {
+        const auto* bytes = static_cast<const AZ::u8*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    AZ::u64 HashString(AZStd::string_view value, AZ::u64 hash)
+    {
+        return HashBytes(value.data(), value.size(), hash);
+    }
+
+    AZStd::optional<AZ::u64> HashFile(const AZ::IO::Path& filePath)
+    {
+        const auto fileSize = AZ::IO::SystemFile::Length(filePath.c_str());
+        if (fileSize == 0 && !AZ::IO::SystemFile::Exists(filePath.c_str()))
+        {
+            return AZStd::nullopt;
+        }
+        AZStd::vector<char> buffer;
+        buffer.resize_no_construct(fileSize);
+        if (fileSize > 0 && !AZ::IO::SystemFile::Read(filePath.c_str(), buffer.data(), fileSize))
+        {
+            return AZStd::nullopt;
+        }
+        return HashBytes(buffer.data(), buffer.size());
+    }
+
+    AZStd::string ToHexString(AZ::u64 hash)
+    {
+        return AZStd::string::format("%016llx", static_cast<unsigned long long>(hash));
+    }
+} // namespace ROS2::Utils
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/base.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace ROS2::Utils
+{
+    //! Initial value of content hashes, pass it to chain several hashes.
+    constexpr AZ::u64 ContentHashSeed = 14695981039346656037ull;
+
+    //! 64-bit FNV-1a hash of the bytes, stable across processes so it can be used in persisted cache keys.
+    AZ::u64 HashBytes(const void* data, size_t size, AZ::u64 hash = ContentHashSeed);
+
+    //! 64-bit FNV-1a hash of the characters of the string.
+    AZ::u64 HashString(AZStd::string_view value, AZ::u64 hash = ContentHashSeed);
+
+    //! @return hash of the file content, or an empty optional if the file cannot be read.
+    AZStd::optional<AZ::u64> HashFile(const AZ::IO::Path& filePath);
+
+    //! @return hash as a fixed width, lower case hexadecimal string.
+    AZStd::string ToHexString(AZ::u64 hash);
+} // namespace ROS2::Utils
@@ -29,55 +29,67 @@ namespace ROS2::Utils
         };
     } // namespace Internal
 
-    bool IsWheelURDFHeuristics(const sdf::Model& model, const sdf::Link* link)
+    namespace
     {
-        auto wheelMatcher = [](AZStd::string_view name)
+        //! Check the properties of the link itself: wheels have a catchy name, collisions and visuals.
+        bool IsWheelLinkCandidate(const sdf::Link* link)
         {
             // StringFunc matches are case-insensitive by default
-            return AZ::StringFunc::Contains(name, "wheel");
-        };
+            const AZStd::string_view linkName(link->Name().c_str(), link->Name().size());
+            if (!AZ::StringFunc::Contains(linkName, "wheel"))
+            {
+                return false;
+            }
 
-        const AZStd::string linkName(link->Name().c_str(), link->Name().size());
-        // Check if link name is catchy for wheel
-        if (!wheelMatcher(linkName))
-        {
-            return false;
+            // Wheels need to have collision and visuals
+            return (link->CollisionCount() != 0) && (link->VisualCount() != 0);
         }
 
-        // Wheels need to have collision and visuals
-        if ((link->CollisionCount() == 0) || (link->VisualCount() == 0))
+        //! Check the joints where the link is a child: the parent link joint needs to be CONTINUOUS.
+        bool IsWheelParentJoint(const AZStd::vector<const sdf::Joint*>& jointsWhereLinkIsChild)
         {
-            return false;
-        }
-
-        // When this link is a child, the parent link joint needs to be CONTINUOUS
-        AZStd::vector<const sdf::Joint*> joints = GetJointsForChildLink(model, linkName, true);
+            // URDFs only have a single parent
+            // This is explained in the Pose frame semantics tutorial for sdformat
+            // http://sdformat.org/tutorials?tut=pose_frame_semantics&ver=1.5#parent-frames-in-urdf
+
+            // The SDF URDF parser converts continuous joints to revolute joints with a limit
+            // of -infinity to +infinity
+            // https://github.com/gazebosim/sdformat/blob/sdf13/src/parser_urdf.cc#L3009-L3039
+            bool isWheel{};
+            if (!jointsWhereLinkIsChild.empty())
+            {
+                const sdf::Joint* potentialWheelJoint = jointsWhereLinkIsChild.front();
+                if (const sdf::JointAxis* jointAxis = potentialWheelJoint->Axis(); jointAxis != nullptr)
+                {
+                    using LimitType = decltype(jointAxis->Lower());
+                    // There should only be 1 element for URDF, however that will not be verified
+                    // in case this function is called on link from an SDF file
+                    isWheel = potentialWheelJoint->Type() == sdf::JointType::CONTINUOUS;
+                    isWheel = isWheel ||
+                        (potentialWheelJoint->Type() == sdf::JointType::REVOLUTE &&
+                         jointAxis->Lower() == -AZStd::numeric_limits<LimitType>::infinity() &&
+                         jointAxis->Upper() == AZStd::numeric_limits<LimitType>::infinity());
+                }
+            }
 
-        // URDFs only have a single parent
-        // This is explained in the Pose frame semantics tutorial for sdformat
-        // http://sdformat.org/tutorials?tut=pose_frame_semantics&ver=1.5#parent-frames-in-urdf
+            return isWheel;
+        }
+    } // namespace
 
-        // The SDF URDF parser converts continuous joints to revolute joints with a limit
-        // of -infinity to +infinity
-        // https://github.com/gazebosim/sdformat/blob/sdf13/src/parser_urdf.cc#L3009-L3039
-        bool isWheel{};
-        if (!joints.empty())
+    bool IsWheelURDFHeuristics(const sdf::Model& model, const sdf::Link* link)
+    {
+        if (!IsWheelLinkCandidate(link))
         {
-            const sdf::Joint* potentialWheelJoint = joints.front();
-            if (const sdf::JointAxis* jointAxis = potentialWheelJoint->Axis(); jointAxis != nullptr)
-            {
-                using LimitType = decltype(jointAxis->Lower());
-                // There should only be 1 element for URDF, however that will not be verified
-                // in case this function is called on link from an SDF file
-                isWheel = potentialWheelJoint->Type() == sdf::JointType::CONTINUOUS;
-                isWheel = isWheel ||
-                    (potentialWheelJoint->Type() == sdf::JointType::REVOLUTE &&
-                     jointAxis->Lower() == -AZStd::numeric_limits<LimitType>::infinity() &&
-                     jointAxis->Upper() == AZStd::numeric_limits<LimitType>::infinity());
-            }
+            return false;
         }
 
-        return isWheel;
+        const AZStd::string linkName(link->Name().c_str(), link->Name().size());
+        return IsWheelParentJoint(GetJointsForChildLink(model, linkName, true));
+    }
+
+    bool IsWheelURDFHeuristics(const SdfTopologyIndex& topologyIndex, const sdf::Link* link)
+    {
+        return IsWheelLinkCandidate(link) && IsWheelParentJoint(topologyIndex.GetJointsForChildLink(*link));
     }
 
     AZ::Transform GetLocalTransformURDF(const sdf::SemanticPose& semanticPose, AZ::Transform t)
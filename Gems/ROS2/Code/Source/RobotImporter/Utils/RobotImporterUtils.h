@@ -16,6 +16,7 @@
 #include <AzCore/std/function/function_template.h>
 #include <AzCore/std/string/string.h>
 #include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/Utils/SdfTopologyIndex.h>
 #include <RobotImporter/Utils/SourceAssetsStorage.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 
@@ -38,6 +39,12 @@ namespace ROS2::Utils
     //! @return true if the link is likely a wheel link.
     bool IsWheelURDFHeuristics(const sdf::Model& model, const sdf::Link* link);
 
+    //! Determine whether a given link is likely a wheel link, using the precomputed topology of the document.
+    //! @param topologyIndex index of the document containing the link, used to query the joints where the link is a child.
+    //! @param link the link that will be subjected to the heuristic.
+    //! @return true if the link is likely a wheel link.
+    bool IsWheelURDFHeuristics(const SdfTopologyIndex& topologyIndex, const sdf::Link* link);
+
     //! Returns an AZ::Transform converted from the link pose defined relative to another frame.
     //! @param semanticPose pointer to URDF/SDF link
     //! @param t initial transform, multiplied against link transform
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SdfTopologyIndex.h"
+
+namespace ROS2::Utils
+{
+    namespace
+    {
+        template<class Entry>
+        const Entry* FindEntry(const AZStd::vector<Entry>& entries, const AZStd::unordered_map<AZStd::string_view, size_t>& indices, AZStd::string_view name)
+        {
+            auto it = indices.find(name);
+            return it != indices.end() ? &entries[it->second] : nullptr;
+        }
+
+        template<class Entry, class Element>
+        const Entry* FindEntry(const AZStd::vector<Entry>& entries, const AZStd::unordered_map<const Element*, size_t>& indices, const Element& element)
+        {
+            auto it = indices.find(&element);
+            return it != indices.end() ? &entries[it->second] : nullptr;
+        }
+
+        const AZStd::vector<const sdf::Joint*> NoJoints;
+    } // namespace
+
+    SdfTopologyIndex::SdfTopologyIndex(const sdf::Root& root)
+    {
+        // Models are indexed in the same order as VisitModels visits them: the root <model> first,
+        // followed by the <model> tags of every <world>, each one followed by its nested models.
+        if (const sdf::Model* model = root.Model(); model != nullptr)
+        {
+            IndexModel(*model, nullptr, model->Name());
+        }
+        for (uint64_t worldIndex{}; worldIndex < root.WorldCount(); ++worldIndex)
+        {
+            if (const sdf::World* world = root.WorldByIndex(worldIndex); world != nullptr)
+            {
+                for (uint64_t modelIndex{}; modelIndex < world->ModelCount(); ++modelIndex)
+                {
+                    if (const sdf::Model* model = world->ModelByIndex(modelIndex); model != nullptr)
+                    {
+                        IndexModel(*model, nullptr, model->Name());
+                    }
+                }
+            }
+        }
+
+        // Name lookups refer to the strings stored in the entries, so they are only built once the entry vectors are final.
+        // Later entries with the same name replace earlier ones, as in GetAllLinks and GetAllJoints.
+        for (size_t i = 0; i < m_models.size(); ++i)
+        {
+            m_modelsByName.insert_or_assign(AZStd::string_view(m_models[i].m_fullyQualifiedName), i);
+            m_modelsByPointer.emplace(m_models[i].m_model, i);
+        }
+        for (size_t i = 0; i < m_links.size(); ++i)
+        {
+            m_linksByName.insert_or_assign(AZStd::string_view(m_links[i].m_fullyQualifiedName), i);
+            m_linksByPointer.emplace(m_links[i].m_link, i);
+        }
+        for (size_t i = 0; i < m_joints.size(); ++i)
+        {
+            m_jointsByName.insert_or_assign(AZStd::string_view(m_joints[i].m_fullyQualifiedName), i);
+            m_jointsByPointer.emplace(m_joints[i].m_joint, i);
+        }
+
+        m_jointsWhereLinkIsChild.resize(m_links.size());
+        m_jointsWhereLinkIsParent.resize(m_links.size());
+        for (const JointEntry& joint : m_joints)
+        {
+            m_jointsWhereLinkIsChild[m_linksByPointer.at(joint.m_childLink)].push_back(joint.m_joint);
+            m_jointsWhereLinkIsParent[m_linksByPointer.at(joint.m_parentLink)].push_back(joint.m_joint);
+        }
+
+        SortLinksTopologically();
+    }
+
+    void SdfTopologyIndex::IndexModel(const sdf::Model& model, const sdf::Model* parentModel, const std::string& fullyQualifiedName)
+    {
+        m_models.push_back({ AZStd::string(fullyQualifiedName.c_str(), fullyQualifiedName.size()), &model, parentModel });
+
+        for (uint64_t linkIndex{}; linkIndex < model.LinkCount(); ++linkIndex)
+        {
+            if (const sdf::Link* link = model.LinkByIndex(linkIndex); link != nullptr)
+            {
+                const std::string linkName = sdf::JoinName(fullyQualifiedName, link->Name());
+                m_links.push_back({ AZStd::string(linkName.c_str(), linkName.size()), link, &model });
+            }
+        }
+
+        for (uint64_t jointIndex{}; jointIndex < model.JointCount(); ++jointIndex)
+        {
+            const sdf::Joint* joint = model.JointByIndex(jointIndex);
+            if (joint == nullptr)
+            {
+                continue;
+            }
+            // Skip any joints whose parent and child link references don't have an actual sdf::Link in the parsed model
+            const sdf::Link* parentLink = model.LinkByName(joint->ParentName());
+            const sdf::Link* childLink = model.LinkByName(joint->ChildName());
+            if (parentLink != nullptr && childLink != nullptr)
+            {
+                const std::string jointName = sdf::JoinName(fullyQualifiedName, joint->Name());
+                m_joints.push_back({ AZStd::string(jointName.c_str(), jointName.size()), joint, &model, parentLink, childLink });
+            }
+        }
+
+        for (uint64_t modelIndex{}; modelIndex < model.ModelCount(); ++modelIndex)
+        {
+            if (const sdf::Model* nestedModel = model.ModelByIndex(modelIndex); nestedModel != nullptr)
+            {
+                IndexModel(*nestedModel, &model, sdf::JoinName(fullyQualifiedName, nestedModel->Name()));
+            }
+        }
+    }
+
+    void SdfTopologyIndex::SortLinksTopologically()
+    {
+        // Kahn's algorithm: a link is emitted once all links that are parents of it in a joint have been emitted.
+        AZStd::vector<size_t> remainingParentCounts(m_links.size());
+        for (size_t i = 0; i < m_links.size(); ++i)
+        {
+            remainingParentCounts[i] = m_jointsWhereLinkIsChild[i].size();
+        }
+
+        m_topologicalLinkOrder.reserve(m_links.size());
+        for (size_t i = 0; i < m_links.size(); ++i)
+        {
+            if (remainingParentCounts[i] == 0)
+            {
+                m_topologicalLinkOrder.push_back(m_links[i].m_link);
+            }
+        }
+
+        // The output vector doubles as the queue of links whose children are still to be visited.
+        for (size_t next = 0; next < m_topologicalLinkOrder.size(); ++next)
+        {
+            const size_t linkIndex = m_linksByPointer.at(m_topologicalLinkOrder[next]);
+            for (const sdf::Joint* joint : m_jointsWhereLinkIsParent[linkIndex])
+            {
+                const size_t childIndex = m_linksByPointer.at(m_joints[m_jointsByPointer.at(joint)].m_childLink);
+                if (--remainingParentCounts[childIndex] == 0)
+                {
+                    m_topologicalLinkOrder.push_back(m_links[childIndex].m_link);
+                }
+            }
+        }
+
+        // Links in kinematic loops never run out of parents.
+        if (m_topologicalLinkOrder.size() < m_links.size())
+        {
+            for (size_t i = 0; i < m_links.size(); ++i)
+            {
+                if (remainingParentCounts[i] > 0)
+                {
+                    m_topologicalLinkOrder.push_back(m_links[i].m_link);
+                }
+            }
+        }
+    }
+
+    const AZStd::vector<SdfTopologyIndex::ModelEntry>& SdfTopologyIndex::GetModels() const
+    {
+        return m_models;
+    }
+
+    const AZStd::vector<SdfTopologyIndex::LinkEntry>& SdfTopologyIndex::GetLinks() const
+    {
+        return m_links;
+    }
+
+    const AZStd::vector<SdfTopologyIndex::JointEntry>& SdfTopologyIndex::GetJoints() const
+    {
+        return m_joints;
+    }
+
+    const SdfTopologyIndex::ModelEntry* SdfTopologyIndex::FindModel(AZStd::string_view fullyQualifiedName) const
+    {
+        return FindEntry(m_models, m_modelsByName, fullyQualifiedName);
+    }
+
+    const SdfTopologyIndex::LinkEntry* SdfTopologyIndex::FindLink(AZStd::string_view fullyQualifiedName) const
+    {
+        return FindEntry(m_links, m_linksByName, fullyQualifiedName);
+    }
+
+    const SdfTopologyIndex::JointEntry* SdfTopologyIndex::FindJoint(AZStd::string_view fullyQualifiedName) const
+    {
+        return FindEntry(m_joints, m_jointsByName, fullyQualifiedName);
+    }
+
+    const SdfTopologyIndex::ModelEntry* SdfTopologyIndex::FindModel(const sdf::Model& model) const
+    {
+        return FindEntry(m_models, m_modelsByPointer, model);
+    }
+
+    const SdfTopologyIndex::LinkEntry* SdfTopologyIndex::FindLink(const sdf::Link& link) const
+    {
+        return FindEntry(m_links, m_linksByPointer, link);
+    }
+
+    const SdfTopologyIndex::JointEntry* SdfTopologyIndex::FindJoint(const sdf::Joint& joint) const
+    {
+        return FindEntry(m_joints, m_jointsByPointer, joint);
+    }
+
+    const AZStd::vector<const sdf::Joint*>& SdfTopologyIndex::GetJointsForChildLink(const sdf::Link& link) const
+    {
+        auto it = m_linksByPointer.find(&link);
+        return it != m_linksByPointer.end() ? m_jointsWhereLinkIsChild[it->second] : NoJoints;
+    }
+
+    const AZStd::vector<const sdf::Joint*>& SdfTopologyIndex::GetJointsForParentLink(const sdf::Link& link) const
+    {
+        auto it = m_linksByPointer.find(&link);
+        return it != m_linksByPointer.end() ? m_jointsWhereLinkIsParent[it->second] : NoJoints;
+    }
+
+    const AZStd::vector<const sdf::Link*>& SdfTopologyIndex::GetLinksInTopologicalOrder() const
+    {
+        return m_topologicalLinkOrder;
+    }
+} // namespace ROS2::Utils
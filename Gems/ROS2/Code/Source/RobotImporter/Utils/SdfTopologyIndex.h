@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <sdf/sdf.hh>
+
+namespace ROS2::Utils
+{
+    //! Immutable index of the models, links and joints of a parsed SDF document, built in a single pass over the sdf::Root.
+    //! It answers the queries of the Visit* and Get* helpers of RobotImporterUtils in constant time, which keeps the import
+    //! linear in the size of the document rather than proportional to the product of links and joints.
+    //! Fully qualified names follow the name scoping proposal in SDF 1.8, e.g. "model_name::nested_model_name::link_name".
+    //! The index holds pointers into the sdf::Root, which has to outlive it.
+    class SdfTopologyIndex
+    {
+    public:
+        struct ModelEntry
+        {
+            AZStd::string m_fullyQualifiedName;
+            const sdf::Model* m_model{};
+            const sdf::Model* m_parentModel{}; //!< Model containing this one, nullptr for top level models
+        };
+
+        struct LinkEntry
+        {
+            AZStd::string m_fullyQualifiedName;
+            const sdf::Link* m_link{};
+            const sdf::Model* m_model{}; //!< Model the link is attached to
+        };
+
+        //! Only joints whose parent and child links exist in their model are indexed, as in VisitJoints.
+        struct JointEntry
+        {
+            AZStd::string m_fullyQualifiedName;
+            const sdf::Joint* m_joint{};
+            const sdf::Model* m_model{}; //!< Model the joint is attached to
+            const sdf::Link* m_parentLink{};
+            const sdf::Link* m_childLink{};
+        };
+
+        //! Index all models of the document, including nested models and models of worlds.
+        explicit SdfTopologyIndex(const sdf::Root& root);
+
+        //! @returns all models, links and joints in the order VisitModels visits them.
+        const AZStd::vector<ModelEntry>& GetModels() const;
+        const AZStd::vector<LinkEntry>& GetLinks() const;
+        const AZStd::vector<JointEntry>& GetJoints() const;
+
+        //! @returns entries by fully qualified name, or nullptr if there is no such element.
+        const ModelEntry* FindModel(AZStd::string_view fullyQualifiedName) const;
+        const LinkEntry* FindLink(AZStd::string_view fullyQualifiedName) const;
+        const JointEntry* FindJoint(AZStd::string_view fullyQualifiedName) const;
+
+        //! @returns entries of elements of the indexed document, or nullptr for elements of other documents.
+        const ModelEntry* FindModel(const sdf::Model& model) const;
+        const LinkEntry* FindLink(const sdf::Link& link) const;
+        const JointEntry* FindJoint(const sdf::Joint& joint) const;
+
+        //! @returns joints in which the link is the child, the first one defines its parent link for URDF.
+        const AZStd::vector<const sdf::Joint*>& GetJointsForChildLink(const sdf::Link& link) const;
+        //! @returns joints in which the link is the parent.
+        const AZStd::vector<const sdf::Joint*>& GetJointsForParentLink(const sdf::Link& link) const;
+
+        //! @returns all links ordered so that parent links of joints come before their child links.
+        //! Root links come first in the order of GetLinks. Links in kinematic loops, which SDF allows, are appended last.
+        const AZStd::vector<const sdf::Link*>& GetLinksInTopologicalOrder() const;
+
+    private:
+        void IndexModel(const sdf::Model& model, const sdf::Model* parentModel, const std::string& fullyQualifiedName);
+        void SortLinksTopologically();
+
+        AZStd::vector<ModelEntry> m_models;
+        AZStd::vector<LinkEntry> m_links;
+        AZStd::vector<JointEntry> m_joints;
+
+        AZStd::unordered_map<AZStd::string_view, size_t> m_modelsByName;
+        AZStd::unordered_map<AZStd::string_view, size_t> m_linksByName;
+        AZStd::unordered_map<AZStd::string_view, size_t> m_jointsByName;
+        AZStd::unordered_map<const sdf::Model*, size_t> m_modelsByPointer;
+        AZStd::unordered_map<const sdf::Link*, size_t> m_linksByPointer;
+        AZStd::unordered_map<const sdf::Joint*, size_t> m_jointsByPointer;
+
+        //! Adjacency lists, indexed like m_links.
+        AZStd::vector<AZStd::vector<const sdf::Joint*>> m_jointsWhereLinkIsChild;
+        AZStd::vector<AZStd::vector<const sdf::Joint*>> m_jointsWhereLinkIsParent;
+
+        AZStd::vector<const sdf::Link*> m_topologicalLinkOrder;
+    };
+} // namespace ROS2::Utils
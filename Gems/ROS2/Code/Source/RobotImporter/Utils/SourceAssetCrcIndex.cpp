@@ -0,0 +1,547 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SourceAssetCrcIndex.h"
+#include <AssetDatabase/AssetDatabaseConnection.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/string/string.h>
+#include <AzToolsFramework/API/AssetDatabaseBus.h>
+
+namespace ROS2::Utils
+{
+    namespace
+    {
+        constexpr const char* SourceAssetCrcIndexName = "SourceAssetCrcIndex";
+        constexpr int IndexFileVersion = 1;
+
+        AZStd::string GetLowerCaseExtension(AZ::IO::PathView path)
+        {
+            AZStd::string extension = path.Extension().Native();
+            AZStd::to_lower(extension.begin(), extension.end());
+            return extension;
+        }
+
+        AZStd::unordered_set<AZStd::string> GetLowerCaseSupportedExtensions()
+        {
+            AZStd::unordered_set<AZStd::string> extensions;
+            for (AZStd::string extension : GetSupportedExtensions())
+            {
+                AZStd::to_lower(extension.begin(), extension.end());
+                extensions.emplace(AZStd::move(extension));
+            }
+            return extensions;
+        }
+
+        //! Compute the checksum of the source asset, unless the previous entry for it is still up to date.
+        //! @return false if the file has no checksum, e.g. because it is empty or was removed.
+        bool UpdateEntry(SourceAssetCrcIndex::Entry& entry, const SourceAssetCrcIndex::Entry* previousEntry)
+        {
+            entry.m_modificationTime = AZ::IO::SystemFile::ModificationTime(entry.m_asset.m_sourceAssetGlobalPath.c_str());
+            if (previousEntry != nullptr && previousEntry->m_modificationTime == entry.m_modificationTime &&
+                previousEntry->m_asset.m_sourceAssetGlobalPath == entry.m_asset.m_sourceAssetGlobalPath)
+            {
+                entry.m_crc = previousEntry->m_crc;
+            }
+            else
+            {
+                entry.m_crc = GetFileCRC(entry.m_asset.m_sourceAssetGlobalPath);
+            }
+            return entry.m_modificationTime != 0 && entry.m_crc != AZ::Crc32(0);
+        }
+    } // namespace
+
+    SourceAssetCrcIndex::SourceAssetCrcIndex(AZ::IO::PathView indexFilePath)
+        : m_indexFilePath(indexFilePath)
+        , m_supportedExtensions(GetLowerCaseSupportedExtensions())
+    {
+        Load();
+        AzToolsFramework::AssetSystemBus::Handler::BusConnect();
+        if (SourceAssetCrcIndexInterface::Get() == nullptr)
+        {
+            SourceAssetCrcIndexInterface::Register(this);
+        }
+    }
+
+    SourceAssetCrcIndex::~SourceAssetCrcIndex()
+    {
+        if (SourceAssetCrcIndexInterface::Get() == this)
+        {
+            SourceAssetCrcIndexInterface::Unregister(this);
+        }
+        AzToolsFramework::AssetSystemBus::Handler::BusDisconnect();
+        CancelRefresh();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_dirty)
+        {
+            Save();
+        }
+    }
+
+    AZ::IO::Path SourceAssetCrcIndex::GetDefaultIndexFilePath()
+    {
+        AZStd::string databaseLocation;
+        bool databaseLocationFound = false;
+        AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::BroadcastResult(
+            databaseLocationFound,
+            &AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation,
+            databaseLocation);
+        if (databaseLocationFound && !databaseLocation.empty())
+        {
+            return AZ::IO::Path(databaseLocation).ParentPath() / "ros2_source_asset_crc_index.json";
+        }
+
+        AZ::IO::FixedMaxPath userFolder;
+        if (auto* fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO && fileIO->ResolvePath(userFolder, "@user@/RobotImporter"))
+        {
+            return AZ::IO::Path(userFolder) / "ros2_source_asset_crc_index.json";
+        }
+        return {};
+    }
+
+    void SourceAssetCrcIndex::RequestRefresh()
+    {
+        if (m_refreshing.exchange(true))
+        {
+            return;
+        }
+        if (m_refreshThread.joinable())
+        {
+            m_refreshThread.join();
+        }
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "ROS2 source asset CRC index refresh";
+        m_refreshThread = AZStd::thread(
+            threadDesc,
+            [this]()
+            {
+                Refresh();
+                m_refreshing = false;
+            });
+    }
+
+    void SourceAssetCrcIndex::CancelRefresh()
+    {
+        m_cancelRefresh = true;
+        if (m_refreshThread.joinable())
+        {
+            m_refreshThread.join();
+        }
+    }
+
+    void SourceAssetCrcIndex::Refresh()
+    {
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        Entries previousEntries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            previousEntries = m_entries;
+            m_changesDuringRefresh.clear();
+            m_recordChanges = true;
+        }
+
+        // The scan only reads the asset database and the first kilobyte of files modified since they were indexed,
+        // lookups keep using the previous entries meanwhile.
+        AZ::Outcome<AZStd::vector<Entry>, AZStd::string> scanOutcome = AZ::Failure(AZStd::string());
+        if (auto queryOutcome = QuerySourceAssets(); queryOutcome.IsSuccess())
+        {
+            scanOutcome = ComputeEntries(queryOutcome.GetValue(), previousEntries, &m_cancelRefresh);
+        }
+        else
+        {
+            scanOutcome = AZ::Failure(queryOutcome.TakeError());
+        }
+
+        if (!scanOutcome.IsSuccess())
+        {
+            // A failed scan might have missed any number of source assets, so the previous entries are kept and not saved.
+            AZ_Warning(
+                SourceAssetCrcIndexName,
+                m_cancelRefresh,
+                "Cannot refresh the index, keeping the previous one: %s",
+                scanOutcome.GetError().c_str());
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                m_recordChanges = false;
+                m_changesDuringRefresh.clear();
+                m_refreshed = true;
+            }
+            m_refreshedCondition.notify_all();
+            return;
+        }
+
+        AZStd::vector<Entry>& scannedEntries = scanOutcome.GetValue();
+        const size_t scannedCount = scannedEntries.size();
+        size_t updatedCount = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_entries.clear();
+            m_sourceGuidsByCrc.clear();
+            for (Entry& entry : scannedEntries)
+            {
+                auto previousIt = previousEntries.find(entry.m_asset.m_sourceGuid);
+                if (previousIt == previousEntries.end() || previousIt->second.m_crc != entry.m_crc ||
+                    previousIt->second.m_modificationTime != entry.m_modificationTime)
+                {
+                    ++updatedCount;
+                }
+                AddToCrcLookup(entry);
+                const AZ::Uuid sourceGuid = entry.m_asset.m_sourceGuid;
+                m_entries.insert_or_assign(sourceGuid, AZStd::move(entry));
+            }
+
+            // The scan might have read the asset database before these changes were processed.
+            for (auto& [sourceGuid, entry] : m_changesDuringRefresh)
+            {
+                ApplyChange(sourceGuid, AZStd::move(entry));
+            }
+            updatedCount += m_changesDuringRefresh.size();
+            m_changesDuringRefresh.clear();
+            m_recordChanges = false;
+
+            if (updatedCount > 0 || m_entries.size() != previousEntries.size())
+            {
+                m_dirty = !Save();
+            }
+            m_refreshed = true;
+        }
+        m_refreshedCondition.notify_all();
+
+        const auto refreshTime = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        AZ_Info(
+            SourceAssetCrcIndexName,
+            "Indexed %zu source assets, %zu of them updated, in %lld ms.",
+            scannedCount,
+            updatedCount,
+            static_cast<long long>(refreshTime.count()));
+    }
+
+    AZ::Outcome<AZStd::vector<AvailableAsset>, AZStd::string> SourceAssetCrcIndex::QuerySourceAssets()
+    {
+        return QueryAssetDatabase(&m_cancelRefresh);
+    }
+
+    AZ::Outcome<AZStd::vector<AvailableAsset>, AZStd::string> SourceAssetCrcIndex::QueryAssetDatabase(const AZStd::atomic_bool* cancelled)
+    {
+        AzToolsFramework::AssetDatabase::AssetDatabaseConnection assetDatabaseConnection;
+        if (!assetDatabaseConnection.OpenDatabase())
+        {
+            return AZ::Failure(AZStd::string("Cannot open the asset database"));
+        }
+
+        // Paths of source assets are relative to their scan folder, there are only a few of them.
+        AZStd::unordered_map<AZ::s64, AZ::IO::Path> scanFolders;
+        assetDatabaseConnection.QueryScanFoldersTable(
+            [&scanFolders](AzToolsFramework::AssetDatabase::ScanFolderDatabaseEntry& entry)
+            {
+                scanFolders.emplace(entry.m_scanFolderID, AZ::IO::Path(entry.m_scanFolder));
+                return true;
+            });
+        if (scanFolders.empty())
+        {
+            return AZ::Failure(AZStd::string("The asset database has no scan folders"));
+        }
+
+        AZStd::vector<AvailableAsset> assets;
+        auto callback = [&assets, &scanFolders, cancelled](AzToolsFramework::AssetDatabase::SourceDatabaseEntry& sourceEntry)
+        {
+            if (cancelled != nullptr && *cancelled)
+            {
+                return false;
+            }
+            auto scanFolderIt = scanFolders.find(sourceEntry.m_scanFolderPK);
+            if (scanFolderIt == scanFolders.end())
+            {
+                return true;
+            }
+
+            AvailableAsset asset;
+            asset.m_sourceGuid = sourceEntry.m_sourceGuid;
+            asset.m_sourceAssetRelativePath = sourceEntry.m_sourceName;
+            asset.m_sourceAssetGlobalPath = (scanFolderIt->second / sourceEntry.m_sourceName).LexicallyNormal();
+            assets.push_back(AZStd::move(asset));
+            return true;
+        };
+
+        for (const auto& extension : GetSupportedExtensions())
+        {
+            // The query also reports failure when there are no source assets with the extension.
+            assetDatabaseConnection.QuerySourceLikeSourceName(
+                extension.c_str(), AzToolsFramework::AssetDatabase::AssetDatabaseConnection::LikeType::EndsWith, callback);
+            if (cancelled != nullptr && *cancelled)
+            {
+                return AZ::Failure(AZStd::string("Cancelled"));
+            }
+        }
+        return AZ::Success(AZStd::move(assets));
+    }
+
+    AZ::Outcome<AZStd::vector<SourceAssetCrcIndex::Entry>, AZStd::string> SourceAssetCrcIndex::ComputeEntries(
+        const AZStd::vector<AvailableAsset>& assets, const Entries& previousEntries, const AZStd::atomic_bool* cancelled)
+    {
+        AZStd::vector<Entry> entries;
+        entries.reserve(assets.size());
+        for (const auto& asset : assets)
+        {
+            if (cancelled != nullptr && *cancelled)
+            {
+                return AZ::Failure(AZStd::string("Cancelled"));
+            }
+            Entry entry;
+            entry.m_asset = asset;
+            auto previousIt = previousEntries.find(asset.m_sourceGuid);
+            if (UpdateEntry(entry, previousIt != previousEntries.end() ? &previousIt->second : nullptr))
+            {
+                entries.push_back(AZStd::move(entry));
+            }
+        }
+        return AZ::Success(AZStd::move(entries));
+    }
+
+    AZ::Outcome<AZStd::vector<SourceAssetCrcIndex::Entry>, AZStd::string> SourceAssetCrcIndex::ScanAssetDatabase(
+        const Entries& previousEntries, const AZStd::atomic_bool* cancelled)
+    {
+        auto queryOutcome = QueryAssetDatabase(cancelled);
+        if (!queryOutcome.IsSuccess())
+        {
+            return AZ::Failure(queryOutcome.TakeError());
+        }
+        return ComputeEntries(queryOutcome.GetValue(), previousEntries, cancelled);
+    }
+
+    void SourceAssetCrcIndex::WaitForFirstRefresh()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_refreshed)
+            {
+                return;
+            }
+        }
+
+        RequestRefresh();
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        m_refreshedCondition.wait(
+            lock,
+            [this]()
+            {
+                return m_refreshed;
+            });
+    }
+
+    AZStd::optional<AvailableAsset> SourceAssetCrcIndex::Find(AZ::Crc32 crc)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_refreshed)
+            {
+                // Before the first refresh completes, the loaded index might miss source assets added since it was saved.
+                auto sourceGuidIt = m_sourceGuidsByCrc.find(crc);
+                if (sourceGuidIt != m_sourceGuidsByCrc.end())
+                {
+                    return m_entries.at(sourceGuidIt->second).m_asset;
+                }
+            }
+        }
+
+        WaitForFirstRefresh();
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (auto sourceGuidIt = m_sourceGuidsByCrc.find(crc); sourceGuidIt != m_sourceGuidsByCrc.end())
+        {
+            return m_entries.at(sourceGuidIt->second).m_asset;
+        }
+        return AZStd::nullopt;
+    }
+
+    AZStd::unordered_map<AZ::Crc32, AvailableAsset> SourceAssetCrcIndex::GetAvailableAssets()
+    {
+        WaitForFirstRefresh();
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        availableAssets.reserve(m_sourceGuidsByCrc.size());
+        for (const auto& [crc, sourceGuid] : m_sourceGuidsByCrc)
+        {
+            availableAssets.emplace(crc, m_entries.at(sourceGuid).m_asset);
+        }
+        return availableAssets;
+    }
+
+    void SourceAssetCrcIndex::AddToCrcLookup(const Entry& entry)
+    {
+        // As in GetInterestingSourceAssetsCRC, the first source asset with a given checksum is used.
+        m_sourceGuidsByCrc.emplace(entry.m_crc, entry.m_asset.m_sourceGuid);
+    }
+
+    void SourceAssetCrcIndex::ApplyChange(const AZ::Uuid& sourceGuid, AZStd::optional<Entry> entry)
+    {
+        if (auto previousIt = m_entries.find(sourceGuid); previousIt != m_entries.end())
+        {
+            // Another source asset with the same checksum is only found again by the next refresh.
+            if (auto sourceGuidIt = m_sourceGuidsByCrc.find(previousIt->second.m_crc);
+                sourceGuidIt != m_sourceGuidsByCrc.end() && sourceGuidIt->second == sourceGuid)
+            {
+                m_sourceGuidsByCrc.erase(sourceGuidIt);
+            }
+            m_entries.erase(previousIt);
+            m_dirty = true;
+        }
+        if (entry)
+        {
+            AddToCrcLookup(*entry);
+            m_entries.emplace(sourceGuid, AZStd::move(*entry));
+            m_dirty = true;
+        }
+    }
+
+    void SourceAssetCrcIndex::SourceFileChanged(AZStd::string relativePath, AZStd::string scanFolder, AZ::Uuid sourceUUID)
+    {
+        if (!m_supportedExtensions.contains(GetLowerCaseExtension(AZ::IO::PathView(relativePath))))
+        {
+            return;
+        }
+
+        AZStd::optional<Entry> entry = Entry{};
+        entry->m_asset.m_sourceGuid = sourceUUID;
+        entry->m_asset.m_sourceAssetRelativePath = relativePath;
+        entry->m_asset.m_sourceAssetGlobalPath = (AZ::IO::Path(scanFolder) / relativePath).LexicallyNormal();
+        if (!UpdateEntry(*entry, nullptr))
+        {
+            entry.reset();
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_recordChanges)
+        {
+            m_changesDuringRefresh.emplace_back(sourceUUID, entry);
+        }
+        ApplyChange(sourceUUID, AZStd::move(entry));
+    }
+
+    void SourceAssetCrcIndex::SourceFileRemoved(
+        [[maybe_unused]] AZStd::string relativePath, [[maybe_unused]] AZStd::string scanFolder, AZ::Uuid sourceUUID)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_recordChanges)
+        {
+            m_changesDuringRefresh.emplace_back(sourceUUID, AZStd::nullopt);
+        }
+        ApplyChange(sourceUUID, AZStd::nullopt);
+    }
+
+    bool SourceAssetCrcIndex::Load()
+    {
+        if (m_indexFilePath.empty() || !AZ::IO::SystemFile::Exists(m_indexFilePath.c_str()))
+        {
+            return false;
+        }
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(m_indexFilePath.Native());
+        if (!readResult.IsSuccess())
+        {
+            return false;
+        }
+        // An index which cannot be read completely is ignored, the first refresh then computes all checksums again.
+        const rapidjson::Document& document = readResult.GetValue();
+        if (!document.IsObject() || !document.HasMember("version") || !document["version"].IsInt() ||
+            document["version"].GetInt() != IndexFileVersion || !document.HasMember("assets") || !document["assets"].IsArray())
+        {
+            return false;
+        }
+
+        AZStd::vector<Entry> loadedEntries;
+        for (const auto& assetValue : document["assets"].GetArray())
+        {
+            if (!assetValue.IsObject() || !assetValue.HasMember("sourceGuid") || !assetValue["sourceGuid"].IsString() ||
+                !assetValue.HasMember("sourceRelativePath") || !assetValue["sourceRelativePath"].IsString() ||
+                !assetValue.HasMember("sourceGlobalPath") || !assetValue["sourceGlobalPath"].IsString() ||
+                !assetValue.HasMember("modificationTime") || !assetValue["modificationTime"].IsUint64() || !assetValue.HasMember("crc") ||
+                !assetValue["crc"].IsUint())
+            {
+                AZ_Warning(SourceAssetCrcIndexName, false, "Ignoring malformed index file '%s'.", m_indexFilePath.c_str());
+                return false;
+            }
+
+            Entry entry;
+            entry.m_asset.m_sourceGuid = AZ::Uuid::CreateString(assetValue["sourceGuid"].GetString());
+            entry.m_asset.m_sourceAssetRelativePath = assetValue["sourceRelativePath"].GetString();
+            entry.m_asset.m_sourceAssetGlobalPath = assetValue["sourceGlobalPath"].GetString();
+            entry.m_modificationTime = assetValue["modificationTime"].GetUint64();
+            entry.m_crc = AZ::Crc32(assetValue["crc"].GetUint());
+            loadedEntries.push_back(AZStd::move(entry));
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (Entry& entry : loadedEntries)
+        {
+            AddToCrcLookup(entry);
+            const AZ::Uuid sourceGuid = entry.m_asset.m_sourceGuid;
+            m_entries.emplace(sourceGuid, AZStd::move(entry));
+        }
+        return true;
+    }
+
+    bool SourceAssetCrcIndex::Save()
+    {
+        if (m_indexFilePath.empty())
+        {
+            return true;
+        }
+
+        rapidjson::Document document(rapidjson::kObjectType);
+        auto& allocator = document.GetAllocator();
+        auto makeString = [&allocator](AZStd::string_view value)
+        {
+            return rapidjson::Value(value.data(), aznumeric_cast<rapidjson::SizeType>(value.size()), allocator);
+        };
+
+        // Entries in the checksum lookup are saved first, so that they win again over duplicates when loading.
+        rapidjson::Value assets(rapidjson::kArrayType);
+        auto addEntry = [&assets, &allocator, &makeString](const Entry& entry)
+        {
+            rapidjson::Value assetValue(rapidjson::kObjectType);
+            assetValue.AddMember("sourceGuid", makeString(entry.m_asset.m_sourceGuid.ToFixedString().c_str()), allocator);
+            assetValue.AddMember("sourceRelativePath", makeString(entry.m_asset.m_sourceAssetRelativePath.Native()), allocator);
+            assetValue.AddMember("sourceGlobalPath", makeString(entry.m_asset.m_sourceAssetGlobalPath.Native()), allocator);
+            assetValue.AddMember("modificationTime", rapidjson::Value(entry.m_modificationTime), allocator);
+            assetValue.AddMember("crc", rapidjson::Value(static_cast<AZ::u32>(entry.m_crc)), allocator);
+            assets.PushBack(assetValue, allocator);
+        };
+        for (const auto& [crc, sourceGuid] : m_sourceGuidsByCrc)
+        {
+            addEntry(m_entries.at(sourceGuid));
+        }
+        for (const auto& [sourceGuid, entry] : m_entries)
+        {
+            if (auto sourceGuidIt = m_sourceGuidsByCrc.find(entry.m_crc); sourceGuidIt == m_sourceGuidsByCrc.end() || sourceGuidIt->second != sourceGuid)
+            {
+                addEntry(entry);
+            }
+        }
+        document.AddMember("version", rapidjson::Value(IndexFileVersion), allocator);
+        document.AddMember("assets", assets, allocator);
+
+        // Write to a unique temporary file first, so that a concurrent editor session never reads a partially written index.
+        const AZ::IO::Path tempPath = m_indexFilePath.Native() + "." + AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str();
+        if (!AZ::JsonSerializationUtils::WriteJsonFile(document, tempPath.Native()).IsSuccess())
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        if (!AZ::IO::SystemFile::Rename(tempPath.c_str(), m_indexFilePath.c_str(), true))
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        m_dirty = false;
+        return true;
+    }
+} // namespace ROS2::Utils
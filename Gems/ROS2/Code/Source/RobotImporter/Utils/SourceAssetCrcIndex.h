@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include "SourceAssetsStorage.h"
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/conditional_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzToolsFramework/API/EditorAssetSystemAPI.h>
+
+namespace ROS2::Utils
+{
+    //! Index of the checksums of all source assets which can be matched with meshes and textures referenced by URDF/SDF files,
+    //! @see GetFileCRC and GetInterestingSourceAssetsCRC.
+    //! The index is persisted next to the asset database, so that only source assets modified since the previous editor
+    //! session have their checksums computed again. It is refreshed from the asset database in a background thread, and
+    //! kept up to date with notifications of the Asset Processor in between.
+    class SourceAssetCrcIndex : private AzToolsFramework::AssetSystemBus::Handler
+    {
+    public:
+        AZ_RTTI(SourceAssetCrcIndex, "{6C0A5E4B-93D2-4E8A-B2F1-0F4C8A7D3E21}");
+
+        //! Source asset with the checksum of its file and the modification time of the file when it was computed.
+        struct Entry
+        {
+            AvailableAsset m_asset;
+            AZ::u64 m_modificationTime = 0;
+            AZ::Crc32 m_crc;
+        };
+        using Entries = AZStd::unordered_map<AZ::Uuid, Entry>;
+
+        //! @param indexFilePath file to persist the index in, the index is only kept in memory if it is empty.
+        explicit SourceAssetCrcIndex(AZ::IO::PathView indexFilePath);
+        virtual ~SourceAssetCrcIndex();
+
+        //! @return the default location of the index file, next to the asset database of the project.
+        static AZ::IO::Path GetDefaultIndexFilePath();
+
+        //! Start a refresh of the index from the asset database in the background, unless one is already running.
+        void RequestRefresh();
+
+        //! Find a source asset with the given checksum. Waits for the first refresh of the index to finish.
+        //! @return the source asset, or an empty optional if no source asset has this checksum.
+        AZStd::optional<AvailableAsset> Find(AZ::Crc32 crc);
+
+        //! @return all source assets by checksum. Waits for the first refresh of the index to finish.
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetAvailableAssets();
+
+        //! Query the asset database for source assets with supported extensions.
+        //! @param cancelled optional flag, which stops the query when set.
+        //! @return source assets in the order of the asset database, or an error if the database cannot be queried.
+        static AZ::Outcome<AZStd::vector<AvailableAsset>, AZStd::string> QueryAssetDatabase(const AZStd::atomic_bool* cancelled = nullptr);
+
+        //! Compute the checksums of source assets.
+        //! @param assets source assets to compute the checksums of.
+        //! @param previousEntries entries of an earlier scan, reused for files that were not modified since.
+        //! @param cancelled optional flag, which stops the computation when set.
+        //! @return entries of the source assets which have a checksum, in the order of assets, or an error if cancelled.
+        static AZ::Outcome<AZStd::vector<Entry>, AZStd::string> ComputeEntries(
+            const AZStd::vector<AvailableAsset>& assets, const Entries& previousEntries, const AZStd::atomic_bool* cancelled = nullptr);
+
+        //! Scan the asset database for source assets with supported extensions, computing their checksums.
+        //! @param previousEntries entries of an earlier scan, reused for files that were not modified since.
+        //! @param cancelled optional flag, which stops the scan when set.
+        //! @return entries of all source assets, in the order of the asset database, or an error if the scan did not complete.
+        static AZ::Outcome<AZStd::vector<Entry>, AZStd::string> ScanAssetDatabase(
+            const Entries& previousEntries, const AZStd::atomic_bool* cancelled = nullptr);
+
+    protected:
+        //! Query the source assets to index in a refresh, called on the refresh thread.
+        //! @return source assets, or an error to keep the current entries of the index.
+        virtual AZ::Outcome<AZStd::vector<AvailableAsset>, AZStd::string> QuerySourceAssets();
+
+        //! Stop a running refresh and wait for its thread to finish.
+        //! Derived classes overriding QuerySourceAssets call this in their destructor.
+        void CancelRefresh();
+
+    private:
+        // AzToolsFramework::AssetSystemBus::Handler overrides ...
+        void SourceFileChanged(AZStd::string relativePath, AZStd::string scanFolder, AZ::Uuid sourceUUID) override;
+        void SourceFileRemoved(AZStd::string relativePath, AZStd::string scanFolder, AZ::Uuid sourceUUID) override;
+
+        void Refresh();
+        void WaitForFirstRefresh();
+
+        //! Add the entry to the checksum lookup, unless another source asset with the same checksum is already there.
+        void AddToCrcLookup(const Entry& entry);
+
+        //! Replace or remove the entry of a source asset, m_mutex must be locked.
+        //! @param entry the new entry, or an empty optional to remove the source asset.
+        void ApplyChange(const AZ::Uuid& sourceGuid, AZStd::optional<Entry> entry);
+
+        bool Load();
+        bool Save();
+
+        AZ::IO::Path m_indexFilePath;
+        AZStd::unordered_set<AZStd::string> m_supportedExtensions; //!< Lower case, with the leading dot
+
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_refreshedCondition;
+        bool m_refreshed = false; //!< Set once the first refresh finished, guarded by m_mutex
+        bool m_dirty = false; //!< Set when entries changed since the index was saved, guarded by m_mutex
+        Entries m_entries; //!< Guarded by m_mutex
+        AZStd::unordered_map<AZ::Crc32, AZ::Uuid> m_sourceGuidsByCrc; //!< Guarded by m_mutex
+
+        //! Changes notified while a refresh scans the asset database, applied again over the scanned entries.
+        //! Guarded by m_mutex.
+        AZStd::vector<AZStd::pair<AZ::Uuid, AZStd::optional<Entry>>> m_changesDuringRefresh;
+        bool m_recordChanges = false; //!< Set while a refresh scans, guarded by m_mutex
+
+        AZStd::atomic_bool m_refreshing{ false };
+        AZStd::atomic_bool m_cancelRefresh{ false };
+        AZStd::thread m_refreshThread;
+    };
+
+    using SourceAssetCrcIndexInterface = AZ::Interface<SourceAssetCrcIndex>;
+} // namespace ROS2::Utils
@@ -7,14 +7,17 @@
  */
 
 #include "SourceAssetsStorage.h"
+#include "AssetPathResolver.h"
 #include "AzCore/Outcome/Outcome.h"
 #include "RobotImporterUtils.h"
+#include "SourceAssetCrcIndex.h"
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Serialization/Json/JsonImporter.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
@@ -201,89 +204,42 @@ namespace ROS2::Utils
             return foundAsset;
         }
 
-        AZ_Printf("GetAvailableAssetInfo", "Found asset:");
-        AZ_Printf("GetAvailableAssetInfo", "\tm_sourceAssetRelativePath  : %s", foundAsset.m_sourceAssetRelativePath.c_str());
-        AZ_Printf("GetAvailableAssetInfo", "\tm_sourceAssetGlobalPath    : %s", foundAsset.m_sourceAssetGlobalPath.c_str());
-        AZ_Printf("GetAvailableAssetInfo", "\tm_productAssetRelativePath : %s", foundAsset.m_productAssetRelativePath.c_str());
-        AZ_Printf("GetAvailableAssetInfo", "\tm_sourceGuid               : %s", foundAsset.m_sourceGuid.ToString<AZStd::string>().c_str());
+        AZ_Trace(
+            "GetAvailableAssetInfo",
+            "Found asset %s (%s)",
+            foundAsset.m_sourceAssetGlobalPath.c_str(),
+            foundAsset.m_sourceGuid.ToString<AZStd::string>().c_str());
 
         return foundAsset;
     }
 
     AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC()
     {
-        // connect to database API
-        const AZStd::vector<AZStd::string> InterestingExtensions = GetSupportedExtensions();
-        AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
+        if (auto* sourceAssetCrcIndex = SourceAssetCrcIndexInterface::Get())
+        {
+            return sourceAssetCrcIndex->GetAvailableAssets();
+        }
 
-        AzToolsFramework::AssetDatabase::AssetDatabaseConnection assetDatabaseConnection;
-        if (!assetDatabaseConnection.OpenDatabase())
+        AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets;
+        auto scanOutcome = SourceAssetCrcIndex::ScanAssetDatabase({});
+        if (!scanOutcome.IsSuccess())
         {
-            AZ_Warning("GetInterestingSourceAssetsCRC", false, "Cannot open database");
-            return {};
+            AZ_Warning("GetInterestingSourceAssetsCRC", false, "%s", scanOutcome.GetError().c_str());
+            return availableAssets;
         }
-        auto callback = [&availableAssets](AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry)
+        size_t duplicatesCount = 0;
+        for (auto& entry : scanOutcome.GetValue())
         {
-            using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
-            AvailableAsset foundAsset;
-            foundAsset.m_sourceGuid = entry.m_sourceGuid;
-
-            using AssetSysReqBus = AzToolsFramework::AssetSystemRequestBus;
-
-            // get source asset info
-            bool sourceAssetFound{ false };
-            AZ::Data::AssetInfo assetInfo;
-            AZStd::string watchFolder;
-            AssetSysReqBus::BroadcastResult(
-                sourceAssetFound, &AssetSysReqBus::Events::GetSourceInfoBySourceUUID, entry.m_sourceGuid, assetInfo, watchFolder);
-            if (!sourceAssetFound)
+            if (!availableAssets.emplace(entry.m_crc, AZStd::move(entry.m_asset)).second)
             {
-                AZ_Warning("GetInterestingSourceAssetsCRC", false, "Cannot find source asset info for %s", entry.ToString().c_str());
-                return true;
+                ++duplicatesCount;
             }
-
-            const auto fullSourcePath = AZ::IO::Path(watchFolder) / AZ::IO::Path(assetInfo.m_relativePath);
-
-            foundAsset.m_sourceAssetRelativePath = assetInfo.m_relativePath;
-            foundAsset.m_sourceAssetGlobalPath = fullSourcePath.String();
-
-            AZ::Crc32 crc = Utils::GetFileCRC(foundAsset.m_sourceAssetGlobalPath);
-            if (crc == AZ::Crc32(0))
-            {
-                AZ_Warning(
-                    "GetInterestingSourceAssetsCRC", false, "Zero CRC for source asset %s", foundAsset.m_sourceAssetGlobalPath.c_str());
-                return true;
-            }
-            AZ_Printf("GetInterestingSourceAssetsCRC", "Found asset:");
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_sourceAssetRelativePath  : %s", foundAsset.m_sourceAssetRelativePath.c_str());
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_sourceAssetGlobalPath    : %s", foundAsset.m_sourceAssetGlobalPath.c_str());
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tm_productAssetRelativePath : %s", foundAsset.m_productAssetRelativePath.c_str());
-            AZ_Printf(
-                "GetInterestingSourceAssetsCRC",
-                "\tm_sourceGuid               : %s",
-                foundAsset.m_sourceGuid.ToString<AZStd::string>().c_str());
-            AZ_Printf("GetInterestingSourceAssetsCRC", "\tcrc                        : %d", crc);
-
-            auto availableAssetIt = availableAssets.find(crc);
-            if (availableAssetIt != availableAssets.end())
-            {
-                AZ_Warning(
-                    "GetInterestingSourceAssetsCRC", false, "Asset already in database : %s ", foundAsset.m_sourceAssetGlobalPath.c_str());
-                AZ_Warning(
-                    "GetInterestingSourceAssetsCRC", false, "Found asset : %s ", availableAssetIt->second.m_sourceAssetGlobalPath.c_str());
-            }
-            else
-            {
-                availableAssets.insert({ crc, foundAsset });
-            }
-            return true;
-        };
-
-        for (auto& extension : InterestingExtensions)
-        {
-            assetDatabaseConnection.QuerySourceLikeSourceName(
-                extension.c_str(), AzToolsFramework::AssetDatabase::AssetDatabaseConnection::LikeType::EndsWith, callback);
         }
+        AZ_Warning(
+            "GetInterestingSourceAssetsCRC",
+            duplicatesCount == 0,
+            "%zu source assets have the same checksum as another source asset and are not used.",
+            duplicatesCount);
         return availableAssets;
     }
 
@@ -307,7 +263,9 @@ namespace ROS2::Utils
             return urdfAssetMap;
         }
 
+        const auto copyStart = AZStd::chrono::steady_clock::now();
         AZStd::unordered_map<AZ::IO::Path, unsigned int> duplicatedFilenames;
+        MeshSceneCache meshSceneCache;
         for (auto& [unresolvedFileName, urdfAsset] : urdfAssetMap)
         {
             if (duplicatedFilenames.contains(unresolvedFileName))
@@ -318,10 +276,24 @@ namespace ROS2::Utils
             {
                 duplicatedFilenames[unresolvedFileName] = 0;
             }
-            CopyReferencedAsset(unresolvedFileName, destDirectory.GetValue(), urdfAsset, duplicatedFilenames[unresolvedFileName]);
+            CopyReferencedAsset(
+                unresolvedFileName,
+                destDirectory.GetValue(),
+                urdfAsset,
+                duplicatedFilenames[unresolvedFileName],
+                AZ::IO::FileIOBase::GetInstance(),
+                &meshSceneCache);
         }
         Utils::RemoveTmpDir(destDirectory.GetValue().importDirectoryTmp);
 
+        const AZStd::chrono::duration<double> copyDuration = AZStd::chrono::steady_clock::now() - copyStart;
+        AZ_Printf(
+            "CopyAssetForURDF",
+            "Copied %zu referenced assets in %.3f s, loading %zu mesh scenes.\n",
+            urdfAssetMap.size(),
+            copyDuration.count(),
+            meshSceneCache.GetSceneLoadCount());
+
         return urdfAssetMap;
     }
 
@@ -331,19 +303,30 @@ namespace ROS2::Utils
         const SdfAssetBuilderSettings& sdfBuilderSettings)
     {
         auto amentPrefixPath = Utils::GetAmentPrefixPath();
+        auto resolvedPaths = AssetPathResolver::Get().ResolveAssetPaths(
+            assetFilenames, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
 
         UrdfAssetMap urdfToAsset;
-        for (const auto& [assetPath, assetReferenceType] : assetFilenames)
+        for (auto& [assetPath, resolvedPath] : resolvedPaths)
         {
             Utils::UrdfAsset asset;
             asset.m_urdfPath = assetPath;
-            asset.m_resolvedUrdfPath =
-                Utils::ResolveAssetPath(asset.m_urdfPath, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
-            asset.m_urdfFileCRC = Utils::GetFileCRC(asset.m_resolvedUrdfPath);
+            asset.m_resolvedUrdfPath = AZStd::move(resolvedPath.m_resolvedPath);
+            asset.m_urdfFileCRC = resolvedPath.m_fileCRC;
             urdfToAsset.emplace(assetPath, AZStd::move(asset));
         }
 
-        if (!urdfToAsset.empty())
+        if (auto* sourceAssetCrcIndex = SourceAssetCrcIndexInterface::Get(); sourceAssetCrcIndex && !urdfToAsset.empty())
+        {
+            for (auto& [assetPath, asset] : urdfToAsset)
+            {
+                if (auto foundSourceAsset = sourceAssetCrcIndex->Find(asset.m_urdfFileCRC))
+                {
+                    asset.m_availableAssetInfo = AZStd::move(*foundSourceAsset);
+                }
+            }
+        }
+        else if (!urdfToAsset.empty())
         {
             AZStd::unordered_map<AZ::Crc32, AvailableAsset> availableAssets = Utils::GetInterestingSourceAssetsCRC();
 
@@ -362,7 +345,8 @@ namespace ROS2::Utils
         return urdfToAsset;
     }
 
-    bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const AZ::IO::Path& assetInfoFile, const bool collider, const bool visual)
+    //! Import settings used for meshes of robots.
+    AZ::SceneAPI::SceneImportSettings GetSceneImportSettings(const AZ::IO::Path& sourceAssetPath)
     {
         // Start with a default set of import settings.
         AZ::SceneAPI::SceneImportSettings importSettings;
@@ -376,27 +360,19 @@ namespace ROS2::Utils
             importSettings.m_optimizeScene = true;
             importSettings.m_optimizeMeshes = true;
         }
+        return importSettings;
+    }
 
-        // Set the import settings into the settings registry.
-        // This needs to happen before calling LoadScene so that the AssImp import settings are applied to the scene being
-        // read into memory. These settings affect the list of scene nodes referenced by the MeshGroup and PhysXGroup settings,
-        // so it's important to apply them here to get the proper node lists.
-        if (AZ::SettingsRegistryInterface* settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry)
-        {
-            settingsRegistry->SetObject(AZ::SceneAPI::DataTypes::IImportGroup::SceneImportSettingsRegistryKey, importSettings);
-        }
-
+    //! Replace the default configuration in the manifest of the scene and save it to the assetinfo file.
+    bool WriteSceneManifest(
+        AZ::SceneAPI::Containers::Scene& scene,
+        const AZ::IO::Path& sourceAssetPath,
+        const AZ::IO::Path& assetInfoFile,
+        const bool collider,
+        const bool visual)
+    {
         AZ_Printf("CreateSceneManifest", "Creating manifest for asset %s at : %s ", sourceAssetPath.c_str(), assetInfoFile.c_str());
-        AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> scene;
-        AZ::SceneAPI::Events::SceneSerializationBus::BroadcastResult(
-            scene, &AZ::SceneAPI::Events::SceneSerialization::LoadScene, sourceAssetPath.c_str(), AZ::Uuid::CreateNull(), "");
-        if (!scene)
-        {
-            AZ_Error("CreateSceneManifest", false, "Error loading collider. Invalid scene: %s", sourceAssetPath.c_str());
-            return false;
-        }
-
-        AZ::SceneAPI::Containers::SceneManifest& manifest = scene->GetManifest();
+        AZ::SceneAPI::Containers::SceneManifest& manifest = scene.GetManifest();
         auto valueStorage = manifest.GetValueStorage();
         if (valueStorage.empty())
         {
@@ -421,7 +397,7 @@ namespace ROS2::Utils
         // Create an entry for the import settings. This will contain default settings for most mesh files,
         // but will enable the import optimization settings for OBJ files.
         auto sceneDataImportGroup = AZStd::make_shared<AZ::SceneAPI::SceneData::ImportGroup>();
-        sceneDataImportGroup->SetImportSettings(importSettings);
+        sceneDataImportGroup->SetImportSettings(GetSceneImportSettings(sourceAssetPath));
         manifest.AddEntry(sceneDataImportGroup);
 
         if (visual)
@@ -430,7 +406,7 @@ namespace ROS2::Utils
                 AZStd::make_shared<AZ::SceneAPI::SceneData::MeshGroup>();
 
             // select all nodes to this mesh group
-            AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene->GetGraph(), sceneDataMeshGroup->GetSceneNodeSelectionList());
+            AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene.GetGraph(), sceneDataMeshGroup->GetSceneNodeSelectionList());
 
             // enable auto-generation of UVs
             sceneDataMeshGroup->GetRuleContainer().AddRule(AZStd::make_shared<AZ::SceneAPI::SceneData::UVsRule>());
@@ -445,7 +421,7 @@ namespace ROS2::Utils
             physxDataMeshGroup->SetMeshExportMethod(PhysX::Pipeline::MeshExportMethod::Convex);
 
             // select all nodes to this mesh group
-            AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene->GetGraph(), physxDataMeshGroup->GetSceneNodeSelectionList());
+            AZ::SceneAPI::Utilities::SceneGraphSelector::SelectAll(scene.GetGraph(), physxDataMeshGroup->GetSceneNodeSelectionList());
 
             manifest.AddEntry(physxDataMeshGroup);
         }
@@ -455,7 +431,7 @@ namespace ROS2::Utils
         AZ::SceneAPI::Events::AssetImportRequestBus::BroadcastResult(
             result,
             &AZ::SceneAPI::Events::AssetImportRequest::UpdateManifest,
-            *scene,
+            scene,
             AZ::SceneAPI::Events::AssetImportRequest::ManifestAction::Update,
             AZ::SceneAPI::Events::AssetImportRequest::RequestingApplication::Editor);
 
@@ -465,12 +441,133 @@ namespace ROS2::Utils
             return false;
         }
 
-        scene->GetManifest().SaveToFile(assetInfoFile.Native());
+        scene.GetManifest().SaveToFile(assetInfoFile.Native());
         AZ_Printf("CreateSceneManifest", "Saving scene manifest to %s\n", assetInfoFile.c_str());
 
         return true;
     }
 
+    AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> MeshSceneCache::GetScene(const AZ::IO::Path& sourceMeshAssetPath)
+    {
+        const AZ::IO::Path normalizedPath = sourceMeshAssetPath.LexicallyNormal();
+        if (auto it = m_scenes.find(normalizedPath); it != m_scenes.end() && !it->second.m_released)
+        {
+            return it->second.m_scene;
+        }
+
+        // Set the import settings into the settings registry.
+        // This needs to happen before calling LoadScene so that the AssImp import settings are applied to the scene being
+        // read into memory. These settings affect the list of scene nodes referenced by the MeshGroup and PhysXGroup settings,
+        // so it's important to apply them here to get the proper node lists.
+        if (AZ::SettingsRegistryInterface* settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry)
+        {
+            settingsRegistry->SetObject(
+                AZ::SceneAPI::DataTypes::IImportGroup::SceneImportSettingsRegistryKey, GetSceneImportSettings(normalizedPath));
+        }
+
+        CachedScene& cachedScene = m_scenes[normalizedPath];
+        cachedScene.m_released = false;
+        ++m_sceneLoadCount;
+        AZ::SceneAPI::Events::SceneSerializationBus::BroadcastResult(
+            cachedScene.m_scene, &AZ::SceneAPI::Events::SceneSerialization::LoadScene, normalizedPath.c_str(), AZ::Uuid::CreateNull(), "");
+        AZ_Error("MeshSceneCache", cachedScene.m_scene, "Error loading mesh. Invalid scene: %s", normalizedPath.c_str());
+        return cachedScene.m_scene;
+    }
+
+    const AZStd::unordered_set<AZ::IO::Path>& MeshSceneCache::GetTextureAssets(const AZ::IO::Path& sourceMeshAssetPath)
+    {
+        // The texture list is kept after the scene is released, so it is looked up before loading the scene.
+        const AZ::IO::Path normalizedPath = sourceMeshAssetPath.LexicallyNormal();
+        if (auto it = m_scenes.find(normalizedPath); it != m_scenes.end() && it->second.m_textureAssets)
+        {
+            return *it->second.m_textureAssets;
+        }
+
+        const AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> scene = GetScene(normalizedPath);
+        CachedScene& cachedScene = m_scenes[normalizedPath];
+        AZStd::unordered_set<AZ::IO::Path>& assetsFilepaths = cachedScene.m_textureAssets.emplace();
+        if (!scene)
+        {
+            return assetsFilepaths;
+        }
+
+        // Look for material files
+        static const AZStd::array<AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType, 9> allTextureTypes{
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Diffuse,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Specular,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Bump,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Normal,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Metallic,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Roughness,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::AmbientOcclusion,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Emissive,
+            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::BaseColor
+        };
+        auto view =
+            AZ::SceneAPI::Containers::MakeDerivedFilterView<AZ::SceneAPI::DataTypes::IMaterialData>(scene->GetGraph().GetContentStorage());
+        for (const auto& material : view)
+        {
+            for (auto textureType : allTextureTypes)
+            {
+                if (const AZ::IO::Path filePath(material.GetTexture(textureType)); !filePath.empty())
+                {
+                    assetsFilepaths.emplace(filePath);
+                }
+            }
+        }
+        return assetsFilepaths;
+    }
+
+    bool MeshSceneCache::CreateSceneManifest(
+        const AZ::IO::Path& sourceAssetPath, const AZ::IO::Path& assetInfoFile, bool collider, bool visual)
+    {
+        // A mesh used by several references gets a single manifest with the products of all of them.
+        const AZ::IO::Path normalizedAssetInfoFile = assetInfoFile.LexicallyNormal();
+        if (auto it = m_manifests.find(normalizedAssetInfoFile); it != m_manifests.end())
+        {
+            if ((it->second.m_collider || !collider) && (it->second.m_visual || !visual))
+            {
+                return true;
+            }
+            collider = collider || it->second.m_collider;
+            visual = visual || it->second.m_visual;
+        }
+
+        const AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> scene = GetScene(sourceAssetPath);
+        if (!scene)
+        {
+            return false;
+        }
+
+        if (!WriteSceneManifest(*scene, sourceAssetPath, normalizedAssetInfoFile, collider, visual))
+        {
+            return false;
+        }
+        m_manifests.insert_or_assign(normalizedAssetInfoFile, WrittenManifest{ collider, visual });
+        return true;
+    }
+
+    void MeshSceneCache::ReleaseScene(const AZ::IO::Path& sourceMeshAssetPath)
+    {
+        // Scenes which failed to load stay cached as failures, so that they are not loaded again.
+        if (auto it = m_scenes.find(sourceMeshAssetPath.LexicallyNormal()); it != m_scenes.end() && it->second.m_scene)
+        {
+            it->second.m_scene.reset();
+            it->second.m_released = true;
+        }
+    }
+
+    AZStd::size_t MeshSceneCache::GetSceneLoadCount() const
+    {
+        return m_sceneLoadCount;
+    }
+
+    bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const AZ::IO::Path& assetInfoFile, const bool collider, const bool visual)
+    {
+        MeshSceneCache meshSceneCache;
+        return meshSceneCache.CreateSceneManifest(sourceAssetPath, assetInfoFile, collider, visual);
+    }
+
     bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const bool collider, const bool visual)
     {
         return CreateSceneManifest(sourceAssetPath, sourceAssetPath.Native() + ".assetinfo", collider, visual);
@@ -486,12 +583,13 @@ namespace ROS2::Utils
         }
 
         auto amentPrefixPath = Utils::GetAmentPrefixPath();
+        auto resolvedPaths = AssetPathResolver::Get().ResolveAssetPaths(
+            assetFilenames, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
         for (const auto& [unresolvedFileName, assetReferenceType] : assetFilenames)
         {
             Utils::UrdfAsset asset;
             asset.m_urdfPath = unresolvedFileName;
-            asset.m_resolvedUrdfPath =
-                Utils::ResolveAssetPath(unresolvedFileName, AZ::IO::PathView(urdfFilename), amentPrefixPath, sdfBuilderSettings);
+            asset.m_resolvedUrdfPath = AZStd::move(resolvedPaths[unresolvedFileName].m_resolvedPath);
             asset.m_urdfFileCRC = AZ::Crc32();
             asset.m_assetReferenceType = assetReferenceType;
             asset.m_unresolvedFileName = unresolvedFileName;
@@ -559,7 +657,8 @@ namespace ROS2::Utils
         const ImportedAssetsDest& importedAssetsDest,
         Utils::UrdfAsset& urdfAsset,
         unsigned int duplicationCounter,
-        AZ::IO::FileIOBase* fileIO)
+        AZ::IO::FileIOBase* fileIO,
+        MeshSceneCache* meshSceneCache)
     {
         if (urdfAsset.m_resolvedUrdfPath.empty())
         {
@@ -605,16 +704,20 @@ namespace ROS2::Utils
                     (urdfAsset.m_assetReferenceType & ReferencedAssetType::ColliderMesh) == ReferencedAssetType::ColliderMesh;
                 const bool isMeshFile = (needsVisual || needsCollider);
 
+                // The manifest and the list of textures are both read from the scene of the temporary mesh file.
+                MeshSceneCache temporaryMeshSceneCache;
+                MeshSceneCache& sceneCache = meshSceneCache ? *meshSceneCache : temporaryMeshSceneCache;
+
                 // if the asset is a mesh, create asset info at destination location using the temporary mesh file
                 const bool assetInfoOk =
-                    isMeshFile ? CreateSceneManifest(targetPathAssetTmp, targetPathAssetInfo, needsCollider, needsVisual) : true;
+                    isMeshFile ? sceneCache.CreateSceneManifest(targetPathAssetTmp, targetPathAssetInfo, needsCollider, needsVisual) : true;
 
                 if (assetInfoOk)
                 {
                     // copy additional assets such as textures directly to destination location
                     if (isMeshFile)
                     {
-                        const auto& meshTextureAssets = Utils::GetMeshTextureAssets(targetPathAssetTmp);
+                        const auto& meshTextureAssets = sceneCache.GetTextureAssets(targetPathAssetTmp);
                         for (const auto& unresolvedAssetPath : meshTextureAssets)
                         {
                             // Manifest returns local path in Project's directory temp folder
@@ -636,6 +739,9 @@ namespace ROS2::Utils
                                 urdfAsset.m_copyStatus = CopyStatus::Failed;
                             }
                         }
+
+                        // The manifest and the texture list were the only consumers of the temporary mesh file's scene.
+                        sceneCache.ReleaseScene(targetPathAssetTmp);
                     }
 
                     // move asset file from temporary location to destination location
@@ -676,42 +782,8 @@ namespace ROS2::Utils
 
     AZStd::unordered_set<AZ::IO::Path> GetMeshTextureAssets(const AZ::IO::Path& sourceMeshAssetPath)
     {
-        AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> scene;
-        AZ::SceneAPI::Events::SceneSerializationBus::BroadcastResult(
-            scene, &AZ::SceneAPI::Events::SceneSerialization::LoadScene, sourceMeshAssetPath.c_str(), AZ::Uuid::CreateNull(), "");
-        if (!scene)
-        {
-            AZ_Error("GetMeshTextureAssets", false, "Error loading mesh assets. Invalid scene: %s", sourceMeshAssetPath.c_str());
-            return AZStd::unordered_set<AZ::IO::Path>();
-        }
-
-        AZStd::unordered_set<AZ::IO::Path> assetsFilepaths;
-
-        // Look for material files
-        static const AZStd::array<AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType, 9> allTextureTypes{
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Diffuse,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Specular,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Bump,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Normal,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Metallic,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Roughness,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::AmbientOcclusion,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::Emissive,
-            AZ::SceneAPI::DataTypes::IMaterialData::TextureMapType::BaseColor
-        };
-        auto view =
-            AZ::SceneAPI::Containers::MakeDerivedFilterView<AZ::SceneAPI::DataTypes::IMaterialData>(scene->GetGraph().GetContentStorage());
-        for (const auto& material : view)
-        {
-            for (auto textureType : allTextureTypes)
-            {
-                if (const AZ::IO::Path filePath(material.GetTexture(textureType)); !filePath.empty())
-                {
-                    assetsFilepaths.emplace(filePath);
-                }
-            }
-        }
-        return assetsFilepaths;
+        MeshSceneCache meshSceneCache;
+        return meshSceneCache.GetTextureAssets(sourceMeshAssetPath);
     }
 
     AzFramework::AssetSystem::AssetStatus FlushIOOfAsset(const AZ::IO::Path& path)
@@ -17,9 +17,16 @@
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 
+namespace AZ::SceneAPI::Containers
+{
+    class Scene;
+} // namespace AZ::SceneAPI::Containers
+
 namespace ROS2
 {
     struct SdfAssetBuilderSettings;
@@ -90,6 +97,62 @@ namespace ROS2::Utils
         AvailableAsset m_availableAssetInfo;
     };
 
+    //! Scenes of mesh source assets loaded during a single import.
+    //! Creating the scene manifest and listing the textures of a mesh both need its scene, which is expensive to load.
+    //! With the cache every mesh file is loaded once per import, no matter how many links, visuals and colliders refer to it.
+    //! Scenes are kept until they are released or the cache is destroyed, while the texture lists and written manifests
+    //! extracted from them are kept for the whole import. The cache is not thread safe, an import uses it from a single thread.
+    class MeshSceneCache
+    {
+    public:
+        //! Get the scene of a mesh, loading it on first use with the import settings used for robot meshes.
+        //! @param sourceMeshAssetPath - global path to the mesh file
+        //! @returns the scene, or nullptr if it cannot be loaded
+        AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> GetScene(const AZ::IO::Path& sourceMeshAssetPath);
+
+        //! Get files referenced by materials of a mesh, see GetMeshTextureAssets.
+        //! @param sourceMeshAssetPath - global path to the mesh file
+        //! @returns list of file paths referenced in the scene, empty if the scene cannot be loaded
+        const AZStd::unordered_set<AZ::IO::Path>& GetTextureAssets(const AZ::IO::Path& sourceMeshAssetPath);
+
+        //! Creates side-car file (.assetinfo) that configures the imported scene, see Utils::CreateSceneManifest.
+        //! A manifest already written during this import is kept if it covers the requested products, otherwise it is
+        //! written again for both the earlier and the requested products.
+        //! @param sourceAssetPath - global path to source asset
+        //! @param assetInfoFile - global path to assetInfo file to create
+        //! @param collider - create assetinfo section for collider product asset
+        //! @param visual - create assetinfo section for visual mesh
+        //! @returns true if succeed
+        bool CreateSceneManifest(const AZ::IO::Path& sourceAssetPath, const AZ::IO::Path& assetInfoFile, bool collider, bool visual);
+
+        //! Release the scene of a mesh once all its consumers have run, keeping the texture list extracted from it.
+        //! The scene is loaded again if it is needed after all, e.g. for a manifest with more products.
+        //! @param sourceMeshAssetPath - global path to the mesh file
+        void ReleaseScene(const AZ::IO::Path& sourceMeshAssetPath);
+
+        //! Get the number of scenes loaded so far, counting reloads of released scenes.
+        AZStd::size_t GetSceneLoadCount() const;
+
+    private:
+        struct CachedScene
+        {
+            AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> m_scene;
+            bool m_released = false; //!< The scene was loaded and released, so it is loaded again on the next request
+            AZStd::optional<AZStd::unordered_set<AZ::IO::Path>> m_textureAssets; //!< Set on first request
+        };
+
+        //! Products a manifest was written for.
+        struct WrittenManifest
+        {
+            bool m_collider = false;
+            bool m_visual = false;
+        };
+
+        AZStd::unordered_map<AZ::IO::Path, CachedScene> m_scenes; //!< Scenes by normalized path of the mesh file
+        AZStd::unordered_map<AZ::IO::Path, WrittenManifest> m_manifests; //!< Manifests by normalized path of the assetinfo file
+        AZStd::size_t m_sceneLoadCount = 0;
+    };
+
     //! Structure contains paths to the temporary and destination directories for imported assets.
     struct ImportedAssetsDest
     {
@@ -109,7 +172,11 @@ namespace ROS2::Utils
     //! Function computes CRC32 on first kilobyte of file.
     AZ::Crc32 GetFileCRC(const AZ::IO::Path& filename);
 
+    //! Returns extensions of scene files supported by the Asset Processor, with the leading dot.
+    AZStd::vector<AZStd::string> GetSupportedExtensions();
+
     //! Compute CRC for every source mesh from the assets catalog.
+    //! Uses the SourceAssetCrcIndex when one is registered, so that checksums are not computed again for every import.
     //! @returns map where key is crc of source file and value is AvailableAsset.
     AZStd::unordered_map<AZ::Crc32, AvailableAsset> GetInterestingSourceAssetsCRC();
 
@@ -118,7 +185,7 @@ namespace ROS2::Utils
     //! Steps:
     //! - Functions resolves URDF filenames with `ResolveAssetPath`.
     //! - Files pointed by resolved URDF patches have their checksum computed `GetFileCRC`.
-    //! - Function scans all available O3DE assets by calling `GetInterestingSourceAssetsCRC`.
+    //! - Suitable source assets are looked up in the SourceAssetCrcIndex, or found by calling `GetInterestingSourceAssetsCRC`.
     //! - Suitable mapping to the O3DE asset is found by comparing the checksum of the file pointed by the URDF path and source asset.
     //! @param assetFilenames - list of the unresolved paths from the SDF/URDF file
     //! @param urdfFilename - filename of URDF file, used for resolvement
@@ -205,13 +272,15 @@ namespace ROS2::Utils
     //! @param urdfAsset - asset info. Will be modified.
     //! @param duplicationCounter - number indication the number of times the asset has been duplicated
     //! @param fileIO - instance to fileIO class
+    //! @param meshSceneCache - scenes loaded earlier in this import, a temporary cache is used if it is nullptr
     //! @returns status of the copy process
     CopyStatus CopyReferencedAsset(
         const AZ::IO::Path& unresolvedFileName,
         const ImportedAssetsDest& importedAssetsDest,
         Utils::UrdfAsset& urdfAsset,
         unsigned int duplicationCounter,
-        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance());
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance(),
+        MeshSceneCache* meshSceneCache = nullptr);
 
     //! Prepares temporary and final directory for imported assets.
     //! @param urdfFilename - path to URDF file (as a global path)
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "XacroExpansionCache.h"
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/sort.h>
+#include <RobotImporter/Utils/ContentHash.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+
+namespace ROS2::Utils::xacro
+{
+    XacroExpansionCache& XacroExpansionCache::Get()
+    {
+        static XacroExpansionCache cache(
+            []()
+            {
+                AZ::IO::FixedMaxPath cacheFolder;
+                if (auto* fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO && fileIO->ResolvePath(cacheFolder, "@user@/RobotImporter/XacroCache"))
+                {
+                    return AZ::IO::Path(cacheFolder);
+                }
+                return AZ::IO::Path();
+            }());
+        return cache;
+    }
+
+    XacroExpansionCache::XacroExpansionCache(AZ::IO::PathView cacheFolder)
+        : m_cacheFolder(cacheFolder)
+    {
+        if (!m_cacheFolder.empty() && !AZ::IO::SystemFile::Exists(m_cacheFolder.c_str()))
+        {
+            if (!AZ::IO::SystemFile::CreateDir(m_cacheFolder.c_str()))
+            {
+                AZ_Warning("ParseXacro", false, "Cannot create xacro cache folder '%s', using memory only.", m_cacheFolder.c_str());
+                m_cacheFolder.clear();
+            }
+        }
+    }
+
+    AZStd::string XacroExpansionCache::GetKey(const AZStd::string& filename, const Params& params, AZStd::string_view xacroExecutable) const
+    {
+        const AZ::IO::Path normalizedPath = AZ::IO::Path(filename).LexicallyNormal();
+        const auto contentHash = HashFile(normalizedPath);
+        if (!contentHash)
+        {
+            return {};
+        }
+
+        // $(find package) substitutions of xacro depend on the ament prefix path of the editor process.
+        AZ::u64 keyHash = HashString(normalizedPath.Native());
+        keyHash = HashString(xacroExecutable, keyHash);
+        keyHash = HashString(GetAmentPrefixPath(), keyHash);
+
+        // Params are unordered, sort the arguments so that equal params give equal keys.
+        AZStd::vector<AZStd::string> arguments;
+        arguments.reserve(params.size());
+        for (const auto& [name, value] : params)
+        {
+            arguments.push_back(name + ":=" + value);
+        }
+        AZStd::sort(arguments.begin(), arguments.end());
+        for (const auto& argument : arguments)
+        {
+            // Hash the terminating character as well, so that arguments can't run into each other.
+            keyHash = HashBytes(argument.c_str(), argument.size() + 1, keyHash);
+        }
+        return ToHexString(keyHash) + "_" + ToHexString(*contentHash);
+    }
+
+    AZ::IO::Path XacroExpansionCache::GetEntryPath(const AZStd::string& key) const
+    {
+        if (m_cacheFolder.empty())
+        {
+            return {};
+        }
+        return m_cacheFolder / (key + ".json");
+    }
+
+    bool XacroExpansionCache::IsValid(const Entry& entry) const
+    {
+        for (const auto& dependency : entry.m_dependencies)
+        {
+            const auto hash = HashFile(dependency.m_path);
+            if (!hash || *hash != dependency.m_hash)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZStd::optional<AZStd::string> XacroExpansionCache::Find(
+        const AZStd::string& filename, const Params& params, AZStd::string_view xacroExecutable)
+    {
+        const AZStd::string key = GetKey(filename, params, xacroExecutable);
+        if (key.empty())
+        {
+            return AZStd::nullopt;
+        }
+
+        Entry entry;
+        bool found = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+            if (auto it = m_entries.find(key); it != m_entries.end())
+            {
+                entry = it->second;
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            // The entry could have been stored in a previous editor session.
+            if (const AZ::IO::Path entryPath = GetEntryPath(key); !entryPath.empty() && LoadEntry(entryPath, entry))
+            {
+                found = true;
+                AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+                m_entries.emplace(key, entry);
+            }
+        }
+
+        if (!found || !IsValid(entry))
+        {
+            return AZStd::nullopt;
+        }
+        return AZStd::move(entry.m_urdf);
+    }
+
+    void XacroExpansionCache::Store(
+        const AZStd::string& filename,
+        const Params& params,
+        AZStd::string_view xacroExecutable,
+        const AZStd::string& urdf,
+        const AZStd::vector<AZ::IO::Path>& dependencies)
+    {
+        const AZStd::string key = GetKey(filename, params, xacroExecutable);
+        if (key.empty())
+        {
+            return;
+        }
+
+        Entry entry;
+        entry.m_urdf = urdf;
+        entry.m_dependencies.reserve(dependencies.size());
+        for (const auto& dependency : dependencies)
+        {
+            const auto hash = HashFile(dependency);
+            if (!hash)
+            {
+                // A dependency that can't be read can't be validated later, don't cache this expansion.
+                return;
+            }
+            entry.m_dependencies.push_back({ dependency, *hash });
+        }
+
+        if (const AZ::IO::Path entryPath = GetEntryPath(key); !entryPath.empty())
+        {
+            SaveEntry(entryPath, entry);
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+        m_entries.insert_or_assign(key, AZStd::move(entry));
+    }
+
+    void XacroExpansionCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+        m_entries.clear();
+    }
+
+    bool XacroExpansionCache::LoadEntry(const AZ::IO::Path& entryPath, Entry& entry) const
+    {
+        if (!AZ::IO::SystemFile::Exists(entryPath.c_str()))
+        {
+            return false;
+        }
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(entryPath.Native());
+        if (!readResult.IsSuccess())
+        {
+            return false;
+        }
+        // Entries can be truncated or written by another version of the importer, anything unexpected is a cache miss.
+        const rapidjson::Document& document = readResult.GetValue();
+        if (!document.IsObject() || !document.HasMember("dependencies") || !document["dependencies"].IsArray() ||
+            !document.HasMember("urdf") || !document["urdf"].IsString())
+        {
+            return false;
+        }
+
+        Entry loadedEntry;
+        for (const auto& dependency : document["dependencies"].GetArray())
+        {
+            if (!dependency.IsObject() || !dependency.HasMember("path") || !dependency["path"].IsString() ||
+                !dependency.HasMember("hash") || !dependency["hash"].IsUint64())
+            {
+                return false;
+            }
+            const auto& path = dependency["path"];
+            loadedEntry.m_dependencies.push_back(
+                { AZ::IO::Path(AZStd::string(path.GetString(), path.GetStringLength())), dependency["hash"].GetUint64() });
+        }
+        const auto& urdf = document["urdf"];
+        loadedEntry.m_urdf.assign(urdf.GetString(), urdf.GetStringLength());
+        entry = AZStd::move(loadedEntry);
+        return true;
+    }
+
+    bool XacroExpansionCache::SaveEntry(const AZ::IO::Path& entryPath, const Entry& entry) const
+    {
+        rapidjson::Document document(rapidjson::kObjectType);
+        auto& allocator = document.GetAllocator();
+        auto makeString = [&allocator](AZStd::string_view value)
+        {
+            return rapidjson::Value(value.data(), aznumeric_cast<rapidjson::SizeType>(value.size()), allocator);
+        };
+
+        rapidjson::Value dependencies(rapidjson::kArrayType);
+        for (const auto& dependency : entry.m_dependencies)
+        {
+            rapidjson::Value file(rapidjson::kObjectType);
+            file.AddMember("path", makeString(dependency.m_path.Native()), allocator);
+            file.AddMember("hash", rapidjson::Value(dependency.m_hash), allocator);
+            dependencies.PushBack(file, allocator);
+        }
+        document.AddMember("dependencies", dependencies, allocator);
+        document.AddMember("urdf", makeString(entry.m_urdf), allocator);
+
+        // Write to a unique temporary file first, so that a concurrent editor session never reads a partially written entry.
+        const AZ::IO::Path tempPath = entryPath.Native() + "." + AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str();
+        if (!AZ::JsonSerializationUtils::WriteJsonFile(document, tempPath.Native()).IsSuccess())
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        if (!AZ::IO::SystemFile::Rename(tempPath.c_str(), entryPath.c_str(), true))
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+} // namespace ROS2::Utils::xacro
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "XacroUtils.h"
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2::Utils::xacro
+{
+    //! Cache of URDF documents produced by the xacro executable, persisted on disk between editor sessions.
+    //! Entries are keyed by the xacro file path and content, the xacro arguments, the executable and the ament prefix path.
+    //! An entry stores the files included by the xacro file, as reported by 'xacro --deps', with the hashes of their
+    //! content, and is only used while none of them changed.
+    class XacroExpansionCache
+    {
+    public:
+        //! @return the cache shared by the process, persisted in the user folder of the project.
+        static XacroExpansionCache& Get();
+
+        //! @param cacheFolder folder to persist entries in, entries are only kept in memory if it is empty.
+        explicit XacroExpansionCache(AZ::IO::PathView cacheFolder);
+
+        //! Find the expansion of a xacro file.
+        //! @param filename path to the xacro file.
+        //! @param params arguments passed to xacro.
+        //! @param xacroExecutable path of the xacro executable.
+        //! @return the URDF document, or an empty optional on a cache miss.
+        AZStd::optional<AZStd::string> Find(const AZStd::string& filename, const Params& params, AZStd::string_view xacroExecutable);
+
+        //! Store the expansion of a xacro file.
+        //! @param filename path to the xacro file.
+        //! @param params arguments passed to xacro.
+        //! @param xacroExecutable path of the xacro executable.
+        //! @param urdf the URDF document produced by xacro.
+        //! @param dependencies files included while expanding the xacro file.
+        void Store(
+            const AZStd::string& filename,
+            const Params& params,
+            AZStd::string_view xacroExecutable,
+            const AZStd::string& urdf,
+            const AZStd::vector<AZ::IO::Path>& dependencies);
+
+        //! Drop all entries kept in memory, persisted entries are kept.
+        void Clear();
+
+    private:
+        struct Entry
+        {
+            //! A file the xacro file depends on, with the hash of its content.
+            struct FileHash
+            {
+                AZ::IO::Path m_path;
+                AZ::u64 m_hash = 0;
+            };
+
+            AZStd::string m_urdf;
+            AZStd::vector<FileHash> m_dependencies;
+        };
+
+        //! @return key of the expansion in the current state of the xacro file, or an empty string if it cannot be read.
+        AZStd::string GetKey(const AZStd::string& filename, const Params& params, AZStd::string_view xacroExecutable) const;
+        AZ::IO::Path GetEntryPath(const AZStd::string& key) const;
+        bool IsValid(const Entry& entry) const;
+
+        bool LoadEntry(const AZ::IO::Path& entryPath, Entry& entry) const;
+        bool SaveEntry(const AZ::IO::Path& entryPath, const Entry& entry) const;
+
+        AZ::IO::Path m_cacheFolder;
+
+        AZStd::mutex m_entriesMutex;
+        AZStd::unordered_map<AZStd::string, Entry> m_entries; //!< Entries used or stored by this process
+    };
+} // namespace ROS2::Utils::xacro
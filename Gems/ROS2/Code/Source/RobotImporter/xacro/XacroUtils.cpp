@@ -7,8 +7,10 @@
  */
 
 #include "XacroUtils.h"
+#include "XacroExpansionCache.h"
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/StringFunc/StringFunc.h>
 #include <AzCore/XML/rapidxml.h>
 #include <AzFramework/Process/ProcessCommunicator.h>
 #include <AzFramework/Process/ProcessWatcher.h>
@@ -18,11 +20,59 @@
 
 namespace ROS2::Utils::xacro
 {
+    namespace
+    {
+        //! @return command line parameters passing the file and its params to xacro.
+        AZStd::vector<AZStd::string> GetXacroParameters(const AZStd::string& filename, const Params& params)
+        {
+            AZStd::vector<AZStd::string> commandLineParameters{ filename };
+            for (const auto& param : params)
+            {
+                const AZStd::string& name{ param.first };
+                const AZStd::string& value{ param.second };
+                commandLineParameters.emplace_back(name + ":=" + value);
+            }
+            return commandLineParameters;
+        }
+
+        //! Ask xacro for the files included while expanding the xacro file.
+        //! @return absolute paths of the included files, or an empty optional if they can't be determined.
+        AZStd::optional<AZStd::vector<AZ::IO::Path>> GetXacroDependencies(
+            const AZ::IO::Path& xacroPath, const AZStd::string& filename, const Params& params)
+        {
+            AzFramework::ProcessLauncher::ProcessLaunchInfo processLaunchInfo;
+            processLaunchInfo.m_processExecutableString = xacroPath.Native();
+            AZStd::vector<AZStd::string> commandLineParameters{ "--deps" };
+            auto xacroParameters = GetXacroParameters(filename, params);
+            commandLineParameters.insert(commandLineParameters.end(), xacroParameters.begin(), xacroParameters.end());
+            processLaunchInfo.m_commandlineParameters.emplace<AZStd::vector<AZStd::string>>(AZStd::move(commandLineParameters));
+
+            AzFramework::ProcessOutput processOutput;
+            if (!AzFramework::ProcessWatcher::LaunchProcessAndRetrieveOutput(
+                    processLaunchInfo, AzFramework::ProcessCommunicationType::COMMUNICATOR_TYPE_STDINOUT, processOutput) ||
+                processOutput.HasError())
+            {
+                return AZStd::nullopt;
+            }
+
+            // xacro prints the included files on a single line, separated by spaces
+            AZStd::vector<AZ::IO::Path> dependencies;
+            const AZ::IO::Path baseDirectory = AZ::IO::Path(filename).ParentPath();
+            AZ::StringFunc::TokenizeVisitor(
+                processOutput.outputResult,
+                [&dependencies, &baseDirectory](AZStd::string_view dependency)
+                {
+                    dependencies.push_back((baseDirectory / dependency).LexicallyNormal());
+                },
+                " \t\r\n");
+            return dependencies;
+        }
+    } // namespace
+
     ExecutionOutcome ParseXacro(
         const AZStd::string& filename, const Params& params, const sdf::ParserConfig& parserConfig, const SdfAssetBuilderSettings& settings)
     {
         ExecutionOutcome outcome;
-        // test if xacro exists
         AZ::IO::Path xacroPath = "xacro";
         auto settingsRegistry = AZ::SettingsRegistry::Get();
         AZStd::string xacroExecutablePath;
@@ -37,84 +87,65 @@ namespace ROS2::Utils::xacro
             }
         }
 
-        AzFramework::ProcessLauncher::ProcessLaunchInfo processLaunchInfo;
-        processLaunchInfo.m_processExecutableString = xacroPath.Native();
-        processLaunchInfo.m_commandlineParameters.emplace<AZStd::vector<AZStd::string>>({ AZStd::string("--help") });
-        if (AZStd::unique_ptr<AzFramework::ProcessWatcher> xacroHelpProcess(AzFramework::ProcessWatcher::LaunchProcess(processLaunchInfo,
-            AzFramework::ProcessCommunicationType::COMMUNICATOR_TYPE_STDINOUT));
-            xacroHelpProcess != nullptr)
-        {
-            // 60 seconds is used as a cap on how long it should take to run the `xacro --help` command
-            // In reality this should take less than a second, but there has been a couple of occurrences
-            // where it takes over a second to run. 60 seconds is a fail fase value
-            constexpr AZStd::chrono::seconds helpCommandWaitTime{ 60 };
-
-            AZ::u32 exitCode{ AZStd::numeric_limits<AZ::u32>::max() };
-            xacroHelpProcess->WaitForProcessToExit(static_cast<AZ::u32>(helpCommandWaitTime.count()), &exitCode);
-            if (exitCode != 0)
-            {
-                const auto fullProcessCommand = AZStd::string::format("%s %s",
-                    processLaunchInfo.m_processExecutableString.c_str(),
-                    processLaunchInfo.GetCommandLineParametersAsString().c_str());
-                AZ_Warning(
-                    "ParseXacro",
-                    false,
-                    "Attempted to run validate xacro existence with command: %s",
-                    fullProcessCommand.c_str());
-                outcome.m_called = fullProcessCommand;
-                return outcome;
-            }
-        }
-
         AZ_Printf("ParseXacro", "xacro executable : %s \n", xacroPath.c_str());
         AZ_Printf("ParseXacro", "Convert xacro file : %s \n", filename.c_str());
-        // Clear out the processLanunchInfo structure
-        processLaunchInfo = {};
+        AzFramework::ProcessLauncher::ProcessLaunchInfo processLaunchInfo;
         processLaunchInfo.m_processExecutableString = xacroPath.Native();
-        processLaunchInfo.m_commandlineParameters.emplace<AZStd::vector<AZStd::string>>({ filename });
-        for (const auto& param : params)
-        {
-            const AZStd::string& name{ param.first };
-            const AZStd::string& value{ param.second };
-            AZStd::string command_line_parameter{ name + ":=" + value };
-            AZStd::get<AZStd::vector<AZStd::string>>(processLaunchInfo.m_commandlineParameters).emplace_back(command_line_parameter);
-        }
+        processLaunchInfo.m_commandlineParameters.emplace<AZStd::vector<AZStd::string>>(GetXacroParameters(filename, params));
 
         outcome.m_called = processLaunchInfo.m_processExecutableString + " " + processLaunchInfo.GetCommandLineParametersAsString();
-        AZ_Printf("ParseXacro", "calling file : %s \n", outcome.m_called.c_str());
-
-        AzFramework::ProcessOutput process_output;
-        const bool succeed = AzFramework::ProcessWatcher::LaunchProcessAndRetrieveOutput(
-            processLaunchInfo, AzFramework::ProcessCommunicationType::COMMUNICATOR_TYPE_STDINOUT, process_output);
 
-        if (succeed && process_output.HasOutput() && !process_output.HasError())
+        // Expanding a xacro file starts a Python interpreter, reuse the output of a previous run when no input changed.
+        XacroExpansionCache& expansionCache = XacroExpansionCache::Get();
+        AZStd::optional<AZStd::string> output = expansionCache.Find(filename, params, xacroPath.Native());
+        if (output)
         {
-            AZ_Printf("ParseXacro", "xacro finished with success \n");
-            const auto& output = process_output.outputResult;
+            AZ_Printf("ParseXacro", "using cached output of : %s \n", outcome.m_called.c_str());
+        }
+        else
+        {
+            AZ_Printf("ParseXacro", "calling file : %s \n", outcome.m_called.c_str());
+
+            // A missing xacro executable fails to launch, so its existence isn't checked with a separate process.
+            AzFramework::ProcessOutput process_output;
+            const bool succeed = AzFramework::ProcessWatcher::LaunchProcessAndRetrieveOutput(
+                processLaunchInfo, AzFramework::ProcessCommunicationType::COMMUNICATOR_TYPE_STDINOUT, process_output);
 
-            if (settings.m_fixURDF)
+            if (succeed && process_output.HasOutput() && !process_output.HasError())
             {
-                // modify in memory URDF result
-                auto [modifiedXmlStr, modifiedElements] = (ROS2::Utils::ModifyURDFInMemory(output));
-                outcome.m_urdfHandle = UrdfParser::Parse(modifiedXmlStr, parserConfig);
-                outcome.m_urdfHandle.m_modifiedURDFContent = AZStd::move(modifiedXmlStr);
-                outcome.m_urdfHandle.m_urdfModifications = AZStd::move(modifiedElements);
-                outcome.m_succeed = true;
+                AZ_Printf("ParseXacro", "xacro finished with success \n");
+                output = AZStd::move(process_output.outputResult);
+                if (auto dependencies = GetXacroDependencies(xacroPath, filename, params); dependencies)
+                {
+                    expansionCache.Store(filename, params, xacroPath.Native(), *output, *dependencies);
+                }
             }
             else
             {
-                outcome.m_urdfHandle = UrdfParser::Parse(output, parserConfig);
-                outcome.m_succeed = true;
+                AZ_Printf("ParseXacro", "xacro finished with error \n");
+                AZ_Warning("ParseXacro", succeed, "Failed to launch xacro with command: %s", outcome.m_called.c_str());
+                const auto& stdStream = process_output.outputResult;
+                const auto& cerrStream = process_output.errorResult;
+                outcome.m_logStandardOutput = AZStd::string(stdStream.data(), stdStream.size());
+                outcome.m_logErrorOutput = AZStd::string(cerrStream.data(), cerrStream.size());
+                outcome.m_succeed = false;
+                return outcome;
             }
         }
+
+        if (settings.m_fixURDF)
+        {
+            // modify in memory URDF result
+            auto [modifiedXmlStr, modifiedElements] = (ROS2::Utils::ModifyURDFInMemory(*output));
+            outcome.m_urdfHandle = UrdfParser::Parse(modifiedXmlStr, parserConfig);
+            outcome.m_urdfHandle.m_modifiedURDFContent = AZStd::move(modifiedXmlStr);
+            outcome.m_urdfHandle.m_urdfModifications = AZStd::move(modifiedElements);
+            outcome.m_succeed = true;
+        }
         else
         {
-            AZ_Printf("ParseXacro", "xacro finished with error \n");
-            const auto& stdStream = process_output.outputResult;
-            const auto& cerrStream = process_output.errorResult;
-            outcome.m_logStandardOutput = AZStd::string(stdStream.data(), stdStream.size());
-            outcome.m_logErrorOutput = AZStd::string(cerrStream.data(), cerrStream.size());
-            outcome.m_succeed = false;
+            outcome.m_urdfHandle = UrdfParser::Parse(*output, parserConfig);
+            outcome.m_succeed = true;
         }
         return outcome;
     }
@@ -9,6 +9,7 @@
 #include <SdfAssetBuilder/SdfAssetBuilder.h>
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/IO/IOUtils.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
@@ -24,6 +25,7 @@
 
 #include <RobotImporter/URDF/URDFPrefabMaker.h>
 #include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/Utils/AssetPathResolver.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
 #include <RobotImporter/Utils/ErrorUtils.h>
 #include <Utils/RobotImporterUtils.h>
@@ -49,6 +51,15 @@ namespace ROS2
         // mechanism in the Asset Processor that detects when an associated metadata settings file changes.
         m_fingerprint = GetFingerprint();
 
+        // Parse results are persisted in the user folder, so that they are shared between the builder processes
+        // and survive restarts of the Asset Processor. Without a resolvable user folder they are only kept in memory.
+        AZ::IO::FixedMaxPath cacheFolder;
+        if (auto* fileIO = AZ::IO::FileIOBase::GetInstance(); !fileIO || !fileIO->ResolvePath(cacheFolder, "@user@/SdfAssetBuilder/ParseCache"))
+        {
+            cacheFolder.clear();
+        }
+        m_parseCache = AZStd::make_unique<SdfParseCache>(AZ::IO::PathView(cacheFolder), m_fingerprint);
+
         AssetBuilderSDK::AssetBuilderDesc sdfAssetBuilderDescriptor;
 
         sdfAssetBuilderDescriptor.m_name = SdfAssetBuilderJobKey;
@@ -83,8 +94,9 @@ namespace ROS2
         // The AssetBuilderSDK doesn't support deregistration, so there's nothing more to do here.
     }
 
-    Utils::UrdfAssetMap SdfAssetBuilder::FindAssets(const sdf::Root& root, const AZStd::string& sourceFilename) const
+    Utils::UrdfAssetMap SdfAssetBuilder::FindAssets(const sdf::Root& root, const AZStd::string& sourceFilename, bool& allAssetsResolved) const
     {
+        allAssetsResolved = true;
         AZ_Info(SdfAssetBuilderName, "Parsing mesh and collider names");
         auto assetNames = Utils::GetReferencedAssetFilenames(root);
 
@@ -94,57 +106,79 @@ namespace ROS2
 
         auto amentPrefixPath = Utils::GetAmentPrefixPath();
 
-        for (const auto& [uri, assetReferenceType] : assetNames)
+        // Attempt to find the absolute path for every raw uri reference, which might look something like "model://meshes/model.dae".
+        // References are resolved in parallel, along with a checksum on each resolved file that we'll use to ensure we've matched
+        // with the correct relative source asset.
+        auto resolvedPaths = Utils::AssetPathResolver::Get().ResolveAssetPaths(
+            assetNames, AZ::IO::PathView(sourceFilename), amentPrefixPath, m_globalSettings);
+
+        // Many references can point to the same file, so the Asset Processor is only asked once per resolved file.
+        struct SourceAssetLookup
+        {
+            bool m_found = false;
+            AZ::Data::AssetInfo m_assetInfo;
+            AZ::IO::Path m_fullSourcePath;
+            AZ::Crc32 m_crc;
+        };
+        AZStd::unordered_map<AZ::IO::Path, SourceAssetLookup> sourceAssetLookups;
+
+        for (auto& [uri, resolvedPath] : resolvedPaths)
         {
             Utils::UrdfAsset asset;
             asset.m_urdfPath = uri;
-
-            // Attempt to find the absolute path for the raw uri reference, which might look something like "model://meshes/model.dae"
-            asset.m_resolvedUrdfPath = Utils::ResolveAssetPath(asset.m_urdfPath, AZ::IO::PathView(sourceFilename), amentPrefixPath,
-                m_globalSettings);
+            asset.m_resolvedUrdfPath = AZStd::move(resolvedPath.m_resolvedPath);
             if (asset.m_resolvedUrdfPath.empty())
             {
                 AZ_Warning(SdfAssetBuilderName, false, "Failed to resolve file reference '%s' to an absolute path, skipping.", uri.c_str());
+                allAssetsResolved = false;
                 continue;
             }
-
-            // Get a checksum on the resolved file that we'll use to ensure we've matched with the correct relative
-            // source asset. Ideally we'll be able to remove this check since it's not a very robust safety check and
-            // adds some amount of overhead to the processing.
-            asset.m_urdfFileCRC = Utils::GetFileCRC(asset.m_resolvedUrdfPath);
+            asset.m_urdfFileCRC = resolvedPath.m_fileCRC;
 
             // Given the absolute path to the asset, try to get the source asset info from the AssetProcessor.
-            bool sourceAssetFound{ false };
-            AZ::Data::AssetInfo assetInfo;
-            AZStd::string watchFolder;
-            AssetSysReqBus::BroadcastResult(
-                sourceAssetFound, &AssetSysReqBus::Events::GetSourceInfoBySourcePath,
-                asset.m_resolvedUrdfPath.c_str(), assetInfo, watchFolder);
-
-            if (!sourceAssetFound)
+            auto [lookupIt, inserted] = sourceAssetLookups.try_emplace(asset.m_resolvedUrdfPath);
+            SourceAssetLookup& lookup = lookupIt->second;
+            if (inserted)
+            {
+                AZStd::string watchFolder;
+                AssetSysReqBus::BroadcastResult(
+                    lookup.m_found, &AssetSysReqBus::Events::GetSourceInfoBySourcePath,
+                    asset.m_resolvedUrdfPath.c_str(), lookup.m_assetInfo, watchFolder);
+                if (lookup.m_found)
+                {
+                    lookup.m_fullSourcePath = AZ::IO::Path(watchFolder) / AZ::IO::Path(lookup.m_assetInfo.m_relativePath);
+
+                    // We should determine if this CRC check is actually necessary for resolving URI references.
+                    // Ideally, the additional overhead should be removed and the asset reference result should be trusted.
+                    // When the source asset is the resolved file itself, its checksum is already known.
+                    lookup.m_crc = lookup.m_fullSourcePath.LexicallyNormal() == asset.m_resolvedUrdfPath.LexicallyNormal()
+                        ? asset.m_urdfFileCRC
+                        : Utils::GetFileCRC(lookup.m_fullSourcePath);
+                }
+            }
+
+            if (!lookup.m_found)
             {
                 AZ_Warning(SdfAssetBuilderName, false, "Cannot find source asset info for '%s', skipping.", asset.m_resolvedUrdfPath.c_str());
+                allAssetsResolved = false;
                 continue;
             }
 
             // If the source asset has been found by the Asset Processor, save the mapping between raw uri
             // reference and Asset Processor source asset information.
-            const auto fullSourcePath = AZ::IO::Path(watchFolder) / AZ::IO::Path(assetInfo.m_relativePath);
-            asset.m_availableAssetInfo.m_sourceAssetRelativePath = assetInfo.m_relativePath;
-            asset.m_availableAssetInfo.m_sourceAssetGlobalPath = fullSourcePath.String();
-            asset.m_availableAssetInfo.m_sourceGuid = assetInfo.m_assetId.m_guid;
-
-            // We should determine if this CRC check is actually necessary for resolving URI references.
-            // Ideally, the additional overhead should be removed and the asset reference result should be trusted.
-            AZ::Crc32 crc = Utils::GetFileCRC(asset.m_availableAssetInfo.m_sourceAssetGlobalPath);
-            if (crc == asset.m_urdfFileCRC)
+            asset.m_availableAssetInfo.m_sourceAssetRelativePath = lookup.m_assetInfo.m_relativePath;
+            asset.m_availableAssetInfo.m_sourceAssetGlobalPath = lookup.m_fullSourcePath.String();
+            asset.m_availableAssetInfo.m_sourceGuid = lookup.m_assetInfo.m_assetId.m_guid;
+
+            if (lookup.m_crc == asset.m_urdfFileCRC)
             {
-                AZ_Info(SdfAssetBuilderName, "Resolved uri '%s' to source asset '%s'.", uri.c_str(), assetInfo.m_relativePath.c_str());
+                AZ_Info(SdfAssetBuilderName, "Resolved uri '%s' to source asset '%s'.", uri.c_str(), lookup.m_assetInfo.m_relativePath.c_str());
                 assetMap.emplace(uri, AZStd::move(asset));
             }
             else
             {
-                AZ_Warning(SdfAssetBuilderName, false, "Resolved to source asset '%s' which has incorrect CRC, skipping.", assetInfo.m_relativePath.c_str());
+                AZ_Warning(SdfAssetBuilderName, false, "Resolved to source asset '%s' which has incorrect CRC, skipping.", lookup.m_assetInfo.m_relativePath.c_str());
+                allAssetsResolved = false;
             }
         }
 
@@ -176,9 +210,9 @@ namespace ROS2
     {
         // To be able to successfully process the SDF job, we need job dependencies on every asset
         // referenced by the SDF file. Otherwise we won't be able to connect the references to the
-        // correct product assets. Unfortunately, this means that we need to redundantly parse the
-        // source file once here to set up the job dependencies, and then we'll parse it a second
-        // time when actually running ProcessJob().
+        // correct product assets. The source file is parsed here to set up the job dependencies,
+        // and the resolved references are stored in the parse cache, so that ProcessJob() and
+        // later CreateJobs() calls for an unchanged source file don't need to resolve them again.
 
         // Eventually, we may need to extend the logic here even further to create more asset
         // generation jobs for exporting any embedded model / material / collider assets that only
@@ -186,23 +220,43 @@ namespace ROS2
 
         const auto fullSourcePath = AZ::IO::Path(request.m_watchFolder) / AZ::IO::Path(request.m_sourceFile);
 
-        // Set the parser config settings for parsing URDF content through the libsdformat parser
-        sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(m_globalSettings, fullSourcePath);
-
-        AZ_Info(SdfAssetBuilderName, "Parsing source file: %s", fullSourcePath.c_str());
-        auto parsedSdfRootOutcome = UrdfParser::ParseFromFile(fullSourcePath, parserConfig, m_globalSettings);
-        if (!parsedSdfRootOutcome)
+        auto sourceAssetMap = AZStd::make_shared<Utils::UrdfAssetMap>();
+        if (auto cacheEntry = m_parseCache->Find(fullSourcePath); cacheEntry)
         {
-            const AZStd::string sdfParseErrors = Utils::JoinSdfErrorsToString(parsedSdfRootOutcome.GetSdfErrors());
-            AZ_Error(SdfAssetBuilderName, false, R"(Failed to parse source file "%s". Errors: "%s")",
-                fullSourcePath.c_str(), sdfParseErrors.c_str());
-            return;
+            *sourceAssetMap = AZStd::move(cacheEntry->m_assetMap);
         }
+        else
+        {
+            // Set the parser config settings for parsing URDF content through the libsdformat parser
+            sdf::ParserConfig parserConfig = Utils::SDFormat::CreateSdfParserConfigFromSettings(m_globalSettings, fullSourcePath);
 
-        const sdf::Root& sdfRoot = parsedSdfRootOutcome.GetRoot();
+            AZ_Info(SdfAssetBuilderName, "Parsing source file: %s", fullSourcePath.c_str());
+            const auto parseStartTime = AZStd::chrono::steady_clock::now();
+            auto parsedSdfRootOutcome = UrdfParser::ParseFromFile(fullSourcePath, parserConfig, m_globalSettings);
+            if (!parsedSdfRootOutcome)
+            {
+                const AZStd::string sdfParseErrors = Utils::JoinSdfErrorsToString(parsedSdfRootOutcome.GetSdfErrors());
+                AZ_Error(SdfAssetBuilderName, false, R"(Failed to parse source file "%s". Errors: "%s")",
+                    fullSourcePath.c_str(), sdfParseErrors.c_str());
+                return;
+            }
+
+            const sdf::Root& sdfRoot = parsedSdfRootOutcome.GetRoot();
 
-        AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
-        auto sourceAssetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, fullSourcePath.String()));
+            AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
+            bool allAssetsResolved = false;
+            *sourceAssetMap = FindAssets(sdfRoot, fullSourcePath.String(), allAssetsResolved);
+            AZ_Info(SdfAssetBuilderName, "Parsed and resolved source file in %.3f ms.",
+                AZStd::chrono::duration<double, AZStd::milli>(AZStd::chrono::steady_clock::now() - parseStartTime).count());
+
+            // References that failed to resolve might resolve once their source assets are known to the Asset Processor,
+            // so only complete results are cached.
+            if (allAssetsResolved)
+            {
+                m_parseCache->Store(fullSourcePath, sdfRoot, *sourceAssetMap);
+            }
+        }
+        m_parseCache->ReportStatistics();
 
         // Create an output job for each platform
         for (const AssetBuilderSDK::PlatformInfo& platformInfo : request.m_enabledPlatforms)
@@ -264,9 +318,23 @@ namespace ROS2
 
         const sdf::Root& sdfRoot = parsedSdfRootOutcome.GetRoot();
 
-        // Resolve all the URI references into source asset GUIDs.
-        AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
-        auto assetMap = AZStd::make_shared<Utils::UrdfAssetMap>(FindAssets(sdfRoot, request.m_fullPath));
+        // Resolve all the URI references into source asset GUIDs, unless CreateJobs() already did for this source state.
+        auto assetMap = AZStd::make_shared<Utils::UrdfAssetMap>();
+        if (auto cacheEntry = m_parseCache->Find(AZ::IO::PathView(request.m_fullPath)); cacheEntry)
+        {
+            *assetMap = AZStd::move(cacheEntry->m_assetMap);
+        }
+        else
+        {
+            AZ_Info(SdfAssetBuilderName, "Finding asset IDs for all mesh and collider assets.");
+            bool allAssetsResolved = false;
+            *assetMap = FindAssets(sdfRoot, request.m_fullPath, allAssetsResolved);
+            if (allAssetsResolved)
+            {
+                m_parseCache->Store(AZ::IO::PathView(request.m_fullPath), sdfRoot, *assetMap);
+            }
+        }
+        m_parseCache->ReportStatistics();
 
         // Given the parsed source file and asset mappings, generate an in-memory prefab.
         AZ_Info(SdfAssetBuilderName, "Creating prefab from source file.");
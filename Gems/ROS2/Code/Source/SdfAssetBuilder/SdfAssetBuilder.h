@@ -11,7 +11,9 @@
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
 
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
+#include <SdfAssetBuilder/SdfParseCache.h>
 #include <URDF/UrdfParser.h>
 #include <Utils/SourceAssetsStorage.h>
 
@@ -43,10 +45,14 @@ namespace ROS2
         AZStd::string GetFingerprint() const;
 
         //! Create a mapping of all the asset references in the source file.
-        Utils::UrdfAssetMap FindAssets(const sdf::Root& root, const AZStd::string& sourceFilename) const;
+        //! @param allAssetsResolved set to false if any reference could not be mapped to a source asset.
+        Utils::UrdfAssetMap FindAssets(const sdf::Root& root, const AZStd::string& sourceFilename, bool& allAssetsResolved) const;
 
         SdfAssetBuilderSettings m_globalSettings;
         AZStd::string m_fingerprint;
+
+        //! Parse results shared between CreateJobs and ProcessJob, so that asset references are only resolved once per source state.
+        AZStd::unique_ptr<SdfParseCache> m_parseCache;
     };
 
 } // ROS2
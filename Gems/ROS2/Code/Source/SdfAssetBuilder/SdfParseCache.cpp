@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SdfAssetBuilder/SdfParseCache.h>
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/limits.h>
+#include <SdfAssetBuilder/SdfAssetBuilder.h>
+#include <Utils/ContentHash.h>
+#include <Utils/RobotImporterUtils.h>
+#include <sdf/Element.hh>
+
+namespace ROS2
+{
+    namespace
+    {
+        //! Collect files other than the source file that contributed elements to the parsed content, e.g. included models.
+        void CollectIncludedFiles(
+            const sdf::ElementPtr& element, const std::string& sourcePath, AZStd::unordered_set<AZStd::string>& includedFiles)
+        {
+            if (!element)
+            {
+                return;
+            }
+            const std::string& filePath = element->FilePath();
+            if (!filePath.empty() && filePath != sourcePath && AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                includedFiles.emplace(filePath.c_str(), filePath.size());
+            }
+            for (sdf::ElementPtr child = element->GetFirstElement(); child; child = child->GetNextElement())
+            {
+                CollectIncludedFiles(child, sourcePath, includedFiles);
+            }
+        }
+
+        bool GetStringMember(const rapidjson::Value& object, const char* name, AZStd::string& value)
+        {
+            if (!object.IsObject() || !object.HasMember(name) || !object[name].IsString())
+            {
+                return false;
+            }
+            value.assign(object[name].GetString(), object[name].GetStringLength());
+            return true;
+        }
+
+        bool GetUint64Member(const rapidjson::Value& object, const char* name, AZ::u64& value)
+        {
+            if (!object.IsObject() || !object.HasMember(name) || !object[name].IsUint64())
+            {
+                return false;
+            }
+            value = object[name].GetUint64();
+            return true;
+        }
+    } // namespace
+
+    SdfParseCache::SdfParseCache(AZ::IO::PathView cacheFolder, AZStd::string_view fingerprint)
+        : m_cacheFolder(cacheFolder)
+    {
+        // Resolution of model and package URIs also depends on the environment of the builder process.
+        m_fingerprintHash = Utils::HashString(Utils::GetAmentPrefixPath(), Utils::HashString(fingerprint));
+        if (!m_cacheFolder.empty() && !AZ::IO::SystemFile::Exists(m_cacheFolder.c_str()))
+        {
+            if (!AZ::IO::SystemFile::CreateDir(m_cacheFolder.c_str()))
+            {
+                AZ_Warning(SdfAssetBuilderName, false, "Cannot create parse cache folder '%s', using memory only.", m_cacheFolder.c_str());
+                m_cacheFolder.clear();
+            }
+        }
+    }
+
+    AZStd::string SdfParseCache::GetKey(AZ::IO::PathView sourcePath) const
+    {
+        const AZ::IO::Path normalizedPath = AZ::IO::Path(sourcePath).LexicallyNormal();
+        const auto contentHash = Utils::HashFile(normalizedPath);
+        if (!contentHash)
+        {
+            return {};
+        }
+        const AZ::u64 pathHash = Utils::HashString(normalizedPath.Native(), m_fingerprintHash);
+        return Utils::ToHexString(pathHash) + "_" + Utils::ToHexString(*contentHash);
+    }
+
+    AZ::IO::Path SdfParseCache::GetEntryPath(const AZStd::string& key) const
+    {
+        if (m_cacheFolder.empty())
+        {
+            return {};
+        }
+        return m_cacheFolder / (key + ".json");
+    }
+
+    bool SdfParseCache::IsValid(const SdfParseCacheEntry& entry) const
+    {
+        for (const auto& includedFile : entry.m_includedFiles)
+        {
+            const auto hash = Utils::HashFile(includedFile.m_path);
+            if (!hash || *hash != includedFile.m_hash)
+            {
+                return false;
+            }
+        }
+
+        // Resolved assets are only checked for modification, the Asset Processor keeps their GUIDs while they exist.
+        for (const auto& [uri, asset] : entry.m_assetMap)
+        {
+            const auto storedTime = entry.m_assetModificationTimes.find(uri);
+            if (storedTime == entry.m_assetModificationTimes.end())
+            {
+                return false;
+            }
+            const AZ::u64 modificationTime = AZ::IO::SystemFile::ModificationTime(asset.m_availableAssetInfo.m_sourceAssetGlobalPath.c_str());
+            if (modificationTime == 0 || modificationTime != storedTime->second)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AZStd::optional<SdfParseCacheEntry> SdfParseCache::Find(AZ::IO::PathView sourcePath)
+    {
+        const auto startTime = AZStd::chrono::steady_clock::now();
+        const AZStd::string key = GetKey(sourcePath);
+
+        AZStd::optional<SdfParseCacheEntry> result;
+        if (!key.empty())
+        {
+            SdfParseCacheEntry entry;
+            bool found = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+                if (auto it = m_entries.find(key); it != m_entries.end())
+                {
+                    entry = it->second;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                // The entry could have been stored by another builder process or a previous run.
+                if (const AZ::IO::Path entryPath = GetEntryPath(key); !entryPath.empty() && LoadEntry(entryPath, entry))
+                {
+                    found = true;
+                    AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+                    m_entries.emplace(key, entry);
+                }
+            }
+
+            if (found && IsValid(entry))
+            {
+                result = AZStd::move(entry);
+            }
+        }
+
+        const auto lookupTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        m_lookupTimeUs += lookupTime.count();
+        if (result)
+        {
+            ++m_hits;
+        }
+        else
+        {
+            ++m_misses;
+        }
+        AZ_Info(
+            SdfAssetBuilderName,
+            "Parse cache %s for '%.*s' (%.3f ms).",
+            result ? "hit" : "miss",
+            AZ_PATH_ARG(sourcePath),
+            lookupTime.count() / 1000.0);
+        return result;
+    }
+
+    void SdfParseCache::Store(AZ::IO::PathView sourcePath, const sdf::Root& root, const Utils::UrdfAssetMap& assetMap)
+    {
+        const AZStd::string key = GetKey(sourcePath);
+        if (key.empty())
+        {
+            return;
+        }
+
+        SdfParseCacheEntry entry;
+        entry.m_assetMap = assetMap;
+        for (const auto& [uri, asset] : entry.m_assetMap)
+        {
+            entry.m_assetModificationTimes.emplace(
+                uri, AZ::IO::SystemFile::ModificationTime(asset.m_availableAssetInfo.m_sourceAssetGlobalPath.c_str()));
+        }
+
+        AZStd::unordered_set<AZStd::string> includedFiles;
+        const AZ::IO::Path normalizedPath = AZ::IO::Path(sourcePath).LexicallyNormal();
+        CollectIncludedFiles(root.Element(), std::string(normalizedPath.c_str(), normalizedPath.Native().size()), includedFiles);
+        for (const auto& includedFile : includedFiles)
+        {
+            const AZ::IO::Path includedPath(includedFile);
+            if (const auto hash = Utils::HashFile(includedPath))
+            {
+                entry.m_includedFiles.push_back({ includedPath, *hash });
+            }
+        }
+
+        if (const AZ::IO::Path entryPath = GetEntryPath(key); !entryPath.empty())
+        {
+            SaveEntry(entryPath, entry);
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_entriesMutex);
+        m_entries.insert_or_assign(key, AZStd::move(entry));
+    }
+
+    void SdfParseCache::ReportStatistics() const
+    {
+        const AZ::u64 hits = m_hits;
+        const AZ::u64 misses = m_misses;
+        const AZ::u64 lookups = hits + misses;
+        AZ_Info(
+            SdfAssetBuilderName,
+            "Parse cache: %llu hits, %llu misses (%.1f%% hit rate), %.3f ms spent in lookups.",
+            static_cast<unsigned long long>(hits),
+            static_cast<unsigned long long>(misses),
+            lookups > 0 ? 100.0 * hits / lookups : 0.0,
+            m_lookupTimeUs / 1000.0);
+    }
+
+    bool SdfParseCache::LoadEntry(const AZ::IO::Path& entryPath, SdfParseCacheEntry& entry) const
+    {
+        if (!AZ::IO::SystemFile::Exists(entryPath.c_str()))
+        {
+            return false;
+        }
+        auto readResult = AZ::JsonSerializationUtils::ReadJsonFile(entryPath.Native());
+        if (!readResult.IsSuccess())
+        {
+            return false;
+        }
+
+        // Entries can be truncated or written by another version of the builder, anything unexpected is a cache miss.
+        const rapidjson::Document& document = readResult.GetValue();
+        if (!document.IsObject() || !document.HasMember("includedFiles") || !document["includedFiles"].IsArray() ||
+            !document.HasMember("assets") || !document["assets"].IsArray())
+        {
+            return false;
+        }
+
+        SdfParseCacheEntry loadedEntry;
+        for (const auto& file : document["includedFiles"].GetArray())
+        {
+            AZStd::string path;
+            AZ::u64 hash = 0;
+            if (!GetStringMember(file, "path", path) || !GetUint64Member(file, "hash", hash))
+            {
+                return false;
+            }
+            loadedEntry.m_includedFiles.push_back({ AZ::IO::Path(AZStd::move(path)), hash });
+        }
+        for (const auto& assetValue : document["assets"].GetArray())
+        {
+            AZStd::string uri, resolvedPath, sourceRelativePath, sourceGlobalPath, sourceGuid;
+            AZ::u64 crc = 0;
+            AZ::u64 modificationTime = 0;
+            if (!GetStringMember(assetValue, "uri", uri) || !GetStringMember(assetValue, "resolvedPath", resolvedPath) ||
+                !GetUint64Member(assetValue, "crc", crc) || crc > AZStd::numeric_limits<AZ::u32>::max() ||
+                !GetStringMember(assetValue, "sourceRelativePath", sourceRelativePath) ||
+                !GetStringMember(assetValue, "sourceGlobalPath", sourceGlobalPath) ||
+                !GetStringMember(assetValue, "sourceGuid", sourceGuid) || !GetUint64Member(assetValue, "modificationTime", modificationTime))
+            {
+                return false;
+            }
+
+            Utils::UrdfAsset asset;
+            asset.m_urdfPath = uri;
+            asset.m_resolvedUrdfPath = resolvedPath;
+            asset.m_urdfFileCRC = AZ::Crc32(aznumeric_cast<AZ::u32>(crc));
+            asset.m_availableAssetInfo.m_sourceAssetRelativePath = sourceRelativePath;
+            asset.m_availableAssetInfo.m_sourceAssetGlobalPath = sourceGlobalPath;
+            asset.m_availableAssetInfo.m_sourceGuid = AZ::Uuid::CreateString(sourceGuid.c_str(), sourceGuid.size());
+            loadedEntry.m_assetModificationTimes.emplace(asset.m_urdfPath, modificationTime);
+            loadedEntry.m_assetMap.emplace(asset.m_urdfPath, AZStd::move(asset));
+        }
+        entry = AZStd::move(loadedEntry);
+        return true;
+    }
+
+    bool SdfParseCache::SaveEntry(const AZ::IO::Path& entryPath, const SdfParseCacheEntry& entry) const
+    {
+        rapidjson::Document document(rapidjson::kObjectType);
+        auto& allocator = document.GetAllocator();
+        auto makeString = [&allocator](AZStd::string_view value)
+        {
+            return rapidjson::Value(value.data(), aznumeric_cast<rapidjson::SizeType>(value.size()), allocator);
+        };
+
+        rapidjson::Value includedFiles(rapidjson::kArrayType);
+        for (const auto& includedFile : entry.m_includedFiles)
+        {
+            rapidjson::Value file(rapidjson::kObjectType);
+            file.AddMember("path", makeString(includedFile.m_path.Native()), allocator);
+            file.AddMember("hash", rapidjson::Value(includedFile.m_hash), allocator);
+            includedFiles.PushBack(file, allocator);
+        }
+        document.AddMember("includedFiles", includedFiles, allocator);
+
+        rapidjson::Value assets(rapidjson::kArrayType);
+        for (const auto& [uri, asset] : entry.m_assetMap)
+        {
+            const auto modificationTime = entry.m_assetModificationTimes.find(uri);
+            rapidjson::Value assetValue(rapidjson::kObjectType);
+            assetValue.AddMember("uri", makeString(uri.Native()), allocator);
+            assetValue.AddMember("resolvedPath", makeString(asset.m_resolvedUrdfPath.Native()), allocator);
+            assetValue.AddMember("crc", rapidjson::Value(static_cast<AZ::u32>(asset.m_urdfFileCRC)), allocator);
+            assetValue.AddMember(
+                "sourceRelativePath", makeString(asset.m_availableAssetInfo.m_sourceAssetRelativePath.Native()), allocator);
+            assetValue.AddMember("sourceGlobalPath", makeString(asset.m_availableAssetInfo.m_sourceAssetGlobalPath.Native()), allocator);
+            assetValue.AddMember(
+                "sourceGuid", makeString(asset.m_availableAssetInfo.m_sourceGuid.ToFixedString().c_str()), allocator);
+            assetValue.AddMember(
+                "modificationTime",
+                rapidjson::Value(modificationTime != entry.m_assetModificationTimes.end() ? modificationTime->second : AZ::u64{ 0 }),
+                allocator);
+            assets.PushBack(assetValue, allocator);
+        }
+        document.AddMember("assets", assets, allocator);
+
+        // Write to a unique temporary file first, so that concurrent builder processes never read a partially written entry.
+        const AZ::IO::Path tempPath = entryPath.Native() + "." + AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str();
+        if (!AZ::JsonSerializationUtils::WriteJsonFile(document, tempPath.Native()).IsSuccess())
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        if (!AZ::IO::SystemFile::Rename(tempPath.c_str(), entryPath.c_str(), true))
+        {
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+} // namespace ROS2
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <Utils/SourceAssetsStorage.h>
+#include <sdf/Root.hh>
+
+namespace ROS2
+{
+    //! Results of parsing a source file that the builder needs besides the parsed sdf::Root.
+    struct SdfParseCacheEntry
+    {
+        //! A file the source depends on, with the hash of its content.
+        struct FileHash
+        {
+            AZ::IO::Path m_path;
+            AZ::u64 m_hash = 0;
+        };
+
+        Utils::UrdfAssetMap m_assetMap; //!< Resolved references of the source file to source assets
+        AZStd::vector<FileHash> m_includedFiles; //!< Files included by the source file
+        AZStd::unordered_map<AZ::IO::Path, AZ::u64> m_assetModificationTimes; //!< Modification times of resolved assets, by URI
+    };
+
+    //! Content-addressed cache of parse results of the SDF asset builder, shared by CreateJobs and ProcessJob.
+    //! Entries are keyed by the source path, the hash of the source content and the builder fingerprint. They are kept
+    //! in memory and persisted to disk, so that jobs in other builder processes and incremental rebuilds can use them.
+    //! An entry is only used when none of the included files changed and all resolved assets still exist unmodified.
+    class SdfParseCache
+    {
+    public:
+        //! @param cacheFolder folder to persist entries in.
+        //! @param fingerprint builder settings that affect parse results, @see SdfAssetBuilder::GetFingerprint.
+        SdfParseCache(AZ::IO::PathView cacheFolder, AZStd::string_view fingerprint);
+
+        //! Find a valid entry for the source file.
+        //! @return the entry, or an empty optional on a cache miss.
+        AZStd::optional<SdfParseCacheEntry> Find(AZ::IO::PathView sourcePath);
+
+        //! Store results of parsing the source file.
+        //! @param sourcePath the parsed source file.
+        //! @param root the parsed content, used to collect included files.
+        //! @param assetMap the resolved asset references.
+        void Store(AZ::IO::PathView sourcePath, const sdf::Root& root, const Utils::UrdfAssetMap& assetMap);
+
+        //! Log the number of hits and misses so far, along with the time spent looking up entries.
+        void ReportStatistics() const;
+
+    private:
+        //! @return key of the source file in its current state, or an empty string if the file cannot be read.
+        AZStd::string GetKey(AZ::IO::PathView sourcePath) const;
+        AZ::IO::Path GetEntryPath(const AZStd::string& key) const;
+        bool IsValid(const SdfParseCacheEntry& entry) const;
+
+        bool LoadEntry(const AZ::IO::Path& entryPath, SdfParseCacheEntry& entry) const;
+        bool SaveEntry(const AZ::IO::Path& entryPath, const SdfParseCacheEntry& entry) const;
+
+        AZ::IO::Path m_cacheFolder;
+        AZ::u64 m_fingerprintHash = 0;
+
+        mutable AZStd::mutex m_entriesMutex; //!< Jobs of the builder can run concurrently
+        AZStd::unordered_map<AZStd::string, SdfParseCacheEntry> m_entries; //!< Entries used or stored by this process
+
+        AZStd::atomic<AZ::u64> m_hits{ 0 };
+        AZStd::atomic<AZ::u64> m_misses{ 0 };
+        AZStd::atomic<AZ::u64> m_lookupTimeUs{ 0 };
+    };
+} // namespace ROS2
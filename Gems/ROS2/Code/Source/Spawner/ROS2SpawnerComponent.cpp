@@ -8,11 +8,13 @@
 
 #include "ROS2SpawnerComponent.h"
 #include "Spawner/ROS2SpawnerComponentController.h"
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/string.h>
+#include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <ROS2/Frame/ROS2FrameComponent.h>
 #include <ROS2/Georeference/GeoreferenceBus.h>
@@ -76,10 +78,13 @@ namespace ROS2
             {
                 GetSpawnPointsNames(request, response);
             });
+
+        SpawnerBatchRequestsBus::Handler::BusConnect(GetEntityId());
     }
 
     void ROS2SpawnerComponent::Deactivate()
     {
+        SpawnerBatchRequestsBus::Handler::BusDisconnect();
         ROS2SpawnerComponentBase::Deactivate();
 
         m_getSpawnablesNamesService.reset();
@@ -88,6 +93,12 @@ namespace ROS2
         m_getSpawnPointInfoService.reset();
         m_getSpawnPointsNamesService.reset();
         m_tickets.clear();
+        AZ_Info(
+            "ROS2SpawnerComponent",
+            "%zu spawns reused a pooled robot, %zu spawned a new one.",
+            m_robotPool.GetStatistics().m_reused,
+            m_robotPool.GetStatistics().m_missed);
+        m_robotPool.Clear();
     }
 
     void ROS2SpawnerComponent::Reflect(AZ::ReflectContext* context)
@@ -139,63 +150,20 @@ namespace ROS2
             return;
         }
 
-        AZStd::string spawnableName(request->name.c_str());
-        AZStd::string spawnableNamespace(request->robot_namespace.c_str());
+        SpawnRobotInfo robot;
+        robot.m_spawnableName = request->name.c_str();
+        robot.m_namespace = request->robot_namespace.c_str();
         AZStd::string spawnPointName(request->xml.c_str(), request->xml.size());
 
-        if (auto namespaceValidation = ROS2Names::ValidateNamespace(spawnableNamespace); !namespaceValidation.IsSuccess())
-        {
-            response.success = false;
-            response.status_message = namespaceValidation.GetError().data();
-            service_handle->send_response(*header, response);
-            return;
-        }
-
-        if (!m_controller.GetSpawnables().contains(spawnableName))
-        {
-            response.success = false;
-            response.status_message = "Could not find spawnable with given name: " + request->name;
-            service_handle->send_response(*header, response);
-            return;
-        }
-
-        auto spawnable = m_controller.GetSpawnables().find(spawnableName);
-
-        if (spawnable->second->IsLoading())
-        {
-            // This is an Editor only situation. All assets during game mode are fully loaded.
-            response.success = false;
-            response.status_message = "Asset for spawnable " + request->name + " has not yet loaded.";
-            service_handle->send_response(*header, response);
-            return;
-        }
-
-        if (spawnable->second->IsError())
+        auto validation = ValidateSpawnRequest(robot);
+        if (!validation.IsSuccess())
         {
             response.success = false;
-            response.status_message = "Spawnable " + request->name + " loaded with an error.";
+            response.status_message = validation.GetError().c_str();
             service_handle->send_response(*header, response);
             return;
         }
 
-        if (!m_tickets.contains(spawnableName))
-        {
-            // if a ticket for this spawnable was not created but the spawnable name is correct, create the ticket and then use it to
-            // spawn an entity
-            m_tickets.emplace(spawnable->first, AzFramework::EntitySpawnTicket(spawnable->second));
-        }
-
-        auto spawnableTicket = AzFramework::EntitySpawnTicket(spawnable->second);
-        auto ticketId = spawnableTicket.GetId();
-        AZStd::string ticketName = spawnable->first + "_" + AZStd::to_string(ticketId);
-        m_tickets.emplace(ticketName, AZStd::move(spawnableTicket));
-
-        auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
-
-        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
-
-        AZ::Transform transform;
-
         if (isWGS)
         {
             ROS2::WGS::WGS84Coordinate coordinate;
@@ -208,76 +176,188 @@ namespace ROS2
             ROS2::GeoreferenceRequestsBus::BroadcastResult(
                 coordinateInLevel, &ROS2::GeoreferenceRequests::ConvertFromWGS84ToLevel, coordinate);
 
-            rotationInENU = (rotationInENU.GetInverseFast() *
-                             AZ::Quaternion(
-                                 request->initial_pose.orientation.x,
-                                 request->initial_pose.orientation.y,
-                                 request->initial_pose.orientation.z,
-                                 request->initial_pose.orientation.w))
-                                .GetNormalized();
+            rotationInENU = (rotationInENU.GetInverseFast() * rotation).GetNormalized();
 
-            transform = { coordinateInLevel, rotationInENU, 1.0f };
+            robot.m_pose = { coordinateInLevel, rotationInENU, 1.0f };
         }
         else
         {
             if (auto spawnPoints = GetSpawnPoints(); spawnPoints.contains(spawnPointName))
             {
-                transform = spawnPoints.at(spawnPointName).pose;
+                robot.m_pose = spawnPoints.at(spawnPointName).pose;
             }
             else
             {
-                transform = { AZ::Vector3(
-                                  request->initial_pose.position.x, request->initial_pose.position.y, request->initial_pose.position.z),
-                              AZ::Quaternion(
-                                  request->initial_pose.orientation.x,
-                                  request->initial_pose.orientation.y,
-                                  request->initial_pose.orientation.z,
-                                  request->initial_pose.orientation.w)
-                                  .GetNormalized(),
-                              1.0f };
+                robot.m_pose = { AZ::Vector3(
+                                     request->initial_pose.position.x, request->initial_pose.position.y, request->initial_pose.position.z),
+                                 rotation.GetNormalized(),
+                                 1.0f };
             }
         }
 
-        optionalArgs.m_preInsertionCallback = [this, transform, spawnableName, spawnableNamespace](auto id, auto view)
-        {
-            PreSpawn(id, view, transform, spawnableName, spawnableNamespace);
-        };
+        SpawnRobot(
+            robot,
+            validation.GetValue(),
+            [service_handle, header](const SpawnRobotOutcome& outcome)
+            {
+                SpawnEntityResponse response;
+                response.success = outcome.IsSuccess();
+                response.status_message = outcome.IsSuccess() ? outcome.GetValue().c_str() : outcome.GetError().c_str();
+                service_handle->send_response(*header, response);
+            });
+    }
 
-        optionalArgs.m_completionCallback = [service_handle, header, ticketName, parentId = GetEntityId()](auto id, auto view)
+    void ROS2SpawnerComponent::SpawnRobots(const AZStd::vector<SpawnRobotInfo>& robots, SpawnRobotCallback callback)
+    {
+        for (AZStd::size_t robotIndex = 0; robotIndex < robots.size(); ++robotIndex)
         {
-            if (!view.empty())
+            auto validation = ValidateSpawnRequest(robots[robotIndex]);
+            if (!validation.IsSuccess())
             {
-                const AZ::Entity* root = *view.begin();
-                auto* transformInterface = root->FindComponent<AzFramework::TransformComponent>();
-                transformInterface->SetParent(parentId);
+                if (callback)
+                {
+                    callback(robotIndex, AZ::Failure(validation.GetError()));
+                }
+                continue;
             }
-            SpawnEntityResponse response;
-            response.success = true;
-            response.status_message = ticketName.c_str();
-            service_handle->send_response(*header, response);
-        };
 
-        spawner->SpawnAllEntities(m_tickets.at(ticketName), optionalArgs);
+            SpawnRobot(
+                robots[robotIndex],
+                validation.GetValue(),
+                [callback, robotIndex](const SpawnRobotOutcome& outcome)
+                {
+                    if (callback)
+                    {
+                        callback(robotIndex, outcome);
+                    }
+                });
+        }
+    }
+
+    bool ROS2SpawnerComponent::DespawnRobot(const AZStd::string& instanceName)
+    {
+        return QueueDespawn(instanceName, {});
+    }
+
+    bool ROS2SpawnerComponent::PrewarmRobots(const AZStd::string& spawnableName, AZStd::size_t count)
+    {
+        const auto& spawnables = m_controller.GetSpawnables();
+        auto spawnable = spawnables.find(spawnableName);
+        if (spawnable == spawnables.end() || !spawnable->second.IsReady())
+        {
+            AZ_Warning("ROS2SpawnerComponent", false, "Cannot prewarm robots, spawnable %s is not loaded", spawnableName.c_str());
+            return false;
+        }
+
+        auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
+        for (AZStd::size_t pooledCount = m_robotPool.GetPooledCount(spawnableName); pooledCount < count; ++pooledCount)
+        {
+            AzFramework::EntitySpawnTicket ticket(spawnable->second);
+
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = []([[maybe_unused]] auto id, AzFramework::SpawnableConstEntityContainerView view)
+            {
+                SetEntitiesActive(FindSpawnedEntities(view), false);
+            };
+            spawner->SpawnAllEntities(ticket, optionalArgs);
+
+            // Commands on a ticket are executed in order, so the robot can be taken from the pool right away:
+            // its activation runs after the deactivation above.
+            m_robotPool.Release(spawnableName, AZStd::move(ticket));
+        }
+        return true;
+    }
+
+    AZ::Outcome<AZ::Data::Asset<AzFramework::Spawnable>, AZStd::string> ROS2SpawnerComponent::ValidateSpawnRequest(
+        const SpawnRobotInfo& robot) const
+    {
+        if (auto namespaceValidation = ROS2Names::ValidateNamespace(robot.m_namespace); !namespaceValidation.IsSuccess())
+        {
+            return AZ::Failure(namespaceValidation.GetError());
+        }
+
+        const auto& spawnables = m_controller.GetSpawnables();
+        auto spawnable = spawnables.find(robot.m_spawnableName);
+        if (spawnable == spawnables.end())
+        {
+            return AZ::Failure("Could not find spawnable with given name: " + robot.m_spawnableName);
+        }
+
+        if (spawnable->second.IsLoading())
+        {
+            // This is an Editor only situation. All assets during game mode are fully loaded.
+            return AZ::Failure("Asset for spawnable " + robot.m_spawnableName + " has not yet loaded.");
+        }
+
+        if (spawnable->second.IsError())
+        {
+            return AZ::Failure("Spawnable " + robot.m_spawnableName + " loaded with an error.");
+        }
+
+        return AZ::Success(spawnable->second);
+    }
+
+    void ROS2SpawnerComponent::SpawnRobot(
+        const SpawnRobotInfo& robot, const AZ::Data::Asset<AzFramework::Spawnable>& spawnable, SpawnCompletion callback)
+    {
+        // The instance name is also the name of the robot's root entity, so it is unique even when robots are reused.
+        const AZStd::string instanceName = AZStd::string::format("%s_%d", robot.m_spawnableName.c_str(), m_counter++);
+
+        auto [spawnedRobot, inserted] = m_tickets.emplace(instanceName, SpawnedRobot{ robot.m_spawnableName, {} });
+        AZ_Assert(inserted, "Robot instance %s already exists", instanceName.c_str());
+
+        auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
+        if (auto pooledTicket = m_robotPool.Acquire(robot.m_spawnableName))
+        {
+            // The pooled robot is still spawned, it only needs to be placed, renamed and activated again.
+            spawnedRobot->second.m_ticket = AZStd::move(*pooledTicket);
+            spawner->ListEntities(
+                spawnedRobot->second.m_ticket,
+                [this, robot, instanceName, callback = AZStd::move(callback)](
+                    [[maybe_unused]] auto id, AzFramework::SpawnableConstEntityContainerView view)
+                {
+                    const AZStd::vector<AZ::Entity*> entities = FindSpawnedEntities(view);
+                    PreSpawn(entities, robot.m_pose, instanceName, robot.m_namespace);
+                    SetEntitiesActive(entities, true);
+                    CompleteSpawn(entities, instanceName, robot.m_spawnableName, callback);
+                });
+            return;
+        }
+
+        spawnedRobot->second.m_ticket = AzFramework::EntitySpawnTicket(spawnable);
+
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_preInsertionCallback =
+            [transform = robot.m_pose, instanceName, spawnableNamespace = robot.m_namespace](
+                [[maybe_unused]] auto id, AzFramework::SpawnableEntityContainerView view)
+        {
+            PreSpawn(AZStd::vector<AZ::Entity*>(view.begin(), view.end()), transform, instanceName, spawnableNamespace);
+        };
+        optionalArgs.m_completionCallback =
+            [this, instanceName, spawnableName = robot.m_spawnableName, callback = AZStd::move(callback)](
+                [[maybe_unused]] auto id, AzFramework::SpawnableConstEntityContainerView view)
+        {
+            CompleteSpawn(FindSpawnedEntities(view), instanceName, spawnableName, callback);
+        };
+        spawner->SpawnAllEntities(spawnedRobot->second.m_ticket, optionalArgs);
     }
 
     void ROS2SpawnerComponent::PreSpawn(
-        AzFramework::EntitySpawnTicket::Id id [[maybe_unused]],
-        AzFramework::SpawnableEntityContainerView view,
+        const AZStd::vector<AZ::Entity*>& entities,
         const AZ::Transform& transform,
-        const AZStd::string& spawnableName,
+        const AZStd::string& instanceName,
         const AZStd::string& spawnableNamespace)
     {
-        if (view.empty())
+        if (entities.empty())
         {
             return;
         }
-        AZ::Entity* root = *view.begin();
+        AZ::Entity* root = entities.front();
 
         auto* transformInterface = root->FindComponent<AzFramework::TransformComponent>();
         transformInterface->SetWorldTM(transform);
 
-        AZStd::string instanceName = AZStd::string::format("%s_%d", spawnableName.c_str(), m_counter++);
-        for (AZ::Entity* entity : view)
+        for (AZ::Entity* entity : entities)
         { // Update name for the first entity with ROS2Frame in hierarchy (left to right)
             auto* frameComponent = entity->FindComponent<ROS2FrameComponent>();
             if (frameComponent)
@@ -292,31 +372,112 @@ namespace ROS2
         }
     }
 
-    void ROS2SpawnerComponent::DeleteEntity(
-        const DeleteEntityServiceHandle service_handle, const std::shared_ptr<rmw_request_id_t> header, DeleteEntityRequest request)
+    void ROS2SpawnerComponent::CompleteSpawn(
+        const AZStd::vector<AZ::Entity*>& entities,
+        const AZStd::string& instanceName,
+        const AZStd::string& spawnableName,
+        const SpawnCompletion& callback)
     {
-        auto deleteName = AZStd::string(request->name.c_str());
-        if (!m_tickets.contains(deleteName))
+        if (entities.empty())
         {
-            DeleteEntityResponse response;
-            response.success = false;
-            response.status_message = "Could not find entity with given name: " + request->name;
-            service_handle->send_response(*header, response);
+            // Nothing to despawn or reuse later, the ticket is dropped together with the robot.
+            m_tickets.erase(instanceName);
+            callback(AZ::Failure("Spawnable " + spawnableName + " did not spawn any entities."));
             return;
         }
+
+        auto* transformInterface = entities.front()->FindComponent<AzFramework::TransformComponent>();
+        transformInterface->SetParent(GetEntityId());
+        callback(AZ::Success(instanceName));
+    }
+
+    AZStd::vector<AZ::Entity*> ROS2SpawnerComponent::FindSpawnedEntities(AzFramework::SpawnableConstEntityContainerView view)
+    {
+        AZStd::vector<AZ::Entity*> entities;
+        entities.reserve(view.size());
+        for (const AZ::Entity* entity : view)
+        {
+            if (AZ::Entity* spawnedEntity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(entity->GetId()))
+            {
+                entities.push_back(spawnedEntity);
+            }
+        }
+        return entities;
+    }
+
+    void ROS2SpawnerComponent::SetEntitiesActive(const AZStd::vector<AZ::Entity*>& entities, bool active)
+    {
+        if (active)
+        {
+            for (AZ::Entity* entity : entities)
+            {
+                AzFramework::GameEntityContextRequestBus::Broadcast(
+                    &AzFramework::GameEntityContextRequests::ActivateGameEntity, entity->GetId());
+            }
+            return;
+        }
+
+        // Children are deactivated before their parents, the reverse of the spawn order.
+        if (!entities.empty())
+        {
+            // Detach the root while it is active, so that it keeps its world pose for the following PreSpawn.
+            auto* transformInterface = entities.front()->FindComponent<AzFramework::TransformComponent>();
+            transformInterface->SetParent(AZ::EntityId());
+        }
+        for (auto entity = entities.rbegin(); entity != entities.rend(); ++entity)
+        {
+            AzFramework::GameEntityContextRequestBus::Broadcast(
+                &AzFramework::GameEntityContextRequests::DeactivateGameEntity, (*entity)->GetId());
+        }
+    }
+
+    bool ROS2SpawnerComponent::QueueDespawn(const AZStd::string& instanceName, AZStd::function<void()> callback)
+    {
+        auto spawnedRobot = m_tickets.find(instanceName);
+        if (spawnedRobot == m_tickets.end())
+        {
+            return false;
+        }
         auto spawner = AZ::Interface<AzFramework::SpawnableEntitiesDefinition>::Get();
 
-        AzFramework::DespawnAllEntitiesOptionalArgs optionalArgs;
+        // The robot is only deactivated, its entities stay spawned to be activated again by a following spawn.
+        spawner->ListEntities(
+            spawnedRobot->second.m_ticket,
+            [callback = AZStd::move(callback)]([[maybe_unused]] auto id, AzFramework::SpawnableConstEntityContainerView view)
+            {
+                SetEntitiesActive(FindSpawnedEntities(view), false);
+                if (callback)
+                {
+                    callback();
+                }
+            });
+
+        // Commands on a ticket are executed in order, so the robot can be reused right away: a following spawn runs after the despawn.
+        m_robotPool.Release(spawnedRobot->second.m_spawnableName, AZStd::move(spawnedRobot->second.m_ticket));
+        m_tickets.erase(spawnedRobot);
+        return true;
+    }
 
-        optionalArgs.m_completionCallback = [service_handle, header](auto id)
+    void ROS2SpawnerComponent::DeleteEntity(
+        const DeleteEntityServiceHandle service_handle, const std::shared_ptr<rmw_request_id_t> header, DeleteEntityRequest request)
+    {
+        auto deleteName = AZStd::string(request->name.c_str());
+        const bool queued = QueueDespawn(
+            deleteName,
+            [service_handle, header]()
+            {
+                DeleteEntityResponse response;
+                response.success = true;
+                service_handle->send_response(*header, response);
+            });
+
+        if (!queued)
         {
             DeleteEntityResponse response;
-            response.success = true;
+            response.success = false;
+            response.status_message = "Could not find entity with given name: " + request->name;
             service_handle->send_response(*header, response);
-        };
-
-        spawner->DespawnAllEntities(m_tickets.at(deleteName), optionalArgs);
-        m_tickets.erase(deleteName);
+        }
     }
 
     void ROS2SpawnerComponent::GetSpawnPointsNames(
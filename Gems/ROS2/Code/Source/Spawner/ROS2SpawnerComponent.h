@@ -9,13 +9,16 @@
 
 #include "ROS2SpawnPointComponent.h"
 #include "Spawner/ROS2SpawnerComponentController.h"
+#include "Spawner/SpawnPool.h"
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzFramework/Components/ComponentAdapter.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+#include <ROS2/Spawner/SpawnerBus.h>
 #include <gazebo_msgs/srv/delete_entity.hpp>
 #include <gazebo_msgs/srv/get_model_state.hpp>
 #include <gazebo_msgs/srv/get_world_properties.hpp>
@@ -40,7 +43,11 @@ namespace ROS2
     using ROS2SpawnerComponentBase = AzFramework::Components::ComponentAdapter<ROS2SpawnerComponentController, ROS2SpawnerComponentConfig>;
     //! Manages robots spawning.
     //! Allows user to set spawnable prefabs in the Editor and spawn them using ROS2 service during the simulation.
-    class ROS2SpawnerComponent : public ROS2SpawnerComponentBase
+    //! Robots can also be spawned in batches through SpawnerBatchRequestsBus.
+    //! Despawned robots are parked deactivated and activated again by the following spawns of the same spawnable.
+    class ROS2SpawnerComponent
+        : public ROS2SpawnerComponentBase
+        , public SpawnerBatchRequestsBus::Handler
     {
     public:
         AZ_COMPONENT(ROS2SpawnerComponent, "{8ea91880-0067-11ee-be56-0242ac120002}", AZ::Component);
@@ -56,9 +63,28 @@ namespace ROS2
         //////////////////////////////////////////////////////////////////////////
         static void Reflect(AZ::ReflectContext* context);
 
+        //////////////////////////////////////////////////////////////////////////
+        // SpawnerBatchRequestsBus::Handler overrides
+        void SpawnRobots(const AZStd::vector<SpawnRobotInfo>& robots, SpawnRobotCallback callback) override;
+        bool DespawnRobot(const AZStd::string& instanceName) override;
+        bool PrewarmRobots(const AZStd::string& spawnableName, AZStd::size_t count) override;
+        //////////////////////////////////////////////////////////////////////////
+
     private:
+        //! Ticket of a spawned robot, together with the spawnable it was created for.
+        struct SpawnedRobot
+        {
+            AZStd::string m_spawnableName;
+            AzFramework::EntitySpawnTicket m_ticket;
+        };
+
+        //! Called once the spawning of a robot completed or failed.
+        using SpawnCompletion = AZStd::function<void(const SpawnRobotOutcome& outcome)>;
+
         int m_counter = 1;
-        AZStd::unordered_map<AZStd::string, AzFramework::EntitySpawnTicket> m_tickets;
+        AZStd::unordered_map<AZStd::string, SpawnedRobot> m_tickets; //!< Tickets of spawned robots, by instance name
+        //! Despawned and prewarmed robots, still spawned but deactivated, held by their tickets.
+        SpawnPool<AzFramework::EntitySpawnTicket> m_robotPool;
 
         rclcpp::Service<gazebo_msgs::srv::GetWorldProperties>::SharedPtr m_getSpawnablesNamesService;
         rclcpp::Service<gazebo_msgs::srv::GetWorldProperties>::SharedPtr m_getSpawnPointsNamesService;
@@ -72,13 +98,38 @@ namespace ROS2
             const std::shared_ptr<rmw_request_id_t> header,
             const SpawnEntityRequest request);
 
-        void PreSpawn(
-            AzFramework::EntitySpawnTicket::Id,
-            AzFramework::SpawnableEntityContainerView,
-            const AZ::Transform&,
-            const AZStd::string& spawnableName,
+        //! Validate a spawn request.
+        //! @return the spawnable to be spawned or an error message.
+        AZ::Outcome<AZ::Data::Asset<AzFramework::Spawnable>, AZStd::string> ValidateSpawnRequest(const SpawnRobotInfo& robot) const;
+
+        //! Queue spawning of a validated robot, reusing a pooled robot of the spawnable if there is one.
+        //! The callback is called with the name of the instance once it is spawned, or with an error if no entities were spawned.
+        void SpawnRobot(const SpawnRobotInfo& robot, const AZ::Data::Asset<AzFramework::Spawnable>& spawnable, SpawnCompletion callback);
+
+        //! Set the pose, name and namespace of a robot before its entities are activated.
+        static void PreSpawn(
+            const AZStd::vector<AZ::Entity*>& entities,
+            const AZ::Transform& transform,
+            const AZStd::string& instanceName,
             const AZStd::string& spawnableNamespace);
 
+        //! Attach a spawned robot to the spawner and report it, or report a failure if it has no entities.
+        void CompleteSpawn(
+            const AZStd::vector<AZ::Entity*>& entities,
+            const AZStd::string& instanceName,
+            const AZStd::string& spawnableName,
+            const SpawnCompletion& callback);
+
+        //! Look up the spawned entities of a ticket, in spawn order.
+        static AZStd::vector<AZ::Entity*> FindSpawnedEntities(AzFramework::SpawnableConstEntityContainerView view);
+
+        //! Activate entities in spawn order, or deactivate them in reverse order.
+        static void SetEntitiesActive(const AZStd::vector<AZ::Entity*>& entities, bool active);
+
+        //! Queue deactivation of a robot and park it in the pool.
+        //! @return false if there is no robot with the given instance name.
+        bool QueueDespawn(const AZStd::string& instanceName, AZStd::function<void()> callback);
+
         void DeleteEntity(
             const DeleteEntityServiceHandle service_handle, const std::shared_ptr<rmw_request_id_t> header, DeleteEntityRequest request);
 
@@ -103,7 +103,7 @@ namespace ROS2
         return m_config.m_editorEntityId;
     }
 
-    AZStd::unordered_map<AZStd::string, AZ::Data::Asset<AzFramework::Spawnable>> ROS2SpawnerComponentController::GetSpawnables() const
+    const AZStd::unordered_map<AZStd::string, AZ::Data::Asset<AzFramework::Spawnable>>& ROS2SpawnerComponentController::GetSpawnables() const
     {
         return m_config.m_spawnables;
     }
@@ -77,7 +77,7 @@ namespace ROS2
         const ROS2SpawnerServiceNames& GetServiceNames() const;
         SpawnPointInfoMap GetSpawnPoints() const;
         AZ::EntityId GetEditorEntityId() const;
-        AZStd::unordered_map<AZStd::string, AZ::Data::Asset<AzFramework::Spawnable>> GetSpawnables() const;
+        const AZStd::unordered_map<AZStd::string, AZ::Data::Asset<AzFramework::Spawnable>>& GetSpawnables() const;
         bool GetSupportWGS() const;
 
     private:
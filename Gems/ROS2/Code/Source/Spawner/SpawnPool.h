@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/string/string.h>
+
+namespace ROS2
+{
+    //! Instances of spawnables kept for reuse, per spawnable name.
+    //! Counts how many acquisitions were served by the pool, so that its effect can be observed.
+    //! @tparam InstanceType movable handle of a spawned instance, e.g. the spawn ticket holding its entities.
+    template<typename InstanceType>
+    class SpawnPool
+    {
+    public:
+        //! Numbers of acquisitions served by a pooled instance and of those which found the pool empty.
+        struct Statistics
+        {
+            AZStd::size_t m_reused = 0;
+            AZStd::size_t m_missed = 0;
+        };
+
+        //! Take the most recently released instance of a spawnable.
+        //! @param spawnableName name of the spawnable.
+        //! @return the instance, or nothing if the pool has no instance of the spawnable and a new one has to be spawned.
+        AZStd::optional<InstanceType> Acquire(const AZStd::string& spawnableName)
+        {
+            auto pool = m_instances.find(spawnableName);
+            if (pool == m_instances.end() || pool->second.empty())
+            {
+                ++m_statistics.m_missed;
+                return AZStd::nullopt;
+            }
+            ++m_statistics.m_reused;
+            InstanceType instance = AZStd::move(pool->second.back());
+            pool->second.pop_back();
+            return instance;
+        }
+
+        //! Keep an instance of a spawnable for the following acquisitions.
+        //! @param spawnableName name of the spawnable.
+        //! @param instance the instance, which is not in use anymore.
+        void Release(const AZStd::string& spawnableName, InstanceType instance)
+        {
+            m_instances[spawnableName].push_back(AZStd::move(instance));
+        }
+
+        //! Get the number of instances of a spawnable available in the pool.
+        AZStd::size_t GetPooledCount(const AZStd::string& spawnableName) const
+        {
+            auto pool = m_instances.find(spawnableName);
+            return pool != m_instances.end() ? pool->second.size() : 0;
+        }
+
+        const Statistics& GetStatistics() const
+        {
+            return m_statistics;
+        }
+
+        //! Destroy all pooled instances and reset the statistics.
+        void Clear()
+        {
+            m_instances.clear();
+            m_statistics = {};
+        }
+
+    private:
+        AZStd::unordered_map<AZStd::string, AZStd::vector<InstanceType>> m_instances;
+        Statistics m_statistics;
+    };
+} // namespace ROS2
@@ -35,6 +35,12 @@ namespace ROS2
 {
     constexpr AZStd::string_view ClockTypeConfigurationKey = "/O3DE/ROS2/ClockType";
     constexpr AZStd::string_view PublishClockConfigurationKey = "/O3DE/ROS2/PublishClock";
+    constexpr AZStd::string_view ParallelControlLoopConfigurationKey = "/O3DE/ROS2/ControlLoop/RunInParallel";
+    constexpr AZStd::string_view ControlExecutorThreadConfigurationKey = "/O3DE/ROS2/ControlLoop/DedicatedCommandThread";
+    constexpr AZStd::string_view GroundTruthFrequencyConfigurationKey = "/O3DE/ROS2/GroundTruth/Frequency";
+    constexpr AZStd::string_view GroundTruthAggregatedConfigurationKey = "/O3DE/ROS2/GroundTruth/Aggregated";
+    constexpr AZStd::string_view GroundTruthTopicConfigurationKey = "/O3DE/ROS2/GroundTruth/Topic";
+    constexpr AZStd::string_view GroundTruthFrameIdConfigurationKey = "/O3DE/ROS2/GroundTruth/FrameId";
 
     void ROS2SystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -155,10 +161,65 @@ namespace ROS2
     {
         InitClock();
         m_simulationClock->Activate();
+
+        // Controllers of different robots write to the same physics scene without locking it, so they run sequentially unless
+        // the project opts in.
+        bool runControlLoopInParallel{ false };
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(runControlLoopInParallel, ParallelControlLoopConfigurationKey);
+        }
+        m_controlLoop = AZStd::make_unique<ControlLoop>(runControlLoopInParallel);
+        m_controlLoop->Activate();
+
         m_ros2Node = std::make_shared<rclcpp::Node>("o3de_ros2_node");
         m_executor = AZStd::make_shared<rclcpp::executors::SingleThreadedExecutor>();
         m_executor->add_node(m_ros2Node);
 
+        // Control commands are served by a separate executor on its own thread, so that they reach the physics-rate controllers
+        // without waiting for the next frame. The group is not added to the main executor automatically.
+        bool runControlExecutorThread{ true };
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(runControlExecutorThread, ControlExecutorThreadConfigurationKey);
+        }
+        m_controlCallbackGroup = m_ros2Node->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
+        if (runControlExecutorThread)
+        {
+            m_controlExecutor = AZStd::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+            m_controlExecutor->add_callback_group(m_controlCallbackGroup, m_ros2Node->get_node_base_interface());
+            AZStd::thread_desc threadDesc;
+            threadDesc.m_name = "ROS2 control executor";
+            m_controlExecutorRunning = true;
+            m_controlExecutorThread = AZStd::thread(
+                threadDesc,
+                [this, executor = m_controlExecutor]()
+                {
+                    // Waiting wakes up as soon as a message arrives, the timeout only bounds how long stopping the thread takes.
+                    while (m_controlExecutorRunning && rclcpp::ok())
+                    {
+                        executor->spin_once(std::chrono::milliseconds(100));
+                    }
+                });
+        }
+        else
+        {
+            m_executor->add_callback_group(m_controlCallbackGroup, m_ros2Node->get_node_base_interface());
+        }
+
+        GroundTruthConfiguration groundTruthConfiguration;
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            double groundTruthFrequency = groundTruthConfiguration.m_frequency;
+            registry->Get(groundTruthFrequency, GroundTruthFrequencyConfigurationKey);
+            groundTruthConfiguration.m_frequency = aznumeric_cast<float>(groundTruthFrequency);
+            registry->Get(groundTruthConfiguration.m_aggregated, GroundTruthAggregatedConfigurationKey);
+            registry->Get(groundTruthConfiguration.m_topic, GroundTruthTopicConfigurationKey);
+            registry->Get(groundTruthConfiguration.m_frameId, GroundTruthFrameIdConfigurationKey);
+        }
+        m_groundTruthPublisher = AZStd::make_unique<GroundTruthPublisher>(groundTruthConfiguration);
+        m_groundTruthPublisher->Activate(m_ros2Node);
+
         m_staticTFBroadcaster = AZStd::make_unique<tf2_ros::StaticTransformBroadcaster>(m_ros2Node);
         m_dynamicTFBroadcaster = AZStd::make_unique<tf2_ros::TransformBroadcaster>(m_ros2Node);
 
@@ -171,11 +232,24 @@ namespace ROS2
     {
         AZ::TickBus::Handler::BusDisconnect();
         ROS2RequestBus::Handler::BusDisconnect();
+        m_controlLoop.reset();
+        m_groundTruthPublisher.reset();
         if (m_simulationClock) {
             m_simulationClock->Deactivate();
         }
         m_dynamicTFBroadcaster.reset();
         m_staticTFBroadcaster.reset();
+        if (m_controlExecutor)
+        {
+            m_controlExecutorRunning = false;
+            m_controlExecutor->cancel();
+            if (m_controlExecutorThread.joinable())
+            {
+                m_controlExecutorThread.join();
+            }
+            m_controlExecutor.reset();
+        }
+        m_controlCallbackGroup.reset();
         if (m_executor)
         {
             if (m_ros2Node) {
@@ -208,6 +282,11 @@ namespace ROS2
         return *m_simulationClock;
     }
 
+    rclcpp::CallbackGroup::SharedPtr ROS2SystemComponent::GetControlCallbackGroup() const
+    {
+        return m_controlCallbackGroup;
+    }
+
     void ROS2SystemComponent::BroadcastTransform(const geometry_msgs::msg::TransformStamped& t, bool isDynamic)
     {
         if (isDynamic)
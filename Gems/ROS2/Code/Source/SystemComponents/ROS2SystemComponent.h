@@ -9,8 +9,12 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <GroundTruth/GroundTruthPublisher.h>
 #include <Lidar/LidarSystem.h>
+#include <Utilities/Controllers/ControlLoop.h>
 #include <ROS2/Clock/ROS2Clock.h>
 #include <ROS2/ROS2Bus.h>
 #include <builtin_interfaces/msg/time.hpp>
@@ -64,6 +68,7 @@ namespace ROS2
         builtin_interfaces::msg::Time GetROSTimestamp() const override;
         void BroadcastTransform(const geometry_msgs::msg::TransformStamped& t, bool isDynamic) override;
         const ROS2Clock& GetSimulationClock() const override;
+        rclcpp::CallbackGroup::SharedPtr GetControlCallbackGroup() const override;
         //////////////////////////////////////////////////////////////////////////
 
     protected:
@@ -85,9 +90,15 @@ namespace ROS2
 
         std::shared_ptr<rclcpp::Node> m_ros2Node;
         AZStd::shared_ptr<rclcpp::executors::SingleThreadedExecutor> m_executor;
+        rclcpp::CallbackGroup::SharedPtr m_controlCallbackGroup;
+        AZStd::shared_ptr<rclcpp::executors::SingleThreadedExecutor> m_controlExecutor; //!< Spins m_controlCallbackGroup, if run on its own thread
+        AZStd::thread m_controlExecutorThread;
+        AZStd::atomic_bool m_controlExecutorRunning{ false };
         AZStd::unique_ptr<tf2_ros::TransformBroadcaster> m_dynamicTFBroadcaster;
         AZStd::unique_ptr<tf2_ros::StaticTransformBroadcaster> m_staticTFBroadcaster;
         AZStd::unique_ptr<ROS2Clock> m_simulationClock;
+        AZStd::unique_ptr<ControlLoop> m_controlLoop;
+        AZStd::unique_ptr<GroundTruthPublisher> m_groundTruthPublisher;
         NodeChangedEvent m_nodeChangedEvent;
     };
 } // namespace ROS2
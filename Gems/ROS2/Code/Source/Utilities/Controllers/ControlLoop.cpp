@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ControlLoop.h"
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace ROS2
+{
+    namespace Internal
+    {
+        AZ::EntityId GetTopLevelAncestor(const AZ::EntityId& entityId)
+        {
+            AZ::EntityId topLevelEntityId = entityId;
+            AZ::EntityId parentId;
+            AZ::TransformBus::EventResult(parentId, topLevelEntityId, &AZ::TransformInterface::GetParentId);
+            while (parentId.IsValid())
+            {
+                topLevelEntityId = parentId;
+                parentId.SetInvalid();
+                AZ::TransformBus::EventResult(parentId, topLevelEntityId, &AZ::TransformInterface::GetParentId);
+            }
+            return topLevelEntityId;
+        }
+    } // namespace Internal
+
+    ControlLoop::ControlLoop(bool runInParallel)
+        : m_runInParallel(runInParallel)
+    {
+    }
+
+    ControlLoop::~ControlLoop()
+    {
+        Deactivate();
+    }
+
+    void ControlLoop::Activate()
+    {
+        m_onSceneSimulationStart = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                RunControllers(fixedDeltaTime);
+            },
+            aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Components));
+
+        auto* systemInterface = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        if (!systemInterface)
+        {
+            AZ_Warning("ControlLoop", false, "Failed to get AzPhysics::SystemInterface, controllers will not be run");
+            return;
+        }
+
+        m_onSceneAdded = AzPhysics::SystemEvents::OnSceneAddedEvent::Handler(
+            [this](AzPhysics::SceneHandle sceneHandle)
+            {
+                ConnectToScene(sceneHandle);
+            });
+        systemInterface->RegisterSceneAddedEvent(m_onSceneAdded);
+
+        // The default scene might already exist, for example when the gem is activated after the level is loaded.
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            ConnectToScene(sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName));
+        }
+    }
+
+    void ControlLoop::Deactivate()
+    {
+        m_onSceneAdded.Disconnect();
+        m_onSceneSimulationStart.Disconnect();
+    }
+
+    void ControlLoop::ConnectToScene(AzPhysics::SceneHandle sceneHandle)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (!sceneInterface || sceneHandle == AzPhysics::InvalidSceneHandle ||
+            sceneHandle != sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName))
+        {
+            return;
+        }
+        // The handler is disconnected automatically when the previous default scene is removed.
+        m_onSceneSimulationStart.Disconnect();
+        sceneInterface->RegisterSceneSimulationStartHandler(sceneHandle, m_onSceneSimulationStart);
+    }
+
+    ControlLoopRequests::ControllerHandle ControlLoop::RegisterController(const AZ::EntityId& entityId, ControllerFunction controller)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_controllersMutex);
+        const ControllerHandle handle = ++m_lastHandle;
+        m_controllers.push_back({ handle, entityId, AZStd::move(controller) });
+        m_controllersChanged = true;
+        return handle;
+    }
+
+    void ControlLoop::UnregisterController(ControllerHandle handle)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_controllersMutex);
+        auto it = AZStd::find_if(
+            m_controllers.begin(),
+            m_controllers.end(),
+            [handle](const Controller& controller)
+            {
+                return controller.m_handle == handle;
+            });
+        if (it != m_controllers.end())
+        {
+            m_controllers.erase(it);
+            m_controllersChanged = true;
+        }
+    }
+
+    bool ControlLoop::RebuildRobotControllers()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_controllersMutex);
+        if (!m_controllersChanged)
+        {
+            return false;
+        }
+        m_controllersChanged = false;
+
+        // Robots are resolved here rather than on registration, since the parents of an entity might not be active yet when its
+        // controller is registered.
+        AZStd::unordered_map<AZ::EntityId, size_t> robotIndices;
+        m_robotControllers.clear();
+        for (const auto& controller : m_controllers)
+        {
+            const AZ::EntityId robotId = Internal::GetTopLevelAncestor(controller.m_entityId);
+            auto [it, inserted] = robotIndices.emplace(robotId, m_robotControllers.size());
+            if (inserted)
+            {
+                m_robotControllers.emplace_back();
+            }
+            m_robotControllers[it->second].push_back(controller.m_function);
+        }
+        return true;
+    }
+
+    void ControlLoop::RunControllers(float deltaTime)
+    {
+        // The first step after registrations change is run sequentially, since new controllers usually perform their lazy
+        // initialization then (entity lookups, bus binding), which is not safe to run concurrently.
+        const bool controllersChanged = RebuildRobotControllers();
+
+        if (!m_runInParallel || controllersChanged || m_robotControllers.size() < 2)
+        {
+            for (const auto& controllers : m_robotControllers)
+            {
+                for (const auto& controller : controllers)
+                {
+                    controller(deltaTime);
+                }
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (const auto& controllers : m_robotControllers)
+        {
+            AZ::Job* job = AZ::CreateJobFunction(
+                [&controllers, deltaTime]()
+                {
+                    for (const auto& controller : controllers)
+                    {
+                        controller(deltaTime);
+                    }
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+} // namespace ROS2
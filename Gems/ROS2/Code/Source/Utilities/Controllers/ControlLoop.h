@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
+
+namespace ROS2
+{
+    //! Runs registered controllers on the simulation start event of the default physics scene, once per physics substep.
+    //! Controllers are grouped per robot (top-level ancestor entity). Groups run sequentially by default. They can run in parallel on
+    //! the job system, which is only safe for controllers which do not write to the physics scene, since scene writes are not locked.
+    //! @see ControlLoopRequests
+    class ControlLoop : public ControlLoopInterface::Registrar
+    {
+    public:
+        //! @param runInParallel whether controllers of different robots are run in parallel on the job system.
+        explicit ControlLoop(bool runInParallel = false);
+        ~ControlLoop() override;
+
+        void Activate();
+        void Deactivate();
+
+        // ControlLoopRequests overrides ...
+        ControllerHandle RegisterController(const AZ::EntityId& entityId, ControllerFunction controller) override;
+        void UnregisterController(ControllerHandle handle) override;
+
+        //! Run all registered controllers once. Called on every substep of the default physics scene.
+        //! @param deltaTime simulated time step in seconds.
+        void RunControllers(float deltaTime);
+
+    private:
+        struct Controller
+        {
+            ControllerHandle m_handle = InvalidControllerHandle;
+            AZ::EntityId m_entityId;
+            ControllerFunction m_function;
+        };
+
+        void ConnectToScene(AzPhysics::SceneHandle sceneHandle);
+        //! @return true if the controllers were rebuilt because registrations changed.
+        bool RebuildRobotControllers();
+
+        bool m_runInParallel = false;
+        ControllerHandle m_lastHandle = InvalidControllerHandle;
+
+        AZStd::mutex m_controllersMutex; //!< Guards m_controllers and m_controllersChanged
+        AZStd::vector<Controller> m_controllers; //!< Registered controllers in order of registration
+        bool m_controllersChanged = false;
+
+        //! Controllers grouped per robot, rebuilt on the first substep after registrations change.
+        //! Only accessed from the thread running the physics simulation.
+        AZStd::vector<AZStd::vector<ControllerFunction>> m_robotControllers;
+
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_onSceneSimulationStart;
+        AzPhysics::SystemEvents::OnSceneAddedEvent::Handler m_onSceneAdded;
+    };
+} // namespace ROS2
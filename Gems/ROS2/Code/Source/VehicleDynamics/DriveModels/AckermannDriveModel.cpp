@@ -76,15 +76,10 @@ namespace ROS2::VehicleDynamics
 
     void AckermannDriveModel::ApplyWheelSteering(SteeringDynamicsData& wheelData, float steering, double deltaTimeNs)
     {
-        const auto& steeringEntity = wheelData.m_steeringEntity;
-        const auto& jointComponent = wheelData.m_steeringJoint;
-
-        auto id = AZ::EntityComponentIdPair(steeringEntity, jointComponent);
-
         if (wheelData.m_isArticulation)
         {
             PhysX::ArticulationJointRequestBus::Event(
-                steeringEntity,
+                wheelData.m_articulationBus,
                 [&](PhysX::ArticulationJointRequests* joint)
                 {
                     double currentSteeringAngle = joint->GetJointPosition(wheelData.m_axis);
@@ -95,7 +90,7 @@ namespace ROS2::VehicleDynamics
         else
         {
             PhysX::JointRequestBus::Event(
-                id,
+                wheelData.m_jointBus,
                 [&](PhysX::JointRequests* joint)
                 {
                     double currentSteeringAngle = joint->GetPosition();
@@ -98,7 +98,7 @@ namespace ROS2::VehicleDynamics
         AZ::ComponentApplicationBus::BroadcastResult(wheelEntityPtr, &AZ::ComponentApplicationRequests::FindEntity, wheelEntityId);
         AZ_Assert(wheelEntityPtr, "The wheelEntity should not be null here");
         out.wheelControllerComponentPtr = Utils::GetGameOrEditorComponent<WheelControllerComponent>(wheelEntityPtr);
-        out.wheelData = VehicleDynamics::Utilities::GetWheelData(wheelEntityId, axle.m_wheelRadius);
+        out.wheelData = VehicleDynamics::Utilities::GetWheelData(*wheelEntityPtr, axle.m_wheelRadius);
         if (out.wheelControllerComponentPtr)
         {
             const auto wheelsCount = axle.m_axleWheels.size();
@@ -140,6 +140,10 @@ namespace ROS2::VehicleDynamics::Utilities
                 {
                     steeringData.m_steeringJoint = hingeComponent->GetId();
                 }
+                // Bind bus addresses once, so that the drive model does not look them up at every physics step
+                PhysX::ArticulationJointRequestBus::Bind(steeringData.m_articulationBus, steeringData.m_steeringEntity);
+                PhysX::JointRequestBus::Bind(
+                    steeringData.m_jointBus, AZ::EntityComponentIdPair(steeringData.m_steeringEntity, steeringData.m_steeringJoint));
                 steeringEntitiesAndAxis.push_back(steeringData);
             }
         }
@@ -181,8 +185,7 @@ namespace ROS2::VehicleDynamics::Utilities
                     continue;
                 }
 
-                VehicleDynamics::WheelDynamicsData wheelData = GetWheelData(wheel, axle.m_wheelRadius);
-                driveWheelEntities.push_back(wheelData);
+                driveWheelEntities.push_back(GetWheelData(*wheelEntity, axle.m_wheelRadius));
             }
         }
         return driveWheelEntities;
@@ -190,26 +193,34 @@ namespace ROS2::VehicleDynamics::Utilities
 
     VehicleDynamics::WheelDynamicsData GetWheelData(const AZ::EntityId wheelEntityId, float wheelRadius)
     {
-        VehicleDynamics::WheelDynamicsData wheelData;
-        wheelData.m_wheelEntity = wheelEntityId;
-        wheelData.m_wheelRadius = wheelRadius;
         AZ::Entity* wheelEntity = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(wheelEntity, &AZ::ComponentApplicationRequests::FindEntity, wheelEntityId);
         if (!wheelEntity)
         {
             AZ_Warning("GetWheelDynamicData", false, "Entity %s was not found", wheelEntityId.ToString().c_str());
+            VehicleDynamics::WheelDynamicsData wheelData;
+            wheelData.m_wheelEntity = wheelEntityId;
+            wheelData.m_wheelRadius = wheelRadius;
             return wheelData;
         }
-        PhysX::HingeJointComponent* hingeComponent{ nullptr };
-        hingeComponent = wheelEntity->FindComponent<PhysX::HingeJointComponent>();
+        return GetWheelData(*wheelEntity, wheelRadius);
+    }
+
+    VehicleDynamics::WheelDynamicsData GetWheelData(const AZ::Entity& wheelEntity, float wheelRadius)
+    {
+        const AZ::EntityId wheelEntityId = wheelEntity.GetId();
+        VehicleDynamics::WheelDynamicsData wheelData;
+        wheelData.m_wheelEntity = wheelEntityId;
+        wheelData.m_wheelRadius = wheelRadius;
 
-        PhysX::ArticulationLinkComponent* articulationComponent{ nullptr };
-        articulationComponent = wheelEntity->FindComponent<PhysX::ArticulationLinkComponent>();
+        const auto* hingeComponent = wheelEntity.FindComponent<PhysX::HingeJointComponent>();
+        const auto* articulationComponent = wheelEntity.FindComponent<PhysX::ArticulationLinkComponent>();
 
         if (hingeComponent)
         {
             wheelData.m_isArticulation = false;
             wheelData.m_wheelJoint = hingeComponent->GetId();
+            PhysX::JointRequestBus::Bind(wheelData.m_jointBus, AZ::EntityComponentIdPair(wheelEntityId, wheelData.m_wheelJoint));
             return wheelData;
         }
         if (articulationComponent)
@@ -217,6 +228,7 @@ namespace ROS2::VehicleDynamics::Utilities
             wheelData.m_isArticulation = true;
             Utils::TryGetFreeArticulationAxis(wheelEntityId, wheelData.m_axis);
             wheelData.m_wheelJoint = articulationComponent->GetId();
+            PhysX::ArticulationJointRequestBus::Bind(wheelData.m_articulationBus, wheelEntityId);
             return wheelData;
         }
 
@@ -249,12 +261,11 @@ namespace ROS2::VehicleDynamics::Utilities
         if (data.m_isArticulation)
         {
             PhysX::ArticulationJointRequestBus::Event(
-                data.m_wheelEntity, &PhysX::ArticulationJointRequests::SetDriveTargetVelocity, data.m_axis, wheelRotationSpeed);
+                data.m_articulationBus, &PhysX::ArticulationJointRequests::SetDriveTargetVelocity, data.m_axis, wheelRotationSpeed);
         }
         else
         {
-            PhysX::JointRequestBus::Event(
-                AZ::EntityComponentIdPair(data.m_wheelEntity, data.m_wheelJoint), &PhysX::JointRequests::SetVelocity, wheelRotationSpeed);
+            PhysX::JointRequestBus::Event(data.m_jointBus, &PhysX::JointRequests::SetVelocity, wheelRotationSpeed);
         }
     }
 
@@ -263,8 +274,7 @@ namespace ROS2::VehicleDynamics::Utilities
         AZ::Transform hingeTransform{ AZ::Transform::Identity() };
         if (!data.m_isArticulation)
         {
-            PhysX::JointRequestBus::EventResult(
-                hingeTransform, AZ::EntityComponentIdPair(data.m_wheelEntity, data.m_wheelJoint), &PhysX::JointRequests::GetTransform);
+            PhysX::JointRequestBus::EventResult(hingeTransform, data.m_jointBus, &PhysX::JointRequests::GetTransform);
         }
         return hingeTransform;
     }
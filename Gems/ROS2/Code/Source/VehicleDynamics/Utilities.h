@@ -60,6 +60,12 @@ namespace ROS2::VehicleDynamics::Utilities
     //! @returns struct with wheel data.
     VehicleDynamics::WheelDynamicsData GetWheelData(const AZ::EntityId wheelEntityId, float wheelRadius);
 
+    //! Retrieve wheel data for an already found wheel entity, avoiding another entity lookup.
+    //! @param wheelEntity Wheel entity to process.
+    //! @param wheelRadius Radius of the wheel in meters.
+    //! @returns struct with wheel data, including joint bus addresses bound for direct dispatch.
+    VehicleDynamics::WheelDynamicsData GetWheelData(const AZ::Entity& wheelEntity, float wheelRadius);
+
     //! Computes ramped velocity.
     //! @param targetVelocity Last commanded velocity to send to robot (in eg m/s or rad/s)
     //! @param lastVelocity Last commanded Velocity (in eg m/s or rad/s)
@@ -70,6 +76,9 @@ namespace ROS2::VehicleDynamics::Utilities
     float ComputeRampVelocity(float targetVelocity, float lastVelocity, AZ::u64 deltaTimeNs, float acceleration, float maxVelocity);
 
 
+    //! Set the rotation speed of a wheel, using the bus address bound when the wheel data was gathered.
+    //! @param data Wheel data acquired through GetWheelData or GetAllDriveWheelsData.
+    //! @param wheelRotationSpeed Target rotation speed in rad/s.
     void SetWheelRotationSpeed(const  VehicleDynamics::WheelDynamicsData& data, float wheelRotationSpeed);
 
     AZ::Transform GetJointTransform(const VehicleDynamics::WheelDynamicsData& data);
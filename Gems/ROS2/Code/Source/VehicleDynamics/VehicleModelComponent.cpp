@@ -27,12 +27,24 @@ namespace ROS2::VehicleDynamics
         {
             m_manualControlEventHandler.Activate(GetEntityId());
         }
-        AZ::TickBus::Handler::BusConnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            m_controllerHandle = controlLoop->RegisterController(
+                GetEntityId(),
+                [this](float deltaTime)
+                {
+                    Control(deltaTime);
+                });
+        }
     }
 
     void VehicleModelComponent::Deactivate()
     {
-        AZ::TickBus::Handler::BusDisconnect();
+        if (auto* controlLoop = ControlLoopInterface::Get())
+        {
+            controlLoop->UnregisterController(m_controllerHandle);
+        }
+        m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
         m_manualControlEventHandler.Deactivate();
         VehicleInputControlRequestBus::Handler::BusDisconnect();
     }
@@ -123,7 +135,7 @@ namespace ROS2::VehicleDynamics
         m_inputsState.m_angularRates.UpdateValue(maxState.m_angularRates * rateFractionZ);
     };
 
-    void VehicleModelComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void VehicleModelComponent::Control(float deltaTime)
     {
         const uint64_t deltaTimeNs = deltaTime * 1'000'000'000;
         GetDriveModel()->ApplyInputState(m_inputsState.GetValueCheckingDeadline(), deltaTimeNs);
@@ -12,9 +12,9 @@
 #include "VehicleConfiguration.h"
 #include "VehicleInputs.h"
 #include <AzCore/Component/Component.h>
-#include <AzCore/Component/TickBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/utils.h>
+#include <ROS2/Utilities/Controllers/ControlLoopBus.h>
 #include <ROS2/VehicleDynamics/VehicleInputControlBus.h>
 #include <VehicleDynamics/VehicleModelLimits.h>
 
@@ -24,7 +24,6 @@ namespace ROS2::VehicleDynamics
     class VehicleModelComponent
         : public AZ::Component
         , private VehicleInputControlRequestBus::Handler
-        , private AZ::TickBus::Handler
     {
     public:
         AZ_RTTI(VehicleModelComponent, "{7093AE7A-9F64-4C77-8189-02C6B7802C1A}", AZ::Component);
@@ -37,7 +36,8 @@ namespace ROS2::VehicleDynamics
         static void Reflect(AZ::ReflectContext* context);
 
     private:
-        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        //! Run by the control loop at every physics substep.
+        void Control(float deltaTime);
 
         // VehicleInputControlRequestBus::Handler overrides
         void SetTargetLinearSpeed(float speedMpsX) override;
@@ -58,5 +58,8 @@ namespace ROS2::VehicleDynamics
         VehicleInputDeadline m_inputsState;
         VehicleConfiguration m_vehicleConfiguration;
         virtual DriveModel* GetDriveModel() = 0;
+
+    private:
+        ControlLoopRequests::ControllerHandle m_controllerHandle = ControlLoopRequests::InvalidControllerHandle;
     };
 } // namespace ROS2::VehicleDynamics
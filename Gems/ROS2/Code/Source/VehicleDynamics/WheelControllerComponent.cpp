@@ -49,9 +49,8 @@ namespace ROS2::VehicleDynamics
         AZ_Assert(m_rigidBodyPtr, "No Rigid Body in the WheelController entity!");
         if (m_rigidBodyPtr)
         {
-            const auto transform = m_rigidBodyPtr->GetTransform().GetInverse();
-            const auto local = transform.TransformVector(m_rigidBodyPtr->GetAngularVelocity());
-            return local;
+            // Only the rotation is needed to express the velocity in the local frame, which is cheaper than inverting the transform.
+            return m_rigidBodyPtr->GetOrientation().GetConjugate().TransformVector(m_rigidBodyPtr->GetAngularVelocity());
         }
         return AZ::Vector3::CreateZero();
     }
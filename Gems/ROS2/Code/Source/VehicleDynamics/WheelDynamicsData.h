@@ -9,7 +9,9 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Component/EntityId.h>
+#include <PhysX/ArticulationJointBus.h>
 #include <PhysX/ArticulationTypes.h>
+#include <PhysX/Joint/PhysXJointRequestsBus.h>
 
 namespace ROS2::VehicleDynamics
 {
@@ -22,6 +24,8 @@ namespace ROS2::VehicleDynamics
         bool m_isArticulation{ false }; //!< Whether the wheel is an articulation link or a classic joint.
         PhysX::ArticulationJointAxis m_axis =
             PhysX::ArticulationJointAxis::Twist; //!< The movement axis, in case the joint is an articulation.
+        PhysX::JointRequestBus::BusPtr m_jointBus; //!< Joint bus address, bound once so commands skip the address lookup.
+        PhysX::ArticulationJointRequestBus::BusPtr m_articulationBus; //!< Articulation bus address, bound once for the same reason.
     };
 
     //! Data structure to pass steering dynamics data for a single steering entity.
@@ -33,5 +37,7 @@ namespace ROS2::VehicleDynamics
         bool m_isArticulation{ false }; //!< Whether the steering is an articulation link or a classic joint.
         PhysX::ArticulationJointAxis m_axis =
             PhysX::ArticulationJointAxis::Twist; //!< The movement axis, in case the joint is an articulation.
+        PhysX::JointRequestBus::BusPtr m_jointBus; //!< Joint bus address, bound once so commands skip the address lookup.
+        PhysX::ArticulationJointRequestBus::BusPtr m_articulationBus; //!< Articulation bus address, bound once for the same reason.
     };
 } // namespace ROS2::VehicleDynamics
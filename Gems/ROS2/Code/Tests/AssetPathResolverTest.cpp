@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/Utils/AssetPathResolver.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <SdfAssetBuilder/SdfAssetBuilderSettings.h>
+
+namespace UnitTest
+{
+    //! ROS 2 package with a URDF robot made of a chain of links, each with its own visual and collision mesh.
+    //! The package is installed in a temporary ament prefix: <prefix>/share/synthetic_robot/{package.xml,meshes,urdf}.
+    class SyntheticRobotPackage
+    {
+    public:
+        explicit SyntheticRobotPackage(int linkCount)
+        {
+            m_amentPrefixPath = m_tempDirectory.GetDirectory();
+            const AZ::IO::Path packagePath = AZ::IO::Path(m_amentPrefixPath) / "share" / "synthetic_robot";
+            m_meshesPath = packagePath / "meshes";
+            m_urdfPath = packagePath / "urdf" / "synthetic_robot.urdf";
+            AZ::IO::SystemFile::CreateDir(m_meshesPath.c_str());
+            AZ::IO::SystemFile::CreateDir(m_urdfPath.ParentPath().String().c_str());
+            AZ::Utils::WriteFile("<package format=\"3\"><name>synthetic_robot</name></package>", (packagePath / "package.xml").Native());
+
+            m_urdf = "<robot name=\"synthetic_robot\">";
+            for (int i = 0; i < linkCount; ++i)
+            {
+                // Every mesh gets distinct content, so each one has its own checksum.
+                AZ::Utils::WriteFile(
+                    AZStd::string::format("solid link_%d\nendsolid link_%d\n", i, i),
+                    (m_meshesPath / AZStd::string::format("link_%d.stl", i)).Native());
+                AZ::Utils::WriteFile(
+                    AZStd::string::format("solid collision_%d\nendsolid collision_%d\n", i, i),
+                    (m_meshesPath / AZStd::string::format("link_%d_collision.stl", i)).Native());
+
+                m_urdf += AZStd::string::format(
+                    "<link name=\"link_%d\">"
+                    "  <inertial><mass value=\"1.0\"/><inertia ixx=\"1.0\" iyy=\"1.0\" izz=\"1.0\" ixy=\"0\" ixz=\"0\" iyz=\"0\"/></inertial>"
+                    "  <visual><geometry><mesh filename=\"package://synthetic_robot/meshes/link_%d.stl\"/></geometry></visual>"
+                    "  <collision><geometry><mesh filename=\"package://synthetic_robot/meshes/link_%d_collision.stl\"/></geometry></collision>"
+                    "</link>",
+                    i, i, i);
+                if (i > 0)
+                {
+                    m_urdf += AZStd::string::format(
+                        "<joint name=\"joint_%d\" type=\"continuous\">"
+                        "  <parent link=\"link_%d\"/><child link=\"link_%d\"/><axis xyz=\"0 0 1\"/>"
+                        "</joint>",
+                        i, i - 1, i);
+                }
+            }
+            m_urdf += "</robot>";
+            AZ::Utils::WriteFile(m_urdf, m_urdfPath.Native());
+        }
+
+        //! @return references to all meshes of the robot.
+        ROS2::Utils::AssetFilenameReferences GetReferencedAssetFilenames() const
+        {
+            sdf::ParserConfig parserConfig;
+            const auto sdfRootOutcome = ROS2::UrdfParser::Parse(m_urdf, parserConfig);
+            if (!sdfRootOutcome)
+            {
+                return {};
+            }
+            return ROS2::Utils::GetReferencedAssetFilenames(sdfRootOutcome.GetRoot());
+        }
+
+        static ROS2::SdfAssetBuilderSettings GetSettings()
+        {
+            ROS2::SdfAssetBuilderSettings settings;
+            settings.m_resolverSettings.m_useAmentPrefixPath = true;
+            settings.m_resolverSettings.m_useAncestorPaths = true;
+            settings.m_resolverSettings.m_uriPrefixMap.emplace("model://", AZStd::vector<AZStd::string>({ "." }));
+            settings.m_resolverSettings.m_uriPrefixMap.emplace("package://", AZStd::vector<AZStd::string>({ "." }));
+            return settings;
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::string m_amentPrefixPath;
+        AZ::IO::Path m_meshesPath;
+        AZ::IO::Path m_urdfPath;
+        AZStd::string m_urdf;
+    };
+
+    //! Runs the job system, so that references are resolved in parallel.
+    class AssetPathResolverTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::JobManagerDesc jobManagerDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown() override
+        {
+            ROS2::Utils::AssetPathResolver::Get().Clear();
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    TEST_F(AssetPathResolverTest, ResolvesLikeResolveAssetPath)
+    {
+        SyntheticRobotPackage package(50);
+        auto assetFilenames = package.GetReferencedAssetFilenames();
+        ASSERT_EQ(assetFilenames.size(), 100);
+        assetFilenames.emplace("package://synthetic_robot/meshes/missing.stl", ROS2::Utils::ReferencedAssetType::VisualMesh);
+        assetFilenames.emplace("meshes/link_0.stl", ROS2::Utils::ReferencedAssetType::VisualMesh);
+
+        const auto settings = SyntheticRobotPackage::GetSettings();
+        // The second pass is answered from cached resolutions.
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            const auto resolvedPaths = ROS2::Utils::AssetPathResolver::Get().ResolveAssetPaths(
+                assetFilenames, package.m_urdfPath, package.m_amentPrefixPath, settings);
+            ASSERT_EQ(resolvedPaths.size(), assetFilenames.size());
+            for (const auto& [uri, resolvedPath] : resolvedPaths)
+            {
+                const AZ::IO::Path expectedPath =
+                    ROS2::Utils::ResolveAssetPath(AZ::IO::Path(uri), package.m_urdfPath, package.m_amentPrefixPath, settings);
+                EXPECT_EQ(resolvedPath.m_resolvedPath, expectedPath) << uri.c_str();
+                EXPECT_EQ(resolvedPath.m_fileCRC, expectedPath.empty() ? AZ::Crc32() : ROS2::Utils::GetFileCRC(expectedPath));
+            }
+            EXPECT_TRUE(resolvedPaths.at("package://synthetic_robot/meshes/missing.stl").m_resolvedPath.empty());
+            EXPECT_TRUE(resolvedPaths.at("meshes/link_0.stl").m_resolvedPath.empty());
+        }
+    }
+
+    TEST_F(AssetPathResolverTest, ResolvesFilesInCreatedDirectory)
+    {
+        SyntheticRobotPackage package(1);
+        const auto settings = SyntheticRobotPackage::GetSettings();
+        ROS2::Utils::AssetFilenameReferences assetFilenames;
+        assetFilenames.emplace("package://synthetic_robot/textures/link_0.png", ROS2::Utils::ReferencedAssetType::Texture);
+
+        auto resolvedPaths = ROS2::Utils::AssetPathResolver::Get().ResolveAssetPaths(
+            assetFilenames, package.m_urdfPath, package.m_amentPrefixPath, settings);
+        EXPECT_TRUE(resolvedPaths.begin()->second.m_resolvedPath.empty());
+
+        // The cached resolution probed the missing directory, so it is resolved again once the directory exists.
+        const AZ::IO::Path texturesPath = package.m_meshesPath.ParentPath() / "textures";
+        AZ::IO::SystemFile::CreateDir(texturesPath.c_str());
+        AZ::Utils::WriteFile("png", (texturesPath / "link_0.png").Native());
+
+        resolvedPaths = ROS2::Utils::AssetPathResolver::Get().ResolveAssetPaths(
+            assetFilenames, package.m_urdfPath, package.m_amentPrefixPath, settings);
+        EXPECT_EQ(resolvedPaths.begin()->second.m_resolvedPath, texturesPath / "link_0.png");
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Resolves the meshes of a synthetic robot with 1000 links, 2000 references in total.
+    class AssetPathResolverBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpResolver();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpResolver();
+        }
+        void TearDown(const benchmark::State& state) override
+        {
+            TearDownResolver();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            TearDownResolver();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void SetUpResolver()
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            const unsigned int workerCount = AZStd::max(1u, AZStd::thread::hardware_concurrency());
+            for (unsigned int i = 0; i < workerCount; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_package = AZStd::make_unique<UnitTest::SyntheticRobotPackage>(1000);
+            m_assetFilenames = m_package->GetReferencedAssetFilenames();
+            m_settings = UnitTest::SyntheticRobotPackage::GetSettings();
+        }
+
+        void TearDownResolver()
+        {
+            ROS2::Utils::AssetPathResolver::Get().Clear();
+            m_assetFilenames = {};
+            m_package.reset();
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<UnitTest::SyntheticRobotPackage> m_package;
+        ROS2::Utils::AssetFilenameReferences m_assetFilenames;
+        ROS2::SdfAssetBuilderSettings m_settings;
+    };
+
+    //! Baseline: every reference resolved with ResolveAssetPath and checksummed one after another.
+    BENCHMARK_F(AssetPathResolverBenchmarkFixture, BM_ResolveSerially)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const auto& [uri, assetReferenceType] : m_assetFilenames)
+            {
+                const AZ::IO::Path resolvedPath =
+                    ROS2::Utils::ResolveAssetPath(AZ::IO::Path(uri), m_package->m_urdfPath, m_package->m_amentPrefixPath, m_settings);
+                benchmark::DoNotOptimize(ROS2::Utils::GetFileCRC(resolvedPath));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_assetFilenames.size());
+    }
+
+    //! Parallel resolution with empty caches, as for the first import in a process.
+    BENCHMARK_F(AssetPathResolverBenchmarkFixture, BM_ResolveInParallel_Cold)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            ROS2::Utils::AssetPathResolver::Get().Clear();
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(ROS2::Utils::AssetPathResolver::Get().ResolveAssetPaths(
+                m_assetFilenames, m_package->m_urdfPath, m_package->m_amentPrefixPath, m_settings));
+        }
+        state.SetItemsProcessed(state.iterations() * m_assetFilenames.size());
+    }
+
+    //! Parallel resolution with cached listings and resolutions, as for CreateJobs and ProcessJob of the same file.
+    BENCHMARK_F(AssetPathResolverBenchmarkFixture, BM_ResolveInParallel_Warm)(benchmark::State& state)
+    {
+        ROS2::Utils::AssetPathResolver::Get().ResolveAssetPaths(
+            m_assetFilenames, m_package->m_urdfPath, m_package->m_amentPrefixPath, m_settings);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(ROS2::Utils::AssetPathResolver::Get().ResolveAssetPaths(
+                m_assetFilenames, m_package->m_urdfPath, m_package->m_amentPrefixPath, m_settings));
+        }
+        state.SetItemsProcessed(state.iterations() * m_assetFilenames.size());
+    }
+} // namespace Benchmark
+#endif
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+
+#include <Utilities/Controllers/ControlLoop.h>
+
+namespace UnitTest
+{
+    //! Runs the job system, so that the parallel control loop dispatches robots to worker threads.
+    //! Entities of the test have no transform, so every entity is a robot of its own.
+    class ControlLoopTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::JobManagerDesc jobManagerDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        //! Calls of the controllers of one robot, only written by the controllers of that robot.
+        struct RobotCalls
+        {
+            AZStd::vector<int> m_controllerIndices;
+            AZStd::vector<AZStd::thread_id> m_threads;
+            float m_lastDeltaTime = 0.0f;
+        };
+
+        //! Register two controllers for each robot, which record their calls.
+        static void RegisterRobots(ROS2::ControlLoop& controlLoop, AZStd::vector<RobotCalls>& robotCalls)
+        {
+            for (size_t robot = 0; robot < robotCalls.size(); ++robot)
+            {
+                const AZ::EntityId entityId(robot + 1);
+                for (int controllerIndex = 0; controllerIndex < 2; ++controllerIndex)
+                {
+                    controlLoop.RegisterController(
+                        entityId,
+                        [&calls = robotCalls[robot], controllerIndex](float deltaTime)
+                        {
+                            calls.m_controllerIndices.push_back(controllerIndex);
+                            calls.m_threads.push_back(AZStd::this_thread::get_id());
+                            calls.m_lastDeltaTime = deltaTime;
+                        });
+                }
+            }
+        }
+
+    private:
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    TEST_F(ControlLoopTest, DefaultIsSequential_AllControllersRunOnCallingThread)
+    {
+        ROS2::ControlLoop controlLoop;
+        AZStd::vector<RobotCalls> robotCalls(4);
+        RegisterRobots(controlLoop, robotCalls);
+
+        constexpr int StepCount = 3;
+        for (int step = 0; step < StepCount; ++step)
+        {
+            controlLoop.RunControllers(0.01f);
+        }
+
+        for (const auto& calls : robotCalls)
+        {
+            ASSERT_EQ(2 * StepCount, calls.m_controllerIndices.size());
+            for (size_t i = 0; i < calls.m_controllerIndices.size(); ++i)
+            {
+                EXPECT_EQ(aznumeric_cast<int>(i % 2), calls.m_controllerIndices[i]);
+                EXPECT_EQ(AZStd::this_thread::get_id(), calls.m_threads[i]);
+            }
+            EXPECT_FLOAT_EQ(0.01f, calls.m_lastDeltaTime);
+        }
+    }
+
+    TEST_F(ControlLoopTest, Parallel_EveryControllerRunsOncePerStepInRegistrationOrder)
+    {
+        ROS2::ControlLoop controlLoop(true);
+        AZStd::vector<RobotCalls> robotCalls(8);
+        RegisterRobots(controlLoop, robotCalls);
+
+        constexpr int StepCount = 10;
+        for (int step = 0; step < StepCount; ++step)
+        {
+            controlLoop.RunControllers(0.02f);
+        }
+
+        for (const auto& calls : robotCalls)
+        {
+            ASSERT_EQ(2 * StepCount, calls.m_controllerIndices.size());
+            // The first step after registration runs sequentially on the calling thread.
+            EXPECT_EQ(AZStd::this_thread::get_id(), calls.m_threads[0]);
+            EXPECT_EQ(AZStd::this_thread::get_id(), calls.m_threads[1]);
+            for (size_t i = 0; i < calls.m_controllerIndices.size(); ++i)
+            {
+                EXPECT_EQ(aznumeric_cast<int>(i % 2), calls.m_controllerIndices[i]);
+            }
+            // Controllers of one robot run in the same job.
+            for (size_t i = 2; i < calls.m_threads.size(); i += 2)
+            {
+                EXPECT_EQ(calls.m_threads[i], calls.m_threads[i + 1]);
+            }
+            EXPECT_FLOAT_EQ(0.02f, calls.m_lastDeltaTime);
+        }
+    }
+
+    TEST_F(ControlLoopTest, UnregisteredController_NotRunInEitherMode)
+    {
+        for (const bool runInParallel : { false, true })
+        {
+            ROS2::ControlLoop controlLoop(runInParallel);
+            int keptCalls = 0;
+            int removedCalls = 0;
+            controlLoop.RegisterController(
+                AZ::EntityId(1),
+                [&keptCalls](float)
+                {
+                    ++keptCalls;
+                });
+            const auto removedHandle = controlLoop.RegisterController(
+                AZ::EntityId(2),
+                [&removedCalls](float)
+                {
+                    ++removedCalls;
+                });
+
+            controlLoop.RunControllers(0.01f);
+            controlLoop.UnregisterController(removedHandle);
+            controlLoop.UnregisterController(ROS2::ControlLoopRequests::InvalidControllerHandle);
+            controlLoop.RunControllers(0.01f);
+            controlLoop.RunControllers(0.01f);
+
+            EXPECT_EQ(3, keptCalls);
+            EXPECT_EQ(1, removedCalls);
+        }
+    }
+} // namespace UnitTest
@@ -96,4 +96,72 @@ namespace UnitTest
             EXPECT_NEAR(result.m_altitude, goldResult.m_altitude, OneMillimiter);
         }
     }
+
+    TEST_F(GNSSTest, ENUFrameMatchesScalarConversions)
+    {
+        using namespace ROS2::WGS;
+        using namespace ROS2::Utils::GeodeticConversions;
+        const AZStd::vector<WGS84Coordinate> references = {
+            { 50.0, -120.0, -100.0 }, { 11.0, 21.0, 400.0 }, { -72.0, 169.0, 1000.0 }, { 0.0, 0.0, 0.0 }, { 89.9, 45.0, 10.0 }
+        };
+        const AZStd::vector<Vector3d> ECEFPoints = { { -2053900.0, -3557459.0, 4862712.0 },
+                                                     { 5903307.167667380, 2148628.092761247, 1100300.642188661 },
+                                                     { -2154856.524084172, 379959.3447517005, -5971509.853428957 } };
+        const AZStd::vector<Vector3d> ENUPoints = { { -0.076833, -0.3202, -0.2969 },
+                                                    { -109638.9539891188, -110428.2398398574, -2004.501240225796 },
+                                                    { 38187.58712786288, 222803.8182465429, -4497.428919329745 } };
+        for (const auto& reference : references)
+        {
+            const ENUFrame frame(reference);
+            for (const auto& ECEFPoint : ECEFPoints)
+            {
+                const auto expected = ECEFToENU(reference, ECEFPoint);
+                const auto result = frame.ECEFToENU(ECEFPoint);
+                EXPECT_NEAR(result.m_x, expected.m_x, OneMillimiter);
+                EXPECT_NEAR(result.m_y, expected.m_y, OneMillimiter);
+                EXPECT_NEAR(result.m_z, expected.m_z, OneMillimiter);
+            }
+            for (const auto& ENUPoint : ENUPoints)
+            {
+                const auto expected = ENUToECEF(reference, ENUPoint);
+                const auto result = frame.ENUToECEF(ENUPoint);
+                EXPECT_NEAR(result.m_x, expected.m_x, OneMillimiter);
+                EXPECT_NEAR(result.m_y, expected.m_y, OneMillimiter);
+                EXPECT_NEAR(result.m_z, expected.m_z, OneMillimiter);
+            }
+        }
+    }
+
+    TEST_F(GNSSTest, ENUFrameBatchConversions)
+    {
+        using namespace ROS2::WGS;
+        using namespace ROS2::Utils::GeodeticConversions;
+        const WGS84Coordinate reference{ 11.0, 21.0, 400.0 };
+        const ENUFrame frame(reference);
+
+        AZStd::vector<Vector3d> ENUPoints;
+        for (int i = 0; i < 100; ++i)
+        {
+            ENUPoints.emplace_back(i * 100.0 - 5000.0, 3000.0 - i * 70.0, i * 0.5);
+        }
+
+        AZStd::vector<Vector3d> ECEFPoints(ENUPoints.size());
+        frame.ENUToECEF(ENUPoints, ECEFPoints);
+        for (size_t i = 0; i < ENUPoints.size(); ++i)
+        {
+            const auto expected = ENUToECEF(reference, ENUPoints[i]);
+            EXPECT_NEAR(ECEFPoints[i].m_x, expected.m_x, OneMillimiter);
+            EXPECT_NEAR(ECEFPoints[i].m_y, expected.m_y, OneMillimiter);
+            EXPECT_NEAR(ECEFPoints[i].m_z, expected.m_z, OneMillimiter);
+        }
+
+        // Convert back in place, which should result in the original points
+        frame.ECEFToENU(ECEFPoints, ECEFPoints);
+        for (size_t i = 0; i < ENUPoints.size(); ++i)
+        {
+            EXPECT_NEAR(ECEFPoints[i].m_x, ENUPoints[i].m_x, OneMillimiter);
+            EXPECT_NEAR(ECEFPoints[i].m_y, ENUPoints[i].m_y, OneMillimiter);
+            EXPECT_NEAR(ECEFPoints[i].m_z, ENUPoints[i].m_z, OneMillimiter);
+        }
+    }
 } // namespace UnitTest
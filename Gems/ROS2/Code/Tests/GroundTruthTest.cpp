@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+#include <GroundTruth/ROS2GroundTruthComponent.h>
+
+namespace UnitTest
+{
+    class GroundTruthTest : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(GroundTruthTest, FrameNamespace_UsedAsRobotName)
+    {
+        EXPECT_EQ("robot_1", ROS2::ROS2GroundTruthComponent::GetRobotName("robot_1", "Robot Entity"));
+        EXPECT_EQ("fleet/robot_1", ROS2::ROS2GroundTruthComponent::GetRobotName("fleet/robot_1", "Robot Entity"));
+    }
+
+    TEST_F(GroundTruthTest, NoFrameNamespace_EntityNameRosified)
+    {
+        EXPECT_EQ("husky", ROS2::ROS2GroundTruthComponent::GetRobotName("", "husky"));
+        EXPECT_EQ("My_Robot__1_", ROS2::ROS2GroundTruthComponent::GetRobotName("", "My Robot (1)"));
+        EXPECT_EQ("o3de_2nd_robot", ROS2::ROS2GroundTruthComponent::GetRobotName("", "2nd-robot"));
+    }
+
+    TEST_F(GroundTruthTest, NoValidName_RobotNotRegistered)
+    {
+        EXPECT_TRUE(ROS2::ROS2GroundTruthComponent::GetRobotName("", "").empty());
+        EXPECT_TRUE(ROS2::ROS2GroundTruthComponent::GetRobotName("robot//1", "Robot Entity").empty());
+        EXPECT_TRUE(ROS2::ROS2GroundTruthComponent::GetRobotName("1robot", "Robot Entity").empty());
+    }
+} // namespace UnitTest
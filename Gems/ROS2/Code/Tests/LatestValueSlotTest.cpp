@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/AzTest.h>
+
+#include <ROS2/Utilities/Controllers/LatestValueSlot.h>
+
+namespace UnitTest
+{
+    class LatestValueSlotTest : public LeakDetectionFixture
+    {
+    };
+
+    struct TestCommand
+    {
+        float m_values[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    };
+
+    TEST_F(LatestValueSlotTest, ReadBeforeWrite)
+    {
+        ROS2::LatestValueSlot<TestCommand> slot;
+        TestCommand command;
+        command.m_values[0] = 1.0f;
+        AZStd::chrono::nanoseconds age{ 42 };
+        EXPECT_FALSE(slot.HasValue());
+        EXPECT_FALSE(slot.Read(command, age));
+        EXPECT_EQ(command.m_values[0], 1.0f);
+        EXPECT_EQ(age.count(), 42);
+        EXPECT_EQ(slot.ReadOrDefault(AZStd::chrono::seconds(1)).m_values[0], 0.0f);
+    }
+
+    TEST_F(LatestValueSlotTest, ReadsLatestValue)
+    {
+        ROS2::LatestValueSlot<TestCommand> slot;
+        for (int i = 1; i <= 3; ++i)
+        {
+            TestCommand command;
+            command.m_values[0] = static_cast<float>(i);
+            command.m_values[4] = static_cast<float>(-i);
+            slot.Write(command);
+        }
+
+        TestCommand command;
+        AZStd::chrono::nanoseconds age;
+        ASSERT_TRUE(slot.Read(command, age));
+        EXPECT_EQ(command.m_values[0], 3.0f);
+        EXPECT_EQ(command.m_values[4], -3.0f);
+        EXPECT_GE(age.count(), 0);
+        EXPECT_LT(age, AZStd::chrono::seconds(1));
+    }
+
+    TEST_F(LatestValueSlotTest, TimedOutValueIsDefault)
+    {
+        ROS2::LatestValueSlot<TestCommand> slot;
+        TestCommand command;
+        command.m_values[2] = 2.0f;
+        slot.Write(command);
+
+        EXPECT_EQ(slot.ReadOrDefault(AZStd::chrono::seconds(10)).m_values[2], 2.0f);
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(5));
+        EXPECT_EQ(slot.ReadOrDefault(AZStd::chrono::milliseconds(1)).m_values[2], 0.0f);
+    }
+
+    TEST_F(LatestValueSlotTest, ConcurrentReadsAreNotTorn)
+    {
+        ROS2::LatestValueSlot<TestCommand> slot;
+        constexpr int WriteCount = 100000;
+
+        AZStd::thread writer(
+            [&slot]()
+            {
+                for (int i = 1; i <= WriteCount; ++i)
+                {
+                    TestCommand command;
+                    for (float& value : command.m_values)
+                    {
+                        value = static_cast<float>(i);
+                    }
+                    slot.Write(command);
+                }
+            });
+
+        // Failures only stop the reader, the writer must still be joined before the test returns.
+        bool torn = false;
+        bool movedBack = false;
+        float lastValue = 0.0f;
+        while (lastValue < static_cast<float>(WriteCount))
+        {
+            TestCommand command;
+            AZStd::chrono::nanoseconds age;
+            if (!slot.Read(command, age))
+            {
+                continue;
+            }
+            for (const float value : command.m_values)
+            {
+                torn = torn || value != command.m_values[0];
+            }
+            // Values only move forward, the reader never observes an older value after a newer one.
+            movedBack = command.m_values[0] < lastValue;
+            if (torn || movedBack)
+            {
+                break;
+            }
+            lastValue = command.m_values[0];
+        }
+        writer.join();
+
+        EXPECT_FALSE(torn);
+        EXPECT_FALSE(movedBack);
+    }
+} // namespace UnitTest
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzTest/AzTest.h>
+#include <RobotImporter/Utils/SourceAssetsStorage.h>
+#include <SceneAPI/SceneCore/Containers/Scene.h>
+#include <SceneAPI/SceneCore/Events/SceneSerializationBus.h>
+#include <SceneAPI/SceneData/Groups/ImportGroup.h>
+
+namespace UnitTest
+{
+    //! Stands in for the scene importer, counting the loads instead of reading mesh files.
+    //! No manifest is written without the scene processing handlers, only the scene loads are observed.
+    class MeshSceneCacheTest
+        : public LeakDetectionFixture
+        , public AZ::SceneAPI::Events::SceneSerializationBus::Handler
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            AZ::SceneAPI::Events::SceneSerializationBus::Handler::BusConnect();
+        }
+
+        void TearDown() override
+        {
+            AZ::SceneAPI::Events::SceneSerializationBus::Handler::BusDisconnect();
+            m_loadedPaths = {};
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::shared_ptr<AZ::SceneAPI::Containers::Scene> LoadScene(
+            const AZStd::string& sceneFilePath,
+            [[maybe_unused]] AZ::Uuid sceneSourceGuid,
+            [[maybe_unused]] const AZStd::string& watchFolder) override
+        {
+            m_loadedPaths.push_back(sceneFilePath);
+            AZStd::this_thread::sleep_for(m_loadDuration);
+            auto scene = AZStd::make_shared<AZ::SceneAPI::Containers::Scene>("mesh");
+            scene->GetManifest().AddEntry(AZStd::make_shared<AZ::SceneAPI::SceneData::ImportGroup>());
+            return scene;
+        }
+
+    protected:
+        //! Handle one reference to a mesh the way the importer copies it: write the manifest, then collect the textures.
+        static void ImportMeshReference(ROS2::Utils::MeshSceneCache& cache, const AZ::IO::Path& meshPath, bool collider, bool visual)
+        {
+            cache.CreateSceneManifest(meshPath, meshPath.Native() + ".assetinfo", collider, visual);
+            cache.GetTextureAssets(meshPath);
+        }
+
+        const AZ::IO::Path m_meshPath{ "/robot/meshes/base.dae" };
+        AZStd::chrono::milliseconds m_loadDuration{ 0 };
+        AZStd::vector<AZStd::string> m_loadedPaths;
+    };
+
+    TEST_F(MeshSceneCacheTest, MeshReferencedBySeveralLinks_IsLoadedOnce)
+    {
+        ROS2::Utils::MeshSceneCache cache;
+        ImportMeshReference(cache, m_meshPath, false, true);
+        ImportMeshReference(cache, m_meshPath, true, false);
+        ImportMeshReference(cache, "/robot/meshes/../meshes/base.dae", true, true);
+
+        ASSERT_EQ(m_loadedPaths.size(), 1u);
+        EXPECT_EQ(AZ::IO::Path(m_loadedPaths.front()), m_meshPath);
+        EXPECT_EQ(cache.GetSceneLoadCount(), 1u);
+    }
+
+    TEST_F(MeshSceneCacheTest, ReleasedScene_IsReloadedForManifestOnly)
+    {
+        ROS2::Utils::MeshSceneCache cache;
+        ImportMeshReference(cache, m_meshPath, false, true);
+        EXPECT_EQ(m_loadedPaths.size(), 1u);
+
+        cache.ReleaseScene(m_meshPath);
+
+        // The texture list is kept when the scene is released.
+        cache.GetTextureAssets(m_meshPath);
+        EXPECT_EQ(m_loadedPaths.size(), 1u);
+
+        // The manifest needs the scene itself, so it is loaded again.
+        cache.CreateSceneManifest(m_meshPath, m_meshPath.Native() + ".assetinfo", true, true);
+        EXPECT_EQ(m_loadedPaths.size(), 2u);
+        EXPECT_EQ(cache.GetSceneLoadCount(), 2u);
+    }
+
+    TEST_F(MeshSceneCacheTest, SharedCache_LoadsFewerScenesThanCachePerReference)
+    {
+        constexpr AZStd::size_t ReferenceCount = 8;
+        m_loadDuration = AZStd::chrono::milliseconds(5);
+
+        // Before the cache, every reference loaded the scene once for the manifest and once more for the textures.
+        const auto perReferenceStart = AZStd::chrono::steady_clock::now();
+        for (AZStd::size_t reference = 0; reference < ReferenceCount; ++reference)
+        {
+            ROS2::Utils::CreateSceneManifest(m_meshPath, true, true);
+            ROS2::Utils::GetMeshTextureAssets(m_meshPath);
+        }
+        const AZStd::chrono::duration<double, AZStd::milli> perReferenceDuration = AZStd::chrono::steady_clock::now() - perReferenceStart;
+        const AZStd::size_t perReferenceLoads = m_loadedPaths.size();
+        m_loadedPaths.clear();
+
+        const auto sharedStart = AZStd::chrono::steady_clock::now();
+        ROS2::Utils::MeshSceneCache sharedCache;
+        for (AZStd::size_t reference = 0; reference < ReferenceCount; ++reference)
+        {
+            ImportMeshReference(sharedCache, m_meshPath, true, true);
+        }
+        const AZStd::chrono::duration<double, AZStd::milli> sharedDuration = AZStd::chrono::steady_clock::now() - sharedStart;
+
+        EXPECT_EQ(perReferenceLoads, 2 * ReferenceCount);
+        EXPECT_EQ(m_loadedPaths.size(), 1u);
+
+        // Wall clock times are only reported, as they depend on the machine running the test.
+        RecordProperty("PerReferenceCacheMilliseconds", static_cast<int>(perReferenceDuration.count()));
+        RecordProperty("SharedCacheMilliseconds", static_cast<int>(sharedDuration.count()));
+    }
+} // namespace UnitTest
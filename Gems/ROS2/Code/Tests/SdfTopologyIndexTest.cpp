@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <RobotImporter/URDF/UrdfParser.h>
+#include <RobotImporter/Utils/ErrorUtils.h>
+#include <RobotImporter/Utils/RobotImporterUtils.h>
+#include <RobotImporter/Utils/SdfTopologyIndex.h>
+
+namespace UnitTest
+{
+    //! URDF robot whose links form a binary tree: link i is the child of link (i - 1) / 2.
+    //! Links with odd indices are wheels attached with continuous joints, the others are attached with revolute joints,
+    //! as links attached with fixed joints would be merged by the URDF parser.
+    AZStd::string GetBinaryTreeUrdf(int linkCount)
+    {
+        AZStd::string urdf = "<robot name=\"binary_tree_robot\">";
+        for (int i = 0; i < linkCount; ++i)
+        {
+            const bool isWheel = (i % 2) == 1;
+            urdf += AZStd::string::format(
+                "<link name=\"%s_%d\">"
+                "  <inertial><mass value=\"1.0\"/><inertia ixx=\"1.0\" iyy=\"1.0\" izz=\"1.0\" ixy=\"0\" ixz=\"0\" iyz=\"0\"/></inertial>"
+                "  <visual><geometry><box size=\"1.0 1.0 1.0\"/></geometry></visual>"
+                "  <collision><geometry><box size=\"1.0 1.0 1.0\"/></geometry></collision>"
+                "</link>",
+                isWheel ? "wheel" : "link",
+                i);
+            if (i > 0)
+            {
+                const int parent = (i - 1) / 2;
+                urdf += AZStd::string::format(
+                    "<joint name=\"joint_%d\" type=\"%s\">"
+                    "  <parent link=\"%s_%d\"/>"
+                    "  <child link=\"%s_%d\"/>"
+                    "  <origin xyz=\"0 0 1\" rpy=\"0 0 0\"/>"
+                    "  <axis xyz=\"0 1 0\"/>"
+                    "  <limit lower=\"-1.0\" upper=\"1.0\" effort=\"10.0\" velocity=\"1.0\"/>"
+                    "</joint>",
+                    i,
+                    isWheel ? "continuous" : "revolute",
+                    (parent % 2) == 1 ? "wheel" : "link",
+                    parent,
+                    isWheel ? "wheel" : "link",
+                    i);
+            }
+        }
+        urdf += "</robot>";
+        return urdf;
+    }
+
+    class SdfTopologyIndexTest : public LeakDetectionFixture
+    {
+    public:
+        static std::string GetSdfWithNestedModelsAndWorldModels()
+        {
+            return R"(<?xml version="1.0"?>
+            <sdf version="1.10">
+              <world name="default">
+                <model name="outer_model">
+                  <link name="base_link"/>
+                  <link name="arm_link"/>
+                  <joint name="arm_joint" type="revolute">
+                    <parent>base_link</parent>
+                    <child>arm_link</child>
+                    <axis><xyz>0 0 1</xyz></axis>
+                  </joint>
+                  <model name="inner_model">
+                    <link name="base_link"/>
+                  </model>
+                </model>
+                <model name="other_model">
+                  <link name="base_link"/>
+                </model>
+              </world>
+            </sdf>)";
+        }
+    };
+
+    TEST_F(SdfTopologyIndexTest, IndexMatchesVisitorQueries)
+    {
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(GetBinaryTreeUrdf(31), {});
+        ASSERT_TRUE(sdfRootOutcome);
+        const sdf::Root& sdfRoot = sdfRootOutcome.GetRoot();
+        const sdf::Model* model = sdfRoot.Model();
+        ASSERT_NE(nullptr, model);
+
+        const ROS2::Utils::SdfTopologyIndex topologyIndex(sdfRoot);
+        ASSERT_EQ(1, topologyIndex.GetModels().size());
+        EXPECT_EQ(model, topologyIndex.GetModels().front().m_model);
+        EXPECT_EQ(nullptr, topologyIndex.GetModels().front().m_parentModel);
+
+        // The index contains the same links and joints as the visitor based queries, under the same names
+        const auto allLinks = ROS2::Utils::GetAllLinks(*model);
+        ASSERT_EQ(allLinks.size(), topologyIndex.GetLinks().size());
+        for (const auto& [fullyQualifiedName, link] : allLinks)
+        {
+            const auto* linkEntry = topologyIndex.FindLink(fullyQualifiedName);
+            ASSERT_NE(nullptr, linkEntry);
+            EXPECT_EQ(link, linkEntry->m_link);
+            EXPECT_EQ(model, linkEntry->m_model);
+            EXPECT_EQ(linkEntry, topologyIndex.FindLink(*link));
+
+            const AZStd::string linkName(link->Name().c_str(), link->Name().size());
+            EXPECT_EQ(ROS2::Utils::GetJointsForChildLink(*model, linkName), topologyIndex.GetJointsForChildLink(*link));
+            EXPECT_EQ(ROS2::Utils::GetJointsForParentLink(*model, linkName), topologyIndex.GetJointsForParentLink(*link));
+            EXPECT_EQ(ROS2::Utils::IsWheelURDFHeuristics(*model, link), ROS2::Utils::IsWheelURDFHeuristics(topologyIndex, link));
+        }
+
+        const auto allJoints = ROS2::Utils::GetAllJoints(*model);
+        ASSERT_EQ(allJoints.size(), topologyIndex.GetJoints().size());
+        for (const auto& [fullyQualifiedName, joint] : allJoints)
+        {
+            const auto* jointEntry = topologyIndex.FindJoint(fullyQualifiedName);
+            ASSERT_NE(nullptr, jointEntry);
+            EXPECT_EQ(joint, jointEntry->m_joint);
+            EXPECT_EQ(model->LinkByName(joint->ParentName()), jointEntry->m_parentLink);
+            EXPECT_EQ(model->LinkByName(joint->ChildName()), jointEntry->m_childLink);
+        }
+
+        EXPECT_TRUE(ROS2::Utils::IsWheelURDFHeuristics(topologyIndex, model->LinkByName("wheel_1")));
+        EXPECT_FALSE(ROS2::Utils::IsWheelURDFHeuristics(topologyIndex, model->LinkByName("link_2")));
+        EXPECT_EQ(nullptr, topologyIndex.FindLink("binary_tree_robot::link_31"));
+    }
+
+    TEST_F(SdfTopologyIndexTest, LinksInTopologicalOrder_ParentsBeforeChildren)
+    {
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(GetBinaryTreeUrdf(31), {});
+        ASSERT_TRUE(sdfRootOutcome);
+        const ROS2::Utils::SdfTopologyIndex topologyIndex(sdfRootOutcome.GetRoot());
+
+        const auto& linkOrder = topologyIndex.GetLinksInTopologicalOrder();
+        ASSERT_EQ(topologyIndex.GetLinks().size(), linkOrder.size());
+        AZStd::unordered_map<const sdf::Link*, size_t> positions;
+        for (size_t i = 0; i < linkOrder.size(); ++i)
+        {
+            positions.emplace(linkOrder[i], i);
+        }
+        ASSERT_EQ(linkOrder.size(), positions.size());
+
+        for (const auto& jointEntry : topologyIndex.GetJoints())
+        {
+            EXPECT_LT(positions.at(jointEntry.m_parentLink), positions.at(jointEntry.m_childLink));
+        }
+        EXPECT_EQ("link_0", linkOrder.front()->Name());
+    }
+
+    TEST_F(SdfTopologyIndexTest, NestedAndWorldModels_IndexedWithFullyQualifiedNames)
+    {
+        const auto sdfRootOutcome = ROS2::UrdfParser::Parse(GetSdfWithNestedModelsAndWorldModels(), {});
+        ASSERT_TRUE(sdfRootOutcome) << ROS2::Utils::JoinSdfErrorsToString(sdfRootOutcome.GetSdfErrors()).c_str();
+        const ROS2::Utils::SdfTopologyIndex topologyIndex(sdfRootOutcome.GetRoot());
+
+        // Models are listed in the order of VisitModels
+        const auto& models = topologyIndex.GetModels();
+        ASSERT_EQ(3, models.size());
+        EXPECT_EQ("outer_model", models[0].m_fullyQualifiedName);
+        EXPECT_EQ("outer_model::inner_model", models[1].m_fullyQualifiedName);
+        EXPECT_EQ("other_model", models[2].m_fullyQualifiedName);
+        EXPECT_EQ(nullptr, models[0].m_parentModel);
+        EXPECT_EQ(models[0].m_model, models[1].m_parentModel);
+        EXPECT_EQ(nullptr, models[2].m_parentModel);
+
+        // Links with the same name in different models are told apart by their fully qualified names
+        const auto* outerBaseLink = topologyIndex.FindLink("outer_model::base_link");
+        const auto* innerBaseLink = topologyIndex.FindLink("outer_model::inner_model::base_link");
+        const auto* otherBaseLink = topologyIndex.FindLink("other_model::base_link");
+        ASSERT_NE(nullptr, outerBaseLink);
+        ASSERT_NE(nullptr, innerBaseLink);
+        ASSERT_NE(nullptr, otherBaseLink);
+        EXPECT_EQ(models[0].m_model, outerBaseLink->m_model);
+        EXPECT_EQ(models[1].m_model, innerBaseLink->m_model);
+        EXPECT_EQ(models[2].m_model, otherBaseLink->m_model);
+        EXPECT_EQ(models[1].m_model, topologyIndex.FindModel("outer_model::inner_model")->m_model);
+
+        const auto* armJoint = topologyIndex.FindJoint("outer_model::arm_joint");
+        ASSERT_NE(nullptr, armJoint);
+        EXPECT_EQ(outerBaseLink->m_link, armJoint->m_parentLink);
+        ASSERT_EQ(1, topologyIndex.GetJointsForChildLink(*armJoint->m_childLink).size());
+        EXPECT_EQ(armJoint->m_joint, topologyIndex.GetJointsForChildLink(*armJoint->m_childLink).front());
+        EXPECT_TRUE(topologyIndex.GetJointsForChildLink(*innerBaseLink->m_link).empty());
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Queries the joints of every link of a binary tree robot, as done while creating the prefab of an imported robot.
+    class SdfTopologyIndexBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpRobot(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpRobot(state);
+        }
+        void TearDown(const benchmark::State& state) override
+        {
+            m_sdfRootOutcome.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            m_sdfRootOutcome.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void SetUpRobot(const benchmark::State& state)
+        {
+            m_sdfRootOutcome.emplace(ROS2::UrdfParser::Parse(UnitTest::GetBinaryTreeUrdf(aznumeric_cast<int>(state.range(0))), {}));
+        }
+
+        const sdf::Root& GetRoot() const
+        {
+            return m_sdfRootOutcome->GetRoot();
+        }
+
+        AZStd::optional<ROS2::UrdfParser::RootObjectOutcome> m_sdfRootOutcome;
+    };
+
+    BENCHMARK_DEFINE_F(SdfTopologyIndexBenchmarkFixture, BM_QueryJointsOfLinks_Visitors)(benchmark::State& state)
+    {
+        const sdf::Model& model = *GetRoot().Model();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            size_t wheelCount = 0;
+            for (const auto& [fullyQualifiedName, link] : ROS2::Utils::GetAllLinks(model))
+            {
+                const AZStd::string linkName(link->Name().c_str(), link->Name().size());
+                benchmark::DoNotOptimize(ROS2::Utils::GetJointsForChildLink(model, linkName, true));
+                wheelCount += ROS2::Utils::IsWheelURDFHeuristics(model, link) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(wheelCount);
+        }
+    }
+    BENCHMARK_REGISTER_F(SdfTopologyIndexBenchmarkFixture, BM_QueryJointsOfLinks_Visitors)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SdfTopologyIndexBenchmarkFixture, BM_QueryJointsOfLinks_TopologyIndex)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // Building the index is part of every iteration, as it is built once per import
+            const ROS2::Utils::SdfTopologyIndex topologyIndex(GetRoot());
+            size_t wheelCount = 0;
+            for (const sdf::Link* link : topologyIndex.GetLinksInTopologicalOrder())
+            {
+                benchmark::DoNotOptimize(topologyIndex.GetJointsForChildLink(*link));
+                wheelCount += ROS2::Utils::IsWheelURDFHeuristics(topologyIndex, link) ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(wheelCount);
+        }
+    }
+    BENCHMARK_REGISTER_F(SdfTopologyIndexBenchmarkFixture, BM_QueryJointsOfLinks_TopologyIndex)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif
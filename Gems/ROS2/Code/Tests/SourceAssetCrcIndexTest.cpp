@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <RobotImporter/Utils/SourceAssetCrcIndex.h>
+
+namespace UnitTest
+{
+    //! Index which takes its source assets from the test instead of the asset database.
+    class TestSourceAssetCrcIndex : public ROS2::Utils::SourceAssetCrcIndex
+    {
+    public:
+        using SourceAssetCrcIndex::SourceAssetCrcIndex;
+
+        ~TestSourceAssetCrcIndex() override
+        {
+            CancelRefresh();
+        }
+
+        AZStd::vector<ROS2::Utils::AvailableAsset> m_assets;
+        bool m_failQuery = false;
+        AZStd::function<void()> m_onQuery; //!< Called on the refresh thread, while the scan is running
+
+    protected:
+        AZ::Outcome<AZStd::vector<ROS2::Utils::AvailableAsset>, AZStd::string> QuerySourceAssets() override
+        {
+            if (m_onQuery)
+            {
+                m_onQuery();
+            }
+            if (m_failQuery)
+            {
+                return AZ::Failure(AZStd::string("Asset database unavailable"));
+            }
+            return AZ::Success(m_assets);
+        }
+    };
+
+    class SourceAssetCrcIndexTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_settingsRegistry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            m_settingsRegistry->MergeSettings(
+                R"({ "O3DE": { "SceneAPI": { "AssetImporter": { "SupportedFileTypeExtensions": [ ".stl" ] } } } })",
+                AZ::SettingsRegistryInterface::Format::JsonMergePatch);
+            AZ::SettingsRegistry::Register(m_settingsRegistry.get());
+
+            m_scanFolder = AZ::IO::Path(m_tempDirectory.GetDirectory());
+            m_indexFilePath = m_scanFolder / "index.json";
+        }
+
+        void TearDown() override
+        {
+            AZ::SettingsRegistry::Unregister(m_settingsRegistry.get());
+            m_settingsRegistry.reset();
+            m_scanFolder = {};
+            m_indexFilePath = {};
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        //! Write a mesh file with distinct content into the scan folder.
+        ROS2::Utils::AvailableAsset WriteAsset(AZStd::string_view name)
+        {
+            ROS2::Utils::AvailableAsset asset;
+            asset.m_sourceAssetRelativePath = AZStd::string::format("%.*s.stl", AZ_STRING_ARG(name));
+            asset.m_sourceAssetGlobalPath = (m_scanFolder / asset.m_sourceAssetRelativePath).LexicallyNormal();
+            asset.m_sourceGuid = AZ::Uuid::CreateData(name.data(), name.size());
+            AZ::Utils::WriteFile(
+                AZStd::string::format("solid %.*s\nendsolid %.*s\n", AZ_STRING_ARG(name), AZ_STRING_ARG(name)),
+                asset.m_sourceAssetGlobalPath.Native());
+            return asset;
+        }
+
+        //! @return JSON of an entry of the index file.
+        static AZStd::string MakeIndexEntry(const ROS2::Utils::AvailableAsset& asset, AZ::u64 modificationTime, AZ::u32 crc)
+        {
+            return AZStd::string::format(
+                R"({ "sourceGuid": "%s", "sourceRelativePath": "%s", "sourceGlobalPath": "%s", "modificationTime": %llu, "crc": %u })",
+                asset.m_sourceGuid.ToFixedString().c_str(),
+                asset.m_sourceAssetRelativePath.AsPosix().c_str(),
+                asset.m_sourceAssetGlobalPath.AsPosix().c_str(),
+                static_cast<unsigned long long>(modificationTime),
+                crc);
+        }
+
+        void WriteIndexFile(const AZStd::string& assets)
+        {
+            AZ::Utils::WriteFile(AZStd::string::format(R"({ "version": 1, "assets": [ %s ] })", assets.c_str()), m_indexFilePath.Native());
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_settingsRegistry;
+        AZ::IO::Path m_scanFolder;
+        AZ::IO::Path m_indexFilePath;
+    };
+
+    TEST_F(SourceAssetCrcIndexTest, IncrementalRefresh_ReusesChecksumsOfUnmodifiedFiles)
+    {
+        const auto unmodifiedAsset = WriteAsset("unmodified");
+        const auto modifiedAsset = WriteAsset("modified");
+        const auto addedAsset = WriteAsset("added");
+
+        // Checksums in the index are only computed again for files with another modification time, so the made up checksum
+        // of the unmodified file is kept.
+        constexpr AZ::u32 UnmodifiedCrc = 0x1234;
+        constexpr AZ::u32 StaleCrc = 0x5678;
+        const AZ::u64 unmodifiedTime = AZ::IO::SystemFile::ModificationTime(unmodifiedAsset.m_sourceAssetGlobalPath.c_str());
+        WriteIndexFile(MakeIndexEntry(unmodifiedAsset, unmodifiedTime, UnmodifiedCrc) + "," + MakeIndexEntry(modifiedAsset, 1, StaleCrc));
+
+        {
+            TestSourceAssetCrcIndex index(m_indexFilePath);
+            index.m_assets = { unmodifiedAsset, modifiedAsset, addedAsset };
+
+            const auto availableAssets = index.GetAvailableAssets();
+            EXPECT_EQ(3, availableAssets.size());
+            ASSERT_TRUE(availableAssets.contains(AZ::Crc32(UnmodifiedCrc)));
+            EXPECT_EQ(unmodifiedAsset.m_sourceGuid, availableAssets.at(AZ::Crc32(UnmodifiedCrc)).m_sourceGuid);
+            EXPECT_FALSE(availableAssets.contains(AZ::Crc32(StaleCrc)));
+
+            const auto modifiedCrc = ROS2::Utils::GetFileCRC(modifiedAsset.m_sourceAssetGlobalPath);
+            const auto found = index.Find(modifiedCrc);
+            ASSERT_TRUE(found.has_value());
+            EXPECT_EQ(modifiedAsset.m_sourceGuid, found->m_sourceGuid);
+            EXPECT_TRUE(index.Find(ROS2::Utils::GetFileCRC(addedAsset.m_sourceAssetGlobalPath)).has_value());
+        }
+
+        // The refreshed index was saved, so the next session starts with it.
+        TestSourceAssetCrcIndex reloadedIndex(m_indexFilePath);
+        reloadedIndex.m_failQuery = true;
+        const auto reloadedAssets = reloadedIndex.GetAvailableAssets();
+        EXPECT_EQ(3, reloadedAssets.size());
+        EXPECT_TRUE(reloadedAssets.contains(AZ::Crc32(UnmodifiedCrc)));
+        EXPECT_TRUE(reloadedAssets.contains(ROS2::Utils::GetFileCRC(modifiedAsset.m_sourceAssetGlobalPath)));
+    }
+
+    TEST_F(SourceAssetCrcIndexTest, ChangesDuringRefresh_AppliedOverScannedEntries)
+    {
+        const auto keptAsset = WriteAsset("kept");
+        const auto removedAsset = WriteAsset("removed");
+        const auto addedAsset = WriteAsset("added");
+
+        TestSourceAssetCrcIndex index(m_indexFilePath);
+        // The scan still lists the removed asset and misses the added one, as if the asset database was read before the
+        // Asset Processor notified the changes.
+        index.m_assets = { keptAsset, removedAsset };
+        index.m_onQuery = [this, &removedAsset, &addedAsset]()
+        {
+            AzToolsFramework::AssetSystemBus::Broadcast(
+                &AzToolsFramework::AssetSystemBus::Events::SourceFileChanged,
+                addedAsset.m_sourceAssetRelativePath.Native(),
+                m_scanFolder.Native(),
+                addedAsset.m_sourceGuid);
+            AzToolsFramework::AssetSystemBus::Broadcast(
+                &AzToolsFramework::AssetSystemBus::Events::SourceFileRemoved,
+                removedAsset.m_sourceAssetRelativePath.Native(),
+                m_scanFolder.Native(),
+                removedAsset.m_sourceGuid);
+        };
+
+        const auto availableAssets = index.GetAvailableAssets();
+        EXPECT_EQ(2, availableAssets.size());
+        EXPECT_TRUE(availableAssets.contains(ROS2::Utils::GetFileCRC(keptAsset.m_sourceAssetGlobalPath)));
+        EXPECT_TRUE(availableAssets.contains(ROS2::Utils::GetFileCRC(addedAsset.m_sourceAssetGlobalPath)));
+        EXPECT_FALSE(availableAssets.contains(ROS2::Utils::GetFileCRC(removedAsset.m_sourceAssetGlobalPath)));
+    }
+
+    TEST_F(SourceAssetCrcIndexTest, DatabaseFailure_KeepsPreviousEntriesAndIndexFile)
+    {
+        const auto asset = WriteAsset("asset");
+        constexpr AZ::u32 IndexedCrc = 0x1234;
+        WriteIndexFile(MakeIndexEntry(asset, 1, IndexedCrc));
+        const auto indexFileContent = AZ::Utils::ReadFile<AZStd::string>(m_indexFilePath.Native());
+        ASSERT_TRUE(indexFileContent.IsSuccess());
+
+        {
+            TestSourceAssetCrcIndex index(m_indexFilePath);
+            index.m_assets = { asset };
+            index.m_failQuery = true;
+
+            const auto availableAssets = index.GetAvailableAssets();
+            ASSERT_EQ(1, availableAssets.size());
+            EXPECT_TRUE(availableAssets.contains(AZ::Crc32(IndexedCrc)));
+            EXPECT_TRUE(index.Find(AZ::Crc32(IndexedCrc)).has_value());
+        }
+
+        const auto indexFileContentAfter = AZ::Utils::ReadFile<AZStd::string>(m_indexFilePath.Native());
+        ASSERT_TRUE(indexFileContentAfter.IsSuccess());
+        EXPECT_EQ(indexFileContent.GetValue(), indexFileContentAfter.GetValue());
+    }
+
+    TEST_F(SourceAssetCrcIndexTest, MalformedIndexFile_StartsEmpty)
+    {
+        const auto asset = WriteAsset("asset");
+        for (const AZStd::string& indexFileContent : {
+                 AZStd::string(R"({ "version": 1, "assets": { } })"),
+                 AZStd::string(R"({ "version": "1", "assets": [ ] })"),
+                 AZStd::string::format(
+                     R"({ "version": 1, "assets": [ { "sourceGuid": "%s", "sourceRelativePath": "asset.stl", "crc": 4660 } ] })",
+                     asset.m_sourceGuid.ToFixedString().c_str()),
+                 AZStd::string::format(
+                     R"({ "version": 1, "assets": [ %s, 42 ] })", MakeIndexEntry(asset, 1, 0x1234).c_str()) })
+        {
+            AZ::Utils::WriteFile(indexFileContent, m_indexFilePath.Native());
+            TestSourceAssetCrcIndex index(m_indexFilePath);
+            index.m_failQuery = true;
+            EXPECT_TRUE(index.GetAvailableAssets().empty()) << indexFileContent.c_str();
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+
+#include <Spawner/SpawnPool.h>
+
+namespace UnitTest
+{
+    class SpawnPoolTest : public LeakDetectionFixture
+    {
+    };
+
+    //! Stands in for a spawned robot, which is move only like a spawn ticket.
+    using FakeRobot = AZStd::unique_ptr<AZStd::size_t>;
+
+    //! Spawns robots the way the spawner component does: from the pool when possible, otherwise as new instances.
+    static AZStd::vector<FakeRobot> SpawnFleet(
+        ROS2::SpawnPool<FakeRobot>& pool, const AZStd::string& spawnableName, AZStd::size_t count, AZStd::size_t& newRobotCount)
+    {
+        AZStd::vector<FakeRobot> fleet;
+        for (AZStd::size_t index = 0; index < count; ++index)
+        {
+            if (auto pooledRobot = pool.Acquire(spawnableName))
+            {
+                fleet.push_back(AZStd::move(*pooledRobot));
+            }
+            else
+            {
+                fleet.push_back(AZStd::make_unique<AZStd::size_t>(newRobotCount++));
+            }
+        }
+        return fleet;
+    }
+
+    TEST_F(SpawnPoolTest, EmptyPoolMisses)
+    {
+        ROS2::SpawnPool<FakeRobot> pool;
+        EXPECT_FALSE(pool.Acquire("robot").has_value());
+        EXPECT_EQ(pool.GetStatistics().m_missed, 1u);
+        EXPECT_EQ(pool.GetStatistics().m_reused, 0u);
+    }
+
+    TEST_F(SpawnPoolTest, RespawnedFleetReusesDespawnedRobots)
+    {
+        constexpr AZStd::size_t FleetSize = 100;
+        ROS2::SpawnPool<FakeRobot> pool;
+        AZStd::size_t newRobotCount = 0;
+
+        AZStd::vector<FakeRobot> fleet = SpawnFleet(pool, "robot", FleetSize, newRobotCount);
+        EXPECT_EQ(newRobotCount, FleetSize);
+
+        AZStd::vector<AZStd::size_t*> despawnedRobots;
+        for (FakeRobot& robot : fleet)
+        {
+            despawnedRobots.push_back(robot.get());
+            pool.Release("robot", AZStd::move(robot));
+        }
+        EXPECT_EQ(pool.GetPooledCount("robot"), FleetSize);
+
+        // The second fleet is made of the same instances, none of them is spawned again.
+        fleet = SpawnFleet(pool, "robot", FleetSize, newRobotCount);
+        EXPECT_EQ(newRobotCount, FleetSize);
+        EXPECT_EQ(pool.GetPooledCount("robot"), 0u);
+        for (const FakeRobot& robot : fleet)
+        {
+            EXPECT_NE(AZStd::find(despawnedRobots.begin(), despawnedRobots.end(), robot.get()), despawnedRobots.end());
+        }
+        EXPECT_EQ(pool.GetStatistics().m_reused, FleetSize);
+        EXPECT_EQ(pool.GetStatistics().m_missed, FleetSize);
+    }
+
+    TEST_F(SpawnPoolTest, PrewarmedRobotsServeFirstSpawns)
+    {
+        constexpr AZStd::size_t PrewarmedCount = 10;
+        ROS2::SpawnPool<FakeRobot> pool;
+        for (AZStd::size_t index = 0; index < PrewarmedCount; ++index)
+        {
+            pool.Release("robot", AZStd::make_unique<AZStd::size_t>(PrewarmedCount));
+        }
+
+        AZStd::size_t newRobotCount = 0;
+        AZStd::vector<FakeRobot> fleet = SpawnFleet(pool, "robot", PrewarmedCount + 5, newRobotCount);
+        EXPECT_EQ(newRobotCount, 5u);
+        EXPECT_EQ(pool.GetStatistics().m_reused, PrewarmedCount);
+    }
+
+    TEST_F(SpawnPoolTest, RobotsArePooledPerSpawnable)
+    {
+        ROS2::SpawnPool<FakeRobot> pool;
+        pool.Release("rover", AZStd::make_unique<AZStd::size_t>(1));
+
+        EXPECT_FALSE(pool.Acquire("drone").has_value());
+        auto rover = pool.Acquire("rover");
+        ASSERT_TRUE(rover.has_value());
+        EXPECT_EQ(**rover, 1u);
+
+        pool.Release("rover", AZStd::move(*rover));
+        pool.Clear();
+        EXPECT_EQ(pool.GetPooledCount("rover"), 0u);
+        EXPECT_EQ(pool.GetStatistics().m_reused, 0u);
+    }
+} // namespace UnitTest
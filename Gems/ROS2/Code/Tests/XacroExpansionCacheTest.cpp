@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/string/string.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <RobotImporter/xacro/XacroExpansionCache.h>
+
+namespace UnitTest
+{
+    class XacroExpansionCacheTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            const AZ::IO::Path tempPath(m_tempDirectory.GetDirectory());
+            m_cacheFolder = tempPath / "XacroCache";
+            m_xacroPath = tempPath / "robot.urdf.xacro";
+            m_includedPath = tempPath / "wheel.xacro";
+            AZ::Utils::WriteFile(
+                "<robot name=\"robot\" xmlns:xacro=\"http://ros.org/wiki/xacro\">"
+                "  <xacro:include filename=\"wheel.xacro\"/>"
+                "  <xacro:wheel name=\"left\"/>"
+                "</robot>",
+                m_xacroPath.Native());
+            AZ::Utils::WriteFile(
+                "<robot xmlns:xacro=\"http://ros.org/wiki/xacro\">"
+                "  <xacro:macro name=\"wheel\" params=\"name\"><link name=\"${name}_wheel\"/></xacro:macro>"
+                "</robot>",
+                m_includedPath.Native());
+        }
+
+        void TearDown() override
+        {
+            m_cacheFolder = {};
+            m_xacroPath = {};
+            m_includedPath = {};
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        static constexpr AZStd::string_view XacroExecutable = "/opt/ros/bin/xacro";
+        static constexpr AZStd::string_view ExpandedUrdf = "<robot name=\"robot\"><link name=\"left_wheel\"/></robot>";
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::Path m_cacheFolder;
+        AZ::IO::Path m_xacroPath;
+        AZ::IO::Path m_includedPath;
+    };
+
+    TEST_F(XacroExpansionCacheTest, StoredExpansion_IsFoundUntilInputsChange)
+    {
+        const ROS2::Utils::xacro::Params params{ { "use_sim", "true" } };
+        ROS2::Utils::xacro::XacroExpansionCache cache(m_cacheFolder);
+        EXPECT_FALSE(cache.Find(m_xacroPath.Native(), params, XacroExecutable));
+
+        cache.Store(m_xacroPath.Native(), params, XacroExecutable, AZStd::string(ExpandedUrdf), { m_includedPath });
+        const auto cachedUrdf = cache.Find(m_xacroPath.Native(), params, XacroExecutable);
+        ASSERT_TRUE(cachedUrdf);
+        EXPECT_EQ(ExpandedUrdf, *cachedUrdf);
+
+        // Other arguments or another executable may expand differently
+        EXPECT_FALSE(cache.Find(m_xacroPath.Native(), { { "use_sim", "false" } }, XacroExecutable));
+        EXPECT_FALSE(cache.Find(m_xacroPath.Native(), params, "xacro"));
+
+        // Changes of included files invalidate the expansion
+        AZ::Utils::WriteFile("<robot xmlns:xacro=\"http://ros.org/wiki/xacro\"/>", m_includedPath.Native());
+        EXPECT_FALSE(cache.Find(m_xacroPath.Native(), params, XacroExecutable));
+    }
+
+    TEST_F(XacroExpansionCacheTest, StoredExpansion_IsFoundInNextSession)
+    {
+        const ROS2::Utils::xacro::Params params{ { "use_sim", "true" }, { "prefix", "robot_" } };
+        {
+            ROS2::Utils::xacro::XacroExpansionCache cache(m_cacheFolder);
+            cache.Store(m_xacroPath.Native(), params, XacroExecutable, AZStd::string(ExpandedUrdf), { m_includedPath });
+        }
+
+        ROS2::Utils::xacro::XacroExpansionCache cache(m_cacheFolder);
+        const auto cachedUrdf = cache.Find(m_xacroPath.Native(), params, XacroExecutable);
+        ASSERT_TRUE(cachedUrdf);
+        EXPECT_EQ(ExpandedUrdf, *cachedUrdf);
+
+        // Changes of the xacro file itself give a different key
+        AZ::Utils::WriteFile("<robot name=\"robot\" xmlns:xacro=\"http://ros.org/wiki/xacro\"/>", m_xacroPath.Native());
+        EXPECT_FALSE(cache.Find(m_xacroPath.Native(), params, XacroExecutable));
+    }
+
+    TEST_F(XacroExpansionCacheTest, CorruptEntry_IsCacheMiss)
+    {
+        const ROS2::Utils::xacro::Params params{ { "use_sim", "true" } };
+        {
+            ROS2::Utils::xacro::XacroExpansionCache cache(m_cacheFolder);
+            cache.Store(m_xacroPath.Native(), params, XacroExecutable, AZStd::string(ExpandedUrdf), { m_includedPath });
+        }
+
+        AZStd::vector<AZ::IO::Path> entryPaths;
+        AZ::IO::SystemFile::FindFiles(
+            (m_cacheFolder / "*.json").c_str(),
+            [this, &entryPaths](const char* fileName, bool isFile)
+            {
+                if (isFile)
+                {
+                    entryPaths.push_back(m_cacheFolder / fileName);
+                }
+                return true;
+            });
+        ASSERT_EQ(1, entryPaths.size());
+
+        for (const char* corruptEntry : {
+                 R"({ "dependencies": [ { "path": "wheel.xacro", "hash": "0" } ], "urdf": "<robot/>" })",
+                 R"({ "dependencies": [ { "path": 42, "hash": 0 } ], "urdf": "<robot/>" })",
+                 R"({ "dependencies": [ 42 ], "urdf": "<robot/>" })",
+                 R"({ "dependencies": { }, "urdf": "<robot/>" })",
+                 R"({ "dependencies": [ ], "urdf": 42 })",
+                 R"({ "dependencies": [ ] })",
+                 R"([ "<robot/>" ])",
+                 R"({ "dependencies": [ { "path": "wheel.xacro", )" })
+        {
+            AZ::Utils::WriteFile(corruptEntry, entryPaths[0].Native());
+            ROS2::Utils::xacro::XacroExpansionCache cache(m_cacheFolder);
+            EXPECT_FALSE(cache.Find(m_xacroPath.Native(), params, XacroExecutable)) << corruptEntry;
+        }
+    }
+} // namespace UnitTest
@@ -70,15 +70,25 @@ set(FILES
     Source/RobotImporter/URDF/URDFPrefabMaker.h
     Source/RobotImporter/URDF/VisualsMaker.cpp
     Source/RobotImporter/URDF/VisualsMaker.h
+    Source/RobotImporter/xacro/XacroExpansionCache.cpp
+    Source/RobotImporter/xacro/XacroExpansionCache.h
     Source/RobotImporter/xacro/XacroUtils.cpp
     Source/RobotImporter/xacro/XacroUtils.h
+    Source/RobotImporter/Utils/ContentHash.cpp
+    Source/RobotImporter/Utils/ContentHash.h
     Source/RobotImporter/Utils/DefaultSolverConfiguration.h
     Source/RobotImporter/Utils/ErrorUtils.cpp
     Source/RobotImporter/Utils/ErrorUtils.h
     Source/RobotImporter/Utils/FilePath.cpp
     Source/RobotImporter/Utils/FilePath.h
+    Source/RobotImporter/Utils/AssetPathResolver.cpp
+    Source/RobotImporter/Utils/AssetPathResolver.h
     Source/RobotImporter/Utils/RobotImporterUtils.cpp
     Source/RobotImporter/Utils/RobotImporterUtils.h
+    Source/RobotImporter/Utils/SdfTopologyIndex.cpp
+    Source/RobotImporter/Utils/SdfTopologyIndex.h
+    Source/RobotImporter/Utils/SourceAssetCrcIndex.cpp
+    Source/RobotImporter/Utils/SourceAssetCrcIndex.h
     Source/RobotImporter/Utils/SourceAssetsStorage.cpp
     Source/RobotImporter/Utils/SourceAssetsStorage.h
     Source/RobotImporter/Utils/TypeConversions.cpp
@@ -94,6 +104,8 @@ set(FILES
     Source/SdfAssetBuilder/SdfAssetBuilderSettings.h
     Source/SdfAssetBuilder/SdfAssetBuilderSystemComponent.cpp
     Source/SdfAssetBuilder/SdfAssetBuilderSystemComponent.h
+    Source/SdfAssetBuilder/SdfParseCache.cpp
+    Source/SdfAssetBuilder/SdfParseCache.h
     Source/Frame/ROS2FrameEditorComponent.cpp
     Source/Frame/ROS2FrameSystemComponent.cpp
     Source/Frame/ROS2FrameSystemComponent.h
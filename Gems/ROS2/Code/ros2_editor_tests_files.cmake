@@ -4,7 +4,12 @@
 # SPDX-License-Identifier: Apache-2.0 OR MIT
 
 set(FILES
+    Tests/AssetPathResolverTest.cpp
+    Tests/MeshSceneCacheTest.cpp
     Tests/ROS2EditorTest.cpp
     Tests/SdfParserTest.cpp
+    Tests/SdfTopologyIndexTest.cpp
+    Tests/SourceAssetCrcIndexTest.cpp
     Tests/UrdfParserTest.cpp
+    Tests/XacroExpansionCacheTest.cpp
 )
@@ -52,6 +52,10 @@ set(FILES
         Source/Gripper/FingerGripperComponent.cpp
         Source/Georeference/GNSSFormatConversions.cpp
         Source/Georeference/GNSSFormatConversions.h
+        Source/GroundTruth/GroundTruthPublisher.cpp
+        Source/GroundTruth/GroundTruthPublisher.h
+        Source/GroundTruth/ROS2GroundTruthComponent.cpp
+        Source/GroundTruth/ROS2GroundTruthComponent.h
         Source/GNSS/ROS2GNSSSensorComponent.cpp
         Source/GNSS/ROS2GNSSSensorComponent.h
         Source/Imu/ImuSensorConfiguration.cpp
@@ -139,12 +143,15 @@ set(FILES
         Source/Spawner/ROS2SpawnerComponentController.h
         Source/Spawner/ROS2SpawnPointComponentController.cpp
         Source/Spawner/ROS2SpawnPointComponentController.h
+        Source/Spawner/SpawnPool.h
         Source/SystemComponents/ROS2SystemComponent.cpp
         Source/SystemComponents/ROS2SystemComponent.h
         Source/Utilities/ArticulationsUtilities.cpp
         Source/Utilities/ArticulationsUtilities.h
         Source/Utilities/JointUtilities.cpp
         Source/Utilities/JointUtilities.h
+        Source/Utilities/Controllers/ControlLoop.cpp
+        Source/Utilities/Controllers/ControlLoop.h
         Source/Utilities/Controllers/PidConfiguration.cpp
         Source/Utilities/ROS2Conversions.cpp
         Source/Utilities/ROS2Names.cpp
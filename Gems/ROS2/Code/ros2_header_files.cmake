@@ -34,9 +34,12 @@ set(FILES
         Include/ROS2/Manipulation/MotorizedJoints/PidMotorControllerComponent.h
         Include/ROS2/RobotControl/ControlConfiguration.h
         Include/ROS2/RobotControl/ControlSubscriptionHandler.h
+        Include/ROS2/RobotControl/RobotControlBus.h
+        Include/ROS2/RobotControl/Twist/TwistCommandStruct.h
         Include/ROS2/RobotImporter/SDFormatModelPluginImporterHook.h
         Include/ROS2/RobotImporter/SDFormatSensorImporterHook.h
         Include/ROS2/ROS2SensorTypesIds.h
+        Include/ROS2/GroundTruth/GroundTruthBus.h
         Include/ROS2/Lidar/LidarRaycasterBus.h
         Include/ROS2/Lidar/LidarSystemBus.h
         Include/ROS2/Lidar/LidarRegistrarBus.h
@@ -52,6 +55,8 @@ set(FILES
         Include/ROS2/Sensor/SensorConfigurationRequestBus.h
         Include/ROS2/Sensor/SensorHelper.h
         Include/ROS2/Spawner/SpawnerBus.h
+        Include/ROS2/Utilities/Controllers/ControlLoopBus.h
+        Include/ROS2/Utilities/Controllers/LatestValueSlot.h
         Include/ROS2/Utilities/Controllers/PidConfiguration.h
         Include/ROS2/Utilities/ROS2Conversions.h
         Include/ROS2/Utilities/ROS2Names.h
@@ -6,4 +6,8 @@
 set(FILES
     Tests/ROS2Test.cpp
     Tests/GNSSTest.cpp
+    Tests/LatestValueSlotTest.cpp
+    Tests/ControlLoopTest.cpp
+    Tests/GroundTruthTest.cpp
+    Tests/SpawnPoolTest.cpp
 )
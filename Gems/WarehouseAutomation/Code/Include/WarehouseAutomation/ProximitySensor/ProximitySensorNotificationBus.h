@@ -20,10 +20,12 @@ namespace WarehouseAutomation
         static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
         static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
 
-        //! Notify that a particular sensor is detecting an object (notification published for each frequency tick).
+        //! Notify that a particular sensor started detecting an object.
+        //! Published after the first detection check and whenever the sensor state changes.
         virtual void OnObjectInRange() = 0;
 
-        //! Notify that a particular sensor is not detecting an object (notification published for each frequency tick).
+        //! Notify that a particular sensor stopped detecting an object.
+        //! Published after the first detection check and whenever the sensor state changes.
         virtual void OnObjectOutOfRange() = 0;
 
     protected:
@@ -83,9 +83,7 @@ namespace WarehouseAutomation
             m_sceneSimStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler (
                 [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
                 {
-                    SpawnSegments(fixedDeltaTime);
                     MoveSegmentsPhysically(fixedDeltaTime);
-                    DespawnSegments();
                 },
                 aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Components));
             sceneInterface->RegisterSceneSimulationStartHandler(defaultSceneHandle, m_sceneSimStartHandler);
@@ -94,12 +92,18 @@ namespace WarehouseAutomation
             m_endPoint = endPoint;
             m_splineLength = GetSplineLength(splinePtr);
 
-            // initial segment population
             AZ_Assert(m_splineLength != 0.0f, "m_splineLength must be non-zero");
-            const float normalizedDistanceStep = SegmentSeparation * m_configuration.m_segmentSize / m_splineLength;
-            for (float normalizedIndex = 0.f; normalizedIndex < 1.f + normalizedDistanceStep; normalizedIndex += normalizedDistanceStep)
+            SampleSpline(splinePtr);
+
+            // Segments are created once and recycled: they cover the whole spline evenly spaced, at most the configured separation apart,
+            // so that a segment wrapped from one end of the belt to the other keeps its spacing to its neighbours.
+            const float maxNormalizedDistanceStep = SegmentSeparation * m_configuration.m_segmentSize / m_splineLength;
+            const int segmentCount = AZStd::max(1, static_cast<int>(AZStd::ceil(1.0f / maxNormalizedDistanceStep)));
+            const float normalizedDistanceStep = 1.0f / segmentCount;
+            m_conveyorSegments.reserve(segmentCount);
+            for (int segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex)
             {
-                auto segment = CreateSegment(splinePtr, normalizedIndex);
+                auto segment = CreateSegment(segmentIndex * normalizedDistanceStep);
                 if (segment.second != AzPhysics::InvalidSimulatedBodyHandle)
                 {
                     m_conveyorSegments.emplace_back(AZStd::move(segment));
@@ -121,6 +125,8 @@ namespace WarehouseAutomation
         ConveyorBeltRequestBus::Handler::BusDisconnect();
         AZ::EntityBus::Handler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
+        RemoveSegments();
+        m_splineSamples.clear();
     }
 
     AZ::Vector3 ConveyorBeltComponent::GetLocationOfSegment(const AzPhysics::SimulatedBodyHandle handle)
@@ -165,8 +171,7 @@ namespace WarehouseAutomation
         }
     }
 
-    AZStd::pair<float, AzPhysics::SimulatedBodyHandle> ConveyorBeltComponent::CreateSegment(
-        AZ::ConstSplinePtr splinePtr, float normalizedLocation)
+    AZStd::pair<float, AzPhysics::SimulatedBodyHandle> ConveyorBeltComponent::CreateSegment(float normalizedLocation)
     {
         AzPhysics::SystemInterface* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
         AZ_Assert(physicsSystem != nullptr, "Unable to get Physics System");
@@ -177,7 +182,7 @@ namespace WarehouseAutomation
         colliderConfiguration->m_rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisX(), AZ::DegToRad(90.0f));
         auto shapeConfiguration =
             AZStd::make_shared<Physics::CapsuleShapeConfiguration>(m_configuration.m_beltWidth, m_configuration.m_segmentSize / 2.0f);
-        const auto transform = GetTransformFromSpline(m_splineConsPtr, normalizedLocation);
+        const auto transform = GetTransformFromSamples(normalizedLocation);
         AzPhysics::RigidBodyConfiguration conveyorSegmentRigidBodyConfig;
         conveyorSegmentRigidBodyConfig.m_kinematic = true;
         conveyorSegmentRigidBodyConfig.m_position = transform.GetTranslation();
@@ -244,6 +249,30 @@ namespace WarehouseAutomation
         return m_splineTransform * transform;
     }
 
+    void ConveyorBeltComponent::SampleSpline(AZ::ConstSplinePtr splinePtr)
+    {
+        const float sampleSpacing = SegmentSeparation * m_configuration.m_segmentSize / SplineSamplesPerSegment;
+        const size_t sampleCount = AZStd::max<size_t>(2, static_cast<size_t>(AZStd::ceil(m_splineLength / sampleSpacing)) + 1);
+        m_splineSamples.clear();
+        m_splineSamples.reserve(sampleCount);
+        for (size_t sampleIndex = 0; sampleIndex < sampleCount; ++sampleIndex)
+        {
+            m_splineSamples.push_back(GetTransformFromSpline(splinePtr, static_cast<float>(sampleIndex) / (sampleCount - 1)));
+        }
+    }
+
+    AZ::Transform ConveyorBeltComponent::GetTransformFromSamples(float distanceNormalized) const
+    {
+        AZ_Assert(m_splineSamples.size() >= 2, "Spline is not sampled");
+        const float samplePosition = AZ::GetClamp(distanceNormalized, 0.0f, 1.0f) * (m_splineSamples.size() - 1);
+        const size_t sampleIndex = AZStd::min(static_cast<size_t>(samplePosition), m_splineSamples.size() - 2);
+        const float t = samplePosition - sampleIndex;
+        const AZ::Transform& previous = m_splineSamples[sampleIndex];
+        const AZ::Transform& next = m_splineSamples[sampleIndex + 1];
+        return AZ::Transform::CreateFromQuaternionAndTranslation(
+            previous.GetRotation().Slerp(next.GetRotation(), t), previous.GetTranslation().Lerp(next.GetTranslation(), t));
+    }
+
     float ConveyorBeltComponent::GetSplineLength(AZ::ConstSplinePtr splinePtr)
     {
         AZ_Assert(splinePtr, "Spline pointer is null");
@@ -277,29 +306,16 @@ namespace WarehouseAutomation
             m_textureOffset);
     }
 
-    void ConveyorBeltComponent::DespawnSegments()
+    void ConveyorBeltComponent::RemoveSegments()
     {
-        bool wasSegmentRemoved = false;
-        for (auto& [pos, handle] : m_conveyorSegments)
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
         {
-            const bool positiveDirection = m_configuration.m_speed > 0.0f;
-            if ((positiveDirection && pos > 1.0f) || (!positiveDirection && pos < 0.0f))
+            for (auto& [pos, handle] : m_conveyorSegments)
             {
-                AZ::Interface<AzPhysics::SceneInterface>::Get()->RemoveSimulatedBody(m_sceneHandle, handle);
-                handle = AzPhysics::InvalidSimulatedBodyHandle;
-                wasSegmentRemoved = true;
+                sceneInterface->RemoveSimulatedBody(m_sceneHandle, handle);
             }
         }
-        if (wasSegmentRemoved)
-        {
-            const auto isInvalidHandle = [](const auto& pair)
-            {
-                return pair.second == AzPhysics::InvalidSimulatedBodyHandle;
-            };
-            // clear object handle from cache
-            m_conveyorSegments.erase(
-                AZStd::remove_if(m_conveyorSegments.begin(), m_conveyorSegments.end(), isInvalidHandle), m_conveyorSegments.end());
-        }
+        m_conveyorSegments.clear();
     }
 
     void ConveyorBeltComponent::MoveSegmentsPhysically(float fixedDeltaTime)
@@ -318,28 +334,19 @@ namespace WarehouseAutomation
             if (body)
             {
                 pos += m_configuration.m_speed * fixedDeltaTime / m_splineLength;
-                auto transform = GetTransformFromSpline(m_splineConsPtr, pos);
-                transform.SetTranslation(transform.GetTranslation());
-                body->SetKinematicTarget(transform);
+                if (pos < 0.0f || pos > 1.0f)
+                {
+                    // Wrap the segment to the other end of the belt, keeping the distance it moved past the end.
+                    // It is teleported without a kinematic target, so it does not sweep objects along the whole belt.
+                    pos -= AZStd::floor(pos);
+                    body->SetTransform(GetTransformFromSamples(pos));
+                }
+                else
+                {
+                    body->SetKinematicTarget(GetTransformFromSamples(pos));
+                }
             }
         }
     }
 
-    void ConveyorBeltComponent::SpawnSegments(float deltaTime)
-    {
-        // Find normalized spawn place (0.0 or 1.0) depending on movement direction
-        const float spawnPlaceNormalized = static_cast<float>(m_configuration.m_speed<0.0f);
-        m_deltaTimeFromLastSpawn += deltaTime;
-        if (m_conveyorSegments.empty())
-        {
-            m_conveyorSegments.push_back(CreateSegment(m_splineConsPtr, spawnPlaceNormalized));
-            return;
-        }
-        if (m_deltaTimeFromLastSpawn > SegmentSeparation * m_configuration.m_segmentSize / AZStd::abs(m_configuration.m_speed))
-        {
-            m_deltaTimeFromLastSpawn = 0.f;
-            m_conveyorSegments.push_back(CreateSegment(m_splineConsPtr, spawnPlaceNormalized));
-        }
-    }
-
 } // namespace WarehouseAutomation
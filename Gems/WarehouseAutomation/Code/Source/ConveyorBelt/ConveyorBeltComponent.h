@@ -16,7 +16,7 @@
 #include <AzCore/Math/Spline.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
-#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBodyEvents.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
@@ -29,7 +29,9 @@ namespace WarehouseAutomation
     //! Component that simulates a conveyor belt using kinematic physics.
     //! The conveyor belt is simulated using a spline and number of kinematic rigid bodies.
     //! The kinematic rigid bodies have their kinematic targets set to interpolate along the spline.
-    //! The component is updating kinematic targets every physic sub-step and creates and despawns rigid bodies as needed.
+    //! The component is updating kinematic targets every physic sub-step. Rigid bodies are created once, as a ring of segments:
+    //! a segment that reaches the end of the belt is teleported back to its start.
+    //! The spline is sampled once on activation and segment poses are interpolated from the samples.
     class ConveyorBeltComponent
         : public AZ::Component
         , public AZ::TickBus::Handler
@@ -37,6 +39,7 @@ namespace WarehouseAutomation
         , protected WarehouseAutomation::ConveyorBeltRequestBus::Handler
     {
         static constexpr float SegmentSeparation = 1.0f; //!< Separation between segments of the belt (in normalized units)
+        static constexpr int SplineSamplesPerSegment = 4; //!< Number of spline samples per distance between segments
 
     public:
         AZ_COMPONENT(ConveyorBeltComponent, "{B7F56411-01D4-48B0-8874-230C58A578BD}");
@@ -73,11 +76,19 @@ namespace WarehouseAutomation
         //! @return the transform of the pose on the spline at the given distance
         AZ::Transform GetTransformFromSpline(AZ::ConstSplinePtr splinePtr, float distanceNormalized);
 
+        //! Sample poses along the whole spline, evenly spaced by length
+        //! @param splinePtr the spline to sample
+        void SampleSpline(AZ::ConstSplinePtr splinePtr);
+
+        //! Obtains the transform of the pose on the spline at the given distance, interpolated from the spline samples
+        //! @param distanceNormalized the distance along the spline to obtain the transform from (normalized)
+        //! @return the transform of the pose on the spline at the given distance
+        AZ::Transform GetTransformFromSamples(float distanceNormalized) const;
+
         //! Spawn a rigid body at the given location
-        //! @param splinePtr the spline to spawn the rigid body on
-        //! @param location the location to spawn the rigid body at (normalized)
+        //! @param normalizedLocation the location to spawn the rigid body at (normalized)
         //! @return a pair of the normalized location and the handle of the simulated body
-        AZStd::pair<float, AzPhysics::SimulatedBodyHandle> CreateSegment(AZ::ConstSplinePtr splinePtr, float normalizedLocation);
+        AZStd::pair<float, AzPhysics::SimulatedBodyHandle> CreateSegment(float normalizedLocation);
 
         // AZ::TickBus::Handler overrides...
         void OnTick(float delta, AZ::ScriptTimePoint timePoint) override;
@@ -91,21 +102,18 @@ namespace WarehouseAutomation
         //! @param deltaTime the time since the last update
         void MoveSegmentsGraphically(float deltaTime);
 
-        //! Update location of segments in physics scene
+        //! Update location of segments in physics scene, teleporting segments that passed an end of the spline to its other end
         //! @param deltaTime the time since the last update
         void MoveSegmentsPhysically(float deltaTime);
 
-        //! Despawn segments that are at the end of the spline
-        void DespawnSegments();
-
-        //! Spawn segments with given rate of spawning
-        //! @param deltaTime the time since the last call of the function
-        void SpawnSegments(float deltaTime);
+        //! Remove rigid bodies of all segments from the physics scene
+        void RemoveSegments();
 
         ConveyorBeltComponentConfiguration m_configuration; //!< Configuration of the component
 
         AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimStartHandler; //!< Handler called after every physics sub-step
-        AZStd::deque<AZStd::pair<float, AzPhysics::SimulatedBodyHandle>> m_conveyorSegments; //!< Cache of created segments
+        AZStd::vector<AZStd::pair<float, AzPhysics::SimulatedBodyHandle>> m_conveyorSegments; //!< Ring of created segments
+        AZStd::vector<AZ::Transform> m_splineSamples; //!< Poses along the spline in world frame, evenly spaced by length
         float m_textureOffset = 0.0f; //!< Current offset of the texture during animation
         AZ::ConstSplinePtr m_splineConsPtr{ nullptr }; //!< Pointer to the spline
         float m_splineLength = -1.0f; //!< Non-normalized spline length
@@ -114,7 +122,6 @@ namespace WarehouseAutomation
         AZ::Vector3 m_endPoint; //!< End point of the belt
         AzPhysics::SceneHandle m_sceneHandle; //!< Scene handle of the scene the belt is in
         bool m_beltStopped = false; //!< State of the conveyor belt
-        float m_deltaTimeFromLastSpawn = 0.0f; //!< Time since the last spawn
         AZ::Render::MaterialAssignmentId m_graphhicalMaterialId; //!< Material id of the animated belt
     };
 } // namespace WarehouseAutomation
@@ -8,8 +8,11 @@
  */
 
 #include "ProximitySensor.h"
+#include "ProximitySensorSystemComponent.h"
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Quaternion.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
@@ -32,10 +35,12 @@ namespace WarehouseAutomation
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serialize->Class<ProximitySensor, AZ::Component>()
-                ->Version(1)
+                ->Version(2)
                 ->Field("visualize", &ProximitySensor::m_visualize)
                 ->Field("frequency", &ProximitySensor::m_frequency)
-                ->Field("detectionDistance", &ProximitySensor::m_detectionDistance);
+                ->Field("detectionDistance", &ProximitySensor::m_detectionDistance)
+                ->Field("rayCount", &ProximitySensor::m_rayCount)
+                ->Field("fanAngle", &ProximitySensor::m_fanAngle);
 
             if (AZ::EditContext* editContext = serialize->GetEditContext())
             {
@@ -53,7 +58,16 @@ namespace WarehouseAutomation
                         &ProximitySensor::m_detectionDistance,
                         "Detection distance",
                         "The maximum distance from where object is detected")
-                    ->Attribute(AZ::Edit::Attributes::Min, 0.f);
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &ProximitySensor::m_rayCount, "Ray count", "Number of rays in the fan")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(
+                        AZ::Edit::UIHandlers::Default,
+                        &ProximitySensor::m_fanAngle,
+                        "Fan angle",
+                        "Angle between the first and the last ray of the fan (degrees). Rays are spread in the XY plane of the entity")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->Attribute(AZ::Edit::Attributes::Max, 360.f);
             }
         }
         if (AZ::BehaviorContext* behaviorContext = azrtti_cast<AZ::BehaviorContext*>(context))
@@ -76,67 +90,82 @@ namespace WarehouseAutomation
             m_drawQueue = AZ::RPI::AuxGeomFeatureProcessorInterface::GetDrawQueueForScene(entityScene);
         }
 
-        AZ::Transform entityTransform;
+        AZ::Transform entityTransform = AZ::Transform::CreateIdentity();
         AZ::TransformBus::EventResult(entityTransform, GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
 
-        m_detectionDirection = entityTransform.TransformVector(AZ::Vector3::CreateAxisX());
-        m_detectionDirection.Normalize();
+        CreateRayRequests();
+        UpdateRayRequests(entityTransform);
+        m_objectInRange.reset();
+        m_timeElapsedSinceLastTick = 0.f;
 
-        AZ::TickBus::Handler::BusConnect();
+        AZ::TransformNotificationBus::Handler::BusConnect(GetEntityId());
+        if (m_visualize)
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
+
+        auto* proximitySensorSystem = ProximitySensorSystemInterface::Get();
+        AZ_Assert(proximitySensorSystem, "ProximitySensorSystemComponent is not active");
+        if (proximitySensorSystem)
+        {
+            proximitySensorSystem->RegisterSensor(this);
+        }
     }
 
     void ProximitySensor::Deactivate()
     {
+        if (auto* proximitySensorSystem = ProximitySensorSystemInterface::Get())
+        {
+            proximitySensorSystem->UnregisterSensor(this);
+        }
         AZ::TickBus::Handler::BusDisconnect();
+        AZ::TransformNotificationBus::Handler::BusDisconnect();
     }
 
-    void ProximitySensor::Visualize()
+    void ProximitySensor::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
     {
-        if (m_drawQueue)
-        {
-            AZStd::vector<AZ::Vector3> linePoints;
-
-            AZ::Vector3 entityTranslation;
-            AZ::TransformBus::EventResult(entityTranslation, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
-            AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
-
-            linePoints.push_back(entityTranslation);
-            if (m_position)
-            {
-                drawArgs.m_colors = &AZ::Colors::Green;
-                linePoints.push_back(m_position.value());
-            }
-            else
-            {
-                drawArgs.m_colors = &AZ::Colors::Red;
-                linePoints.push_back(entityTranslation + m_detectionDirection * m_detectionDistance);
-            }
-
-            const uint8_t pixelSize = 5;
-            drawArgs.m_verts = linePoints.data();
-            drawArgs.m_vertCount = linePoints.size();
+        UpdateRayRequests(world);
+    }
 
-            drawArgs.m_colorCount = 1;
-            drawArgs.m_opacityType = AZ::RPI::AuxGeomDraw::OpacityType::Opaque;
-            drawArgs.m_size = pixelSize;
-            m_drawQueue->DrawLines(drawArgs);
+    void ProximitySensor::CreateRayRequests()
+    {
+        const AZ::u32 rayCount = AZStd::max(m_rayCount, 1u);
+        m_rayRequests.clear();
+        m_rayRequests.reserve(rayCount);
+        for (AZ::u32 rayIndex = 0; rayIndex < rayCount; ++rayIndex)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_distance = m_detectionDistance;
+            m_rayRequests.emplace_back(AZStd::move(request));
         }
+        m_hitPositions.assign(rayCount, AZStd::nullopt);
     }
 
-    void ProximitySensor::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+    void ProximitySensor::UpdateRayRequests(const AZ::Transform& worldTransform)
     {
-        if (m_visualize)
+        const size_t rayCount = m_rayRequests.size();
+        const float fanAngle = AZ::DegToRad(m_fanAngle);
+        const float angleStep = rayCount > 1 ? fanAngle / (rayCount - 1) : 0.f;
+        for (size_t rayIndex = 0; rayIndex < rayCount; ++rayIndex)
         {
-            Visualize();
+            const float angle = -fanAngle / 2.f + angleStep * rayIndex;
+            const AZ::Vector3 localDirection = AZ::Quaternion::CreateRotationZ(angle).TransformVector(AZ::Vector3::CreateAxisX());
+
+            auto* request = static_cast<AzPhysics::RayCastRequest*>(m_rayRequests[rayIndex].get());
+            request->m_start = worldTransform.GetTranslation();
+            request->m_direction = worldTransform.TransformVector(localDirection).GetNormalized();
         }
+    }
 
+    bool ProximitySensor::IsCheckDue(float deltaTime)
+    {
         AZ_Assert(m_frequency > 0.f, "ProximitySensor frequency must be greater than zero");
         auto frameTime = 1.f / m_frequency;
 
         m_timeElapsedSinceLastTick += deltaTime;
         if (m_timeElapsedSinceLastTick < frameTime)
         {
-            return;
+            return false;
         }
 
         m_timeElapsedSinceLastTick -= frameTime;
@@ -145,36 +174,64 @@ namespace WarehouseAutomation
           // up, just keep going with each frame.
             m_timeElapsedSinceLastTick = 0.0f;
         }
-        DetectionCheck();
+        return true;
     }
 
-    void ProximitySensor::DetectionCheck()
+    const AzPhysics::SceneQueryRequests& ProximitySensor::GetRayRequests() const
     {
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-
-        AZ::Vector3 entityTranslation;
-        AZ::TransformBus::EventResult(entityTranslation, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
-
-        AzPhysics::RayCastRequest request;
-        request.m_start = entityTranslation;
-        request.m_direction = m_detectionDirection;
-        request.m_distance = m_detectionDistance;
+        return m_rayRequests;
+    }
 
-        if (AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-            sceneHandle != AzPhysics::InvalidSceneHandle)
+    bool ProximitySensor::ProcessHits(AZStd::span<const AzPhysics::SceneQueryHits> hits)
+    {
+        AZ_Assert(hits.size() == m_hitPositions.size(), "Number of hits should be equal to number of rays");
+        bool objectInRange = false;
+        for (size_t rayIndex = 0; rayIndex < hits.size(); ++rayIndex)
         {
-            AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(sceneHandle, &request);
+            const auto& rayHits = hits[rayIndex].m_hits;
+            m_hitPositions[rayIndex] = !rayHits.empty() ? AZStd::make_optional(rayHits.front().m_position) : AZStd::nullopt;
+            objectInRange |= !rayHits.empty();
+        }
 
-            m_position = !result.m_hits.empty() ? std::make_optional(result.m_hits.front().m_position) : std::nullopt;
+        const bool stateChanged = !m_objectInRange.has_value() || m_objectInRange.value() != objectInRange;
+        m_objectInRange = objectInRange;
+        return stateChanged;
+    }
 
-            if (m_position)
-            {
-                ProximitySensorNotificationBus::Event(GetEntityId(), &ProximitySensorNotifications::OnObjectInRange);
-            }
-            else
+    bool ProximitySensor::IsObjectInRange() const
+    {
+        return m_objectInRange.value_or(false);
+    }
+
+    void ProximitySensor::Visualize()
+    {
+        if (m_drawQueue)
+        {
+            AZStd::vector<AZ::Vector3> linePoints;
+            linePoints.reserve(m_rayRequests.size() * 2);
+            for (size_t rayIndex = 0; rayIndex < m_rayRequests.size(); ++rayIndex)
             {
-                ProximitySensorNotificationBus::Event(GetEntityId(), &ProximitySensorNotifications::OnObjectOutOfRange);
+                const auto* request = static_cast<const AzPhysics::RayCastRequest*>(m_rayRequests[rayIndex].get());
+                linePoints.push_back(request->m_start);
+                linePoints.push_back(m_hitPositions[rayIndex].value_or(request->m_start + request->m_direction * request->m_distance));
             }
+
+            AZ::RPI::AuxGeomDraw::AuxGeomDynamicDrawArguments drawArgs;
+            drawArgs.m_colors = IsObjectInRange() ? &AZ::Colors::Green : &AZ::Colors::Red;
+
+            const uint8_t pixelSize = 5;
+            drawArgs.m_verts = linePoints.data();
+            drawArgs.m_vertCount = linePoints.size();
+
+            drawArgs.m_colorCount = 1;
+            drawArgs.m_opacityType = AZ::RPI::AuxGeomDraw::OpacityType::Opaque;
+            drawArgs.m_size = pixelSize;
+            m_drawQueue->DrawLines(drawArgs);
         }
     }
+
+    void ProximitySensor::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        Visualize();
+    }
 } // namespace WarehouseAutomation
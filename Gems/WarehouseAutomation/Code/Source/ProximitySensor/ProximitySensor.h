@@ -11,15 +11,24 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/optional.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
 namespace WarehouseAutomation
 {
     //! Simple proximity sensor based on raycasting
-    //! This component publishes a bool topic depending on the object presence
+    //! This component notifies about the object presence through ProximitySensorNotificationBus, when the presence changes.
+    //! The sensor casts a fan of rays in its XY plane, centered on its X axis; an object is detected if any of the rays hits.
+    //! Detection checks of all sensors are batched by ProximitySensorSystemComponent.
     class ProximitySensor
         : public AZ::Component
         , public AZ::TickBus::Handler
+        , public AZ::TransformNotificationBus::Handler
     {
     public:
         AZ_COMPONENT(ProximitySensor, "{1f7b51f6-9450-4da4-9636-672a056e8812}", AZ::Component);
@@ -33,21 +42,51 @@ namespace WarehouseAutomation
         void Deactivate() override;
         //////////////////////////////////////////////////////////////////////////
 
+        //! Advance the detection timer of the sensor.
+        //! @param deltaTime the time since the last call
+        //! @return true if a detection check is due
+        bool IsCheckDue(float deltaTime);
+
+        //! @return ray cast requests of the sensor in world frame
+        const AzPhysics::SceneQueryRequests& GetRayRequests() const;
+
+        //! Update the detection state with results of the ray cast requests.
+        //! @param hits results of the requests returned by GetRayRequests, in the same order
+        //! @return true if the detection state changed
+        bool ProcessHits(AZStd::span<const AzPhysics::SceneQueryHits> hits);
+
+        //! @return true if an object was detected by the last detection check
+        bool IsObjectInRange() const;
+
     private:
         //////////////////////////////////////////////////////////////////////////
         // AZ::TickBus::Handler overrides
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         //////////////////////////////////////////////////////////////////////////
 
+        //////////////////////////////////////////////////////////////////////////
+        // AZ::TransformNotificationBus::Handler overrides
+        void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
+        //////////////////////////////////////////////////////////////////////////
+
         void Visualize();
-        void DetectionCheck();
+
+        //! Create ray cast requests of the fan.
+        void CreateRayRequests();
+
+        //! Update ray cast requests with the world transform of the sensor.
+        void UpdateRayRequests(const AZ::Transform& worldTransform);
 
         bool m_visualize{ true };
         float m_frequency{ 10.f };
 
-        AZ::Vector3 m_detectionDirection{ AZ::Vector3::CreateAxisX() };
         float m_detectionDistance{ 1.f };
-        std::optional<AZ::Vector3> m_position;
+        AZ::u32 m_rayCount{ 1 }; //!< Number of rays in the fan
+        float m_fanAngle{ 0.f }; //!< Angle between the first and the last ray of the fan, in degrees
+
+        AzPhysics::SceneQueryRequests m_rayRequests; //!< Ray cast requests, kept in world frame
+        AZStd::vector<AZStd::optional<AZ::Vector3>> m_hitPositions; //!< Hit position of each ray in the last detection check
+        AZStd::optional<bool> m_objectInRange; //!< Detection state, empty before the first detection check
         float m_timeElapsedSinceLastTick{ 0.f };
 
         AZ::RPI::AuxGeomDrawPtr m_drawQueue;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ProximitySensorSystemComponent.h"
+#include "ProximitySensor.h"
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <WarehouseAutomation/ProximitySensor/ProximitySensorNotificationBus.h>
+
+namespace WarehouseAutomation
+{
+    void ProximitySensorSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<ProximitySensorSystemComponent, AZ::Component>()->Version(0);
+        }
+    }
+
+    void ProximitySensorSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ProximitySensorSystemService"));
+    }
+
+    void ProximitySensorSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ProximitySensorSystemService"));
+    }
+
+    void ProximitySensorSystemComponent::Activate()
+    {
+        m_sceneSimStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                DetectionCheck(fixedDeltaTime);
+            },
+            aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Components));
+        ProximitySensorSystemInterface::Register(this);
+    }
+
+    void ProximitySensorSystemComponent::Deactivate()
+    {
+        ProximitySensorSystemInterface::Unregister(this);
+        m_sceneSimStartHandler.Disconnect();
+        m_sensors.clear();
+        m_sceneHandle = AzPhysics::InvalidSceneHandle;
+    }
+
+    void ProximitySensorSystemComponent::RegisterSensor(ProximitySensor* sensor)
+    {
+        m_sensors.push_back(sensor);
+        if (m_sceneSimStartHandler.IsConnected())
+        {
+            return;
+        }
+
+        // Sensors are only active in game, when the default physics scene exists. The scene is looked up once for all sensors.
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZ_Assert(sceneInterface, "No scene interface");
+        m_sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+        if (m_sceneHandle != AzPhysics::InvalidSceneHandle)
+        {
+            sceneInterface->RegisterSceneSimulationStartHandler(m_sceneHandle, m_sceneSimStartHandler);
+        }
+    }
+
+    void ProximitySensorSystemComponent::UnregisterSensor(ProximitySensor* sensor)
+    {
+        m_sensors.erase(AZStd::remove(m_sensors.begin(), m_sensors.end(), sensor), m_sensors.end());
+        if (m_sensors.empty())
+        {
+            m_sceneSimStartHandler.Disconnect();
+            m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        }
+    }
+
+    void ProximitySensorSystemComponent::DetectionCheck(float deltaTime)
+    {
+        m_dueSensors.clear();
+        m_requests.clear();
+        for (ProximitySensor* sensor : m_sensors)
+        {
+            if (sensor->IsCheckDue(deltaTime))
+            {
+                m_dueSensors.push_back(sensor);
+                const auto& rayRequests = sensor->GetRayRequests();
+                m_requests.insert(m_requests.end(), rayRequests.begin(), rayRequests.end());
+            }
+        }
+
+        if (m_requests.empty())
+        {
+            return;
+        }
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_sceneHandle, m_requests);
+        AZ_Assert(results.size() == m_requests.size(), "Number of results should be equal to number of requests");
+
+        m_stateChanges.clear();
+        size_t resultIndex = 0;
+        for (ProximitySensor* sensor : m_dueSensors)
+        {
+            const size_t rayCount = sensor->GetRayRequests().size();
+            if (sensor->ProcessHits(AZStd::span(results.data() + resultIndex, rayCount)))
+            {
+                m_stateChanges.emplace_back(sensor->GetEntityId(), sensor->IsObjectInRange());
+            }
+            resultIndex += rayCount;
+        }
+
+        // Notifications are sent after all sensors are processed, since handlers might deactivate sensors.
+        for (const auto& [entityId, objectInRange] : m_stateChanges)
+        {
+            if (objectInRange)
+            {
+                ProximitySensorNotificationBus::Event(entityId, &ProximitySensorNotifications::OnObjectInRange);
+            }
+            else
+            {
+                ProximitySensorNotificationBus::Event(entityId, &ProximitySensorNotifications::OnObjectOutOfRange);
+            }
+        }
+    }
+} // namespace WarehouseAutomation
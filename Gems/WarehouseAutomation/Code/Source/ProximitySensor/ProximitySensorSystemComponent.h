@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root
+ * of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utility/pair.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+
+namespace WarehouseAutomation
+{
+    class ProximitySensor;
+
+    //! System running detection checks of all active proximity sensors.
+    //! Rays of all sensors due for a check are gathered into a single batched scene query, once per physics sub-step.
+    class ProximitySensorSystemComponent : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ProximitySensorSystemComponent, "{5d3b2e8a-7c41-4f06-9a1e-2b8c6d4f0e73}", AZ::Component);
+        ProximitySensorSystemComponent() = default;
+        ~ProximitySensorSystemComponent() = default;
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        //////////////////////////////////////////////////////////////////////////
+        // Component overrides
+        void Activate() override;
+        void Deactivate() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Register a sensor for detection checks. The sensor must be unregistered before it is destroyed.
+        void RegisterSensor(ProximitySensor* sensor);
+
+        //! Unregister a sensor, detection checks of the sensor stop immediately.
+        void UnregisterSensor(ProximitySensor* sensor);
+
+    private:
+        //! Run detection checks of all sensors that are due, and notify about the sensors that changed their state.
+        //! @param deltaTime the time since the last physics sub-step
+        void DetectionCheck(float deltaTime);
+
+        AZStd::vector<ProximitySensor*> m_sensors; //!< Registered sensors
+        AZStd::vector<ProximitySensor*> m_dueSensors; //!< Sensors checked in the current sub-step
+        AzPhysics::SceneQueryRequests m_requests; //!< Rays of the sensors checked in the current sub-step
+        AZStd::vector<AZStd::pair<AZ::EntityId, bool>> m_stateChanges; //!< Sensors that changed their state in the current sub-step
+
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle; //!< Scene handle of the default physics scene
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimStartHandler; //!< Handler called before every physics sub-step
+    };
+
+    using ProximitySensorSystemInterface = AZ::Interface<ProximitySensorSystemComponent>;
+} // namespace WarehouseAutomation
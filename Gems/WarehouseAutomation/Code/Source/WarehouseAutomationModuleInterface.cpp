@@ -9,6 +9,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <ConveyorBelt/ConveyorBeltComponent.h>
 #include <ProximitySensor/ProximitySensor.h>
+#include <ProximitySensor/ProximitySensorSystemComponent.h>
 
 namespace WarehouseAutomation
 {
@@ -24,6 +25,14 @@ namespace WarehouseAutomation
             {
                 ConveyorBeltComponent::CreateDescriptor(),
                 ProximitySensor::CreateDescriptor(),
+                ProximitySensorSystemComponent::CreateDescriptor(),
             });
     }
+
+    AZ::ComponentTypeList WarehouseAutomationModuleInterface::GetRequiredSystemComponents() const
+    {
+        return AZ::ComponentTypeList{
+            azrtti_typeid<ProximitySensorSystemComponent>(),
+        };
+    }
 } // namespace WarehouseAutomation
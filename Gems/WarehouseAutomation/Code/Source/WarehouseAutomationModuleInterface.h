@@ -20,5 +20,8 @@ namespace WarehouseAutomation
         AZ_CLASS_ALLOCATOR_DECL
 
         WarehouseAutomationModuleInterface();
+
+        //! Add required SystemComponents to the SystemEntity.
+        AZ::ComponentTypeList GetRequiredSystemComponents() const override;
     };
 } // namespace WarehouseAutomation
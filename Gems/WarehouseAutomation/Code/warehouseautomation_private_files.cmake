@@ -11,4 +11,6 @@ set(FILES
     Source/ConveyorBelt/ConveyorBeltComponentConfiguration.h
     Source/ProximitySensor/ProximitySensor.cpp
     Source/ProximitySensor/ProximitySensor.h
+    Source/ProximitySensor/ProximitySensorSystemComponent.cpp
+    Source/ProximitySensor/ProximitySensorSystemComponent.h
 )